@@ -55,6 +55,7 @@ MM_EnvironmentDelegate::acquireVMAccess()
 {
 	OMR_VM_Example *exampleVM = (OMR_VM_Example *)_env->getOmrVM()->_language_vm;
 	omrthread_rwmutex_enter_read(exampleVM->_vmAccessMutex);
+	_vmAccessCount += 1;
 }
 
 /**
@@ -64,9 +65,30 @@ void
 MM_EnvironmentDelegate::releaseVMAccess()
 {
 	OMR_VM_Example *exampleVM = (OMR_VM_Example *)_env->getOmrVM()->_language_vm;
+	Assert_MM_true(0 < _vmAccessCount);
+	_vmAccessCount -= 1;
 	omrthread_rwmutex_exit_read(exampleVM->_vmAccessMutex);
 }
 
+void
+MM_EnvironmentDelegate::releaseCriticalHeapAccess(uintptr_t *data)
+{
+	OMR_VM_Example *exampleVM = (OMR_VM_Example *)_env->getOmrVM()->_language_vm;
+	*data = _vmAccessCount;
+	for (; 0 < _vmAccessCount; _vmAccessCount--) {
+		omrthread_rwmutex_exit_read(exampleVM->_vmAccessMutex);
+	}
+}
+
+void
+MM_EnvironmentDelegate::reacquireCriticalHeapAccess(uintptr_t data)
+{
+	OMR_VM_Example *exampleVM = (OMR_VM_Example *)_env->getOmrVM()->_language_vm;
+	for (; _vmAccessCount < data; _vmAccessCount++) {
+		omrthread_rwmutex_enter_read(exampleVM->_vmAccessMutex);
+	}
+}
+
 /**
  * Check whether another thread is requesting exclusive VM access. This method must be
  * called frequently by all threads that are holding shared VM access. If this method
@@ -103,6 +125,11 @@ MM_EnvironmentDelegate::acquireExclusiveVMAccess()
 		/* tell the rest of the world that a thread is going for exclusive VM< access */
 		MM_AtomicOperations::add(&exampleVM->_vmExclusiveAccessCount, 1);
 
+		/* a thread requesting exclusive VM access (e.g. to collect) with shared VM access must not wait for itself */
+		for (uintptr_t i = 0; i < _vmAccessCount; i++) {
+			omrthread_rwmutex_exit_read(exampleVM->_vmAccessMutex);
+		}
+
 		/* unconditionally acquire exclusive VM access by locking the VM thread list mutex */
 		omrthread_rwmutex_enter_write(exampleVM->_vmAccessMutex);
 		omrthread_monitor_enter(omrVM->_vmThreadListMutex);
@@ -125,6 +152,9 @@ MM_EnvironmentDelegate::releaseExclusiveVMAccess()
 		Assert_MM_true(0 < exampleVM->_vmExclusiveAccessCount);
 		MM_AtomicOperations::subtract(&exampleVM->_vmExclusiveAccessCount, 1);
 		_env->getOmrVMThread()->exclusiveCount -= 1;
+		for (uintptr_t i = 0; i < _vmAccessCount; i++) {
+			omrthread_rwmutex_enter_read(exampleVM->_vmAccessMutex);
+		}
 	} else if (1 < _env->getOmrVMThread()->exclusiveCount) {
 		_env->getOmrVMThread()->exclusiveCount -= 1;
 	}
@@ -83,6 +83,7 @@ class MM_EnvironmentDelegate
 private:
 	MM_EnvironmentBase *_env;
 	GC_Environment _gcEnv;
+	uintptr_t _vmAccessCount; /**< number of times the thread has acquired shared VM access and not released it */
 
 protected:
 
@@ -197,14 +198,15 @@ public:
 	/**
 	 * Acquire exclusive VM access. This method should only be called by the OMR runtime to
 	 * perform stop-the-world operations such as garbage collection. Calling thread will be
-	 * blocked until all other threads holding shared VM access have release VM access.
+	 * blocked until all other threads holding shared VM access have release VM access. A
+	 * calling thread holding shared VM access gives it up while it holds exclusive VM access.
 	 */
 	void acquireExclusiveVMAccess();
 
 	/**
 	 * Release exclusive VM acccess. If no other thread is waiting for exclusive VM access
 	 * this method will notify all threads waiting for shared VM access to continue and
-	 * acquire shared VM access.
+	 * acquire shared VM access. Shared VM access given up by the calling thread is reacquired.
 	 */
 	void releaseExclusiveVMAccess();
 
@@ -229,9 +231,20 @@ public:
 	 */
 	void assumeExclusiveVMAccess(uintptr_t exclusiveCount);
 
-	void releaseCriticalHeapAccess(uintptr_t *data) {}
+	/**
+	 * Give up shared VM access while waiting for a collection requested by another thread, which
+	 * would otherwise wait for this thread to release it.
+	 *
+	 * @param[out] data the shared VM access to be restored by reacquireCriticalHeapAccess()
+	 */
+	void releaseCriticalHeapAccess(uintptr_t *data);
 
-	void reacquireCriticalHeapAccess(uintptr_t data) {}
+	/**
+	 * Reacquire shared VM access given up by releaseCriticalHeapAccess().
+	 *
+	 * @param data the shared VM access returned by releaseCriticalHeapAccess()
+	 */
+	void reacquireCriticalHeapAccess(uintptr_t data);
 
 	void forceOutOfLineVMAccess() {}
 
@@ -279,6 +292,7 @@ public:
 
 	MM_EnvironmentDelegate()
 		: _env(NULL)
+		, _vmAccessCount(0)
 	{ }
 };
 
@@ -188,6 +188,23 @@ public:
 	 */
 	MMINLINE void handleWorkPacketOverflowItem(MM_EnvironmentBase *env, omrobjectptr_t objectPtr) { }
 
+	/**
+	 * This method is called for every object marked while the live object census is enabled (markingClassHistogram).
+	 * It must return a key shared by all objects of the class of the object, which is how the census groups objects.
+	 * Keys are reported in verbose GC, so class pointers or class identifiers are suitable.
+	 *
+	 * Example objects have no class, so they are grouped by size.
+	 *
+	 * @param env The environment for the calling thread
+	 * @param objectPtr Points to the marked heap object
+	 * @return the class key of the object, or 0 to count the object without a class
+	 */
+	MMINLINE uintptr_t
+	getClassHistogramKey(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		return _objectModel->getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+
 	/**
 	 * This method is called after the object graph depending from the root set has been traversed and all live
 	 * heap objects included in the root set and dependent graph have been marked. If there are other heap objects
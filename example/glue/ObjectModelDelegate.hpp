@@ -242,6 +242,34 @@ public:
 		return U_8_MAX;
 	}
 
+	/**
+	 * Returns a key shared by all objects of the class of the object referred to by the forwarded header.
+	 * The scavenger indexes the hot fields it discovers (scavengerHotFieldDiscovery) with this key.
+	 *
+	 * Example objects have no class, but all their slots are references, so objects of one size share a layout.
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @return the class key of the object, or 0 if hot fields should not be discovered for the object
+	 */
+	MMINLINE uintptr_t
+	getHotFieldClassKey(MM_ForwardedHeader *forwardedHeader)
+	{
+		ObjectHeader header(forwardedHeader->getPreservedSlot());
+		return header.sizeInBytes();
+	}
+
+	/**
+	 * Returns a key shared by all objects of the class of an object, as for getHotFieldClassKey(MM_ForwardedHeader *).
+	 *
+	 * @param objectPtr pointer to the object
+	 * @return the class key of the object, or 0 if hot fields should not be discovered for the object
+	 */
+	MMINLINE uintptr_t
+	getHotFieldClassKey(omrobjectptr_t objectPtr)
+	{
+		return objectPtr->header.sizeInBytes();
+	}
+
 	/**
 	 * Get the instance size (total) of a forwarded object from the forwarding pointer. The  size must
 	 * include the header and any expansion bytes to be allocated if the object will grow when moved.
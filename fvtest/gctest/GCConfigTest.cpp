@@ -26,6 +26,7 @@
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "ParallelDispatcher.hpp"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
 #include "VerboseWriterChain.hpp"
@@ -43,12 +44,38 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_lockfree_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_histogram_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_park_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_asynclog_GC_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_pacing_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_cardsummary_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_workstealing_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_numa_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_cardrs_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_hotfields_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_tlhbatch_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_tlhadaptive_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_thp_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_pretouch_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_forecast_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_adaptive_threads_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_heapwalk_GC_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_config.xml"
+                        , "fvtest/gctest/configuration/segregated_sizeclassstats_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_IDLE_HEAP_MANAGER)
+                        , "fvtest/gctest/configuration/scavenger_idle_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_idle_detector_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_idle_startup_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
@@ -104,6 +131,12 @@ GCConfigTest::SetUp()
 	if (0 == strcmp(verboseFileNamePrefix, "")) {
 		verboseFileNamePrefix = "VerboseGCOutput";
 	}
+
+	/* run tasks on fewer threads than were started, so workers with any ID up to the maximum can take part */
+	uintptr_t taskThreadCount = (uintptr_t)optionNode.attribute("taskThreadCount").as_int();
+	if (0 != taskThreadCount) {
+		env->getExtensions()->dispatcher->setThreadCount(taskThreadCount);
+	}
 	verboseFile = (char *)omrmem_allocate_memory(MAX_NAME_LENGTH, OMRMEM_CATEGORY_MM);
 	if (NULL == verboseFile) {
 		FAIL() << "Failed to allocate native memory.";
@@ -953,10 +986,42 @@ done:
 	return rt;
 }
 
+/**
+ * Per thread accumulator of the heapWalk operation.
+ */
+typedef struct HeapWalkCounts {
+	uintptr_t objects;
+	uintptr_t bytes;
+	uintptr_t threads;
+} HeapWalkCounts;
+
+static void
+heapWalkCountObject(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *threadData, void *userData)
+{
+	HeapWalkCounts *counts = (HeapWalkCounts *)threadData;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	counts->objects += 1;
+	counts->bytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+}
+
+static void
+heapWalkMergeCounts(OMR_VMThread *omrVMThread, void *threadData, void *userData)
+{
+	HeapWalkCounts *counts = (HeapWalkCounts *)threadData;
+	HeapWalkCounts *total = (HeapWalkCounts *)userData;
+	total->objects += counts->objects;
+	total->bytes += counts->bytes;
+	if (0 != counts->objects) {
+		total->threads += 1;
+	}
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
 	int32_t rt = 0;
+	/* the object table only holds live objects right after a global collection */
+	bool objectTableIsLive = false;
 	for (; node; node = node.next_sibling()) {
 		if (0 == strcmp(node.name(), "systemCollect")) {
 			const char *gcCodeStr = node.attribute("gcCode").value();
@@ -973,6 +1038,31 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+			objectTableIsLive = true;
+		} else if (0 == strcmp(node.name(), "heapWalk")) {
+			gcTestEnv->log("Invoking parallel heap walk...\n");
+			HeapWalkCounts total = {0, 0, 0};
+			rt = (int32_t)OMR_GC_WalkHeapParallel(exampleVM->_omrVMThread, sizeof(HeapWalkCounts), heapWalkCountObject, heapWalkMergeCounts, &total);
+			if (OMR_ERROR_NONE != rt) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_WalkHeapParallel with error code %d.\n", __FILE__, __LINE__, rt);
+				goto done;
+			}
+			uintptr_t tableObjects = hashTableGetCount(exampleVM->objectTable);
+			gcTestEnv->log("Walked %zu live objects (%zu bytes) on %zu threads, %zu objects in the object table.\n", total.objects, total.bytes, total.threads, tableObjects);
+			if ((0 == total.objects) || (total.objects > tableObjects) || (objectTableIsLive && (total.objects != tableObjects))) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk found %zu live objects, object table holds %zu.\n", __FILE__, __LINE__, total.objects, tableObjects);
+				rt = 1;
+				goto done;
+			}
+		} else if (0 == strcmp(node.name(), "idle")) {
+			/* stop touching the heap, so that a background (e.g. idle) collection can run */
+			uintptr_t timeMs = (uintptr_t)atoi(node.attribute("timeMs").value());
+			gcTestEnv->log("Idling for %zu ms...\n", timeMs);
+			env->releaseVMAccess();
+			omrthread_sleep(timeMs);
+			env->acquireVMAccess();
+			verboseManager->getWriterChain()->endOfCycle(env);
+			objectTableIsLive = false;
 		}
 	}
 done:
@@ -1033,7 +1123,10 @@ TEST_P(GCConfigTest, test)
 			pugi::xpath_node_set objects = configChild.select_nodes(xs.object);
 			int64_t startTime = omrtime_current_time_millis();
 			for (pugi::xpath_node_set::const_iterator it = objects.begin(); it != objects.end(); ++it) {
+				/* the test thread is a mutator, so it holds VM access while it touches the heap */
+				env->acquireVMAccess();
 				rt = allocationWalker(it->node());
+				env->releaseVMAccess();
 				ASSERT_EQ(0, rt) << "Failed to perform allocation.";
 			}
 			gcTestEnv->log("Time elapsed in allocation: %lld ms\n", (omrtime_current_time_millis() - startTime));
@@ -1049,7 +1142,9 @@ TEST_P(GCConfigTest, test)
 			gcTestEnv->log("[ Verification Successful ]\n\n");
 		} else if (0 == strcmp(configChild.name(), "operation")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++++Operation+++++++++++++++++++++++++++\n");
+			env->acquireVMAccess();
 			rt = triggerOperation(configChild.first_child());
+			env->releaseVMAccess();
 			ASSERT_EQ(0, rt) << "Failed to perform gc operation.";
 		} else if (0 == strcmp(configChild.name(), "mutation")) {
 			/*TODO*/
@@ -83,7 +83,8 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +92,12 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+						_useSegregatedGC = true;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,13 +106,103 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentHelperPacing")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentHelperPacing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentCardCleaningSummary")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentCardCleaningSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "asynchronousLogging")) {
+					extensions->asynchronousLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asynchronousLoggingBufferSize")) {
+					extensions->asynchronousLoggingBufferSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "segregatedConcurrentSweep")) {
+					extensions->segregatedConcurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "segregatedConcurrentSweepHelperThreads")) {
+					extensions->segregatedConcurrentSweepHelperThreads = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "segregatedSizeClassStats")) {
+					extensions->segregatedSizeClassStats = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+				} else if (0 == strcmp(attr.name(), "numaGCThreadAffinity")) {
+					extensions->numaGCThreadAffinity = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+				} else if (0 == strcmp(attr.name(), "packetListLockFree")) {
+					extensions->packetListLockFree = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "markingClassHistogram")) {
+					extensions->markingClassHistogram = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "markingClassHistogramTopK")) {
+					extensions->markingClassHistogramTopK = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "dispatcherParkWorkers")) {
+					extensions->dispatcherParkWorkers = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "dispatcherParkSpinCount")) {
+					extensions->dispatcherParkSpinCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreadCount")) {
+					extensions->adaptiveGCThreadCount = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhMaximumSize")) {
+					extensions->tlhMaximumSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "tlhRefreshBatchCount")) {
+					extensions->tlhRefreshBatchCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapHugePagePolicy")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "off")) {
+						extensions->heapHugePagePolicy = MM_GCExtensionsBase::HUGE_PAGE_POLICY_OFF;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "thp")) {
+						extensions->heapHugePagePolicy = MM_GCExtensionsBase::HUGE_PAGE_POLICY_TRANSPARENT;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "explicit")) {
+						extensions->heapHugePagePolicy = MM_GCExtensionsBase::HUGE_PAGE_POLICY_EXPLICIT;
+					} else {
+						extensions->heapHugePagePolicy = MM_GCExtensionsBase::HUGE_PAGE_POLICY_DEFAULT;
+					}
+				} else if (0 == strcmp(attr.name(), "heapPretouch")) {
+					extensions->heapPretouch = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapSizingForecast")) {
+					extensions->heapSizingForecast = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapSizingGCOverheadTarget")) {
+					extensions->heapSizingGCOverheadTarget = atoi(attr.value());
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+				} else if (0 == strcmp(attr.name(), "gcOnIdle")) {
+					extensions->gcOnIdle = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "compactOnIdle")) {
+					extensions->compactOnIdle = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "gcOnIdleDelay")) {
+					extensions->gcOnIdleDelay = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "gcOnIdleReleaseLazily")) {
+					extensions->gcOnIdleReleaseLazily = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+				} else if (0 == strcmp(attr.name(), "heapMapSIMDScanning")) {
+					extensions->heapMapSIMDScanning = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerWorkStealing")) {
+					extensions->scavengerWorkStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetCards")) {
+					extensions->scavengerRememberedSetCards = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerScanOrdering")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "breadthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "dynamicBreadthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST;
+					} else {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+					}
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldDiscovery")) {
+					extensions->scavengerHotFieldDiscovery = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
-				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
+				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit")) || (0 == strcmp(attr.name(), "taskThreadCount"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
 					result = false;
@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "Bits.hpp"
+#include "HeapMapScanKernels.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+/* 4MiB of heap map, which covers a 256MiB heap on 64-bit platforms */
+#define HEAPMAPSCAN_TEST_SLOTS ((uintptr_t)512 * 1024)
+#define HEAPMAPSCAN_TEST_GUARD ((uintptr_t)8)
+#define HEAPMAPSCAN_TEST_GUARD_VALUE ((uintptr_t)0x5A5A5A5A)
+#define HEAPMAPSCAN_BENCHMARK_REPEAT 10
+
+static uintptr_t
+nextRandom(uintptr_t *seed)
+{
+	uintptr_t value = *seed;
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+	*seed = value;
+	return value;
+}
+
+/**
+ * Fill a heap map the way marking leaves it: objects of 2 to 17 slots, one bit per object start, with live
+ * and dead objects clustered in runs whose mean lengths give the requested live fraction.
+ */
+static void
+fillMarkMap(std::vector<uintptr_t> &map, uintptr_t liveObjectPercent, uintptr_t seed)
+{
+	const uintptr_t meanRunObjects = 128;
+	uintptr_t bitCount = map.size() * J9BITS_BITS_IN_SLOT;
+	uintptr_t bitIndex = 0;
+	bool live = (0 == (nextRandom(&seed) % 2));
+	uintptr_t runObjects = 0;
+
+	for (uintptr_t i = 0; i < map.size(); i++) {
+		map[i] = 0;
+	}
+	while (bitIndex < bitCount) {
+		if (0 == runObjects) {
+			live = !live;
+			uintptr_t mean = (live ? liveObjectPercent : (100 - liveObjectPercent)) * meanRunObjects / 100;
+			runObjects = (0 == mean) ? 0 : (1 + (nextRandom(&seed) % (2 * mean)));
+			continue;
+		}
+		if (live) {
+			map[bitIndex / J9BITS_BITS_IN_SLOT] |= (uintptr_t)1 << (bitIndex % J9BITS_BITS_IN_SLOT);
+		}
+		bitIndex += 2 + (nextRandom(&seed) % 16);
+		runObjects -= 1;
+	}
+}
+
+static void
+checkKernelsAgainstScalar(const MM_HeapMapScanKernels *kernels, std::vector<uintptr_t> &map, uintptr_t seed)
+{
+	const MM_HeapMapScanKernels *scalar = MM_HeapMapScanKernels::getKernels(MM_HeapMapScanKernels::LEVEL_SCALAR);
+
+	for (uintptr_t i = 0; i < 256; i++) {
+		uintptr_t baseIndex = nextRandom(&seed) % map.size();
+		uintptr_t topIndex = baseIndex + (nextRandom(&seed) % (map.size() - baseIndex + 1));
+		uintptr_t *base = &map[0] + baseIndex;
+		uintptr_t *top = &map[0] + topIndex;
+
+		EXPECT_EQ(scalar->findNonEmptySlot(base, top), kernels->findNonEmptySlot(base, top)) << kernels->name << " [" << baseIndex << ", " << topIndex << ")";
+		EXPECT_EQ(scalar->findNonFullSlot(base, top), kernels->findNonFullSlot(base, top)) << kernels->name << " [" << baseIndex << ", " << topIndex << ")";
+		EXPECT_EQ(scalar->countBits(base, top), kernels->countBits(base, top)) << kernels->name << " [" << baseIndex << ", " << topIndex << ")";
+	}
+}
+
+static void
+checkClear(const MM_HeapMapScanKernels *kernels, uintptr_t slots, uintptr_t misalignment)
+{
+	std::vector<uintptr_t> map(slots + misalignment + (2 * HEAPMAPSCAN_TEST_GUARD), HEAPMAPSCAN_TEST_GUARD_VALUE);
+	uintptr_t *base = &map[0] + HEAPMAPSCAN_TEST_GUARD + misalignment;
+	uintptr_t *top = base + slots;
+
+	kernels->clearSlots(base, top);
+
+	EXPECT_EQ(top, kernels->findNonEmptySlot(base, top)) << kernels->name << " cleared " << slots;
+	for (uintptr_t *guard = &map[0]; guard < base; guard++) {
+		EXPECT_EQ(HEAPMAPSCAN_TEST_GUARD_VALUE, *guard) << kernels->name << " underrun clearing " << slots;
+	}
+	for (uintptr_t *guard = top; guard < (&map[0] + map.size()); guard++) {
+		EXPECT_EQ(HEAPMAPSCAN_TEST_GUARD_VALUE, *guard) << kernels->name << " overrun clearing " << slots;
+	}
+}
+
+TEST(gcFunctionalTestHeapMapScanKernels, kernelsMatchScalar)
+{
+	MM_HeapMapScanKernels::Level supportedLevel = MM_HeapMapScanKernels::getSupportedLevel(gcTestEnv->getPortLibrary());
+	const uintptr_t densities[] = {0, 1, 10, 50, 90, 100};
+	std::vector<uintptr_t> map(HEAPMAPSCAN_TEST_SLOTS / 8);
+
+	for (uintptr_t level = MM_HeapMapScanKernels::LEVEL_SCALAR; level <= (uintptr_t)supportedLevel; level++) {
+		const MM_HeapMapScanKernels *kernels = MM_HeapMapScanKernels::getKernels((MM_HeapMapScanKernels::Level)level);
+		ASSERT_TRUE(NULL != kernels);
+		gcTestEnv->log(LEVEL_VERBOSE, "Checking heap map scan kernels: %s\n", kernels->name);
+
+		for (uintptr_t i = 0; i < sizeof(densities) / sizeof(densities[0]); i++) {
+			fillMarkMap(map, densities[i], i + 1);
+			checkKernelsAgainstScalar(kernels, map, i + 1);
+		}
+
+		/* full slots only occur for dense small objects; make sure runs of them are found */
+		for (uintptr_t i = 0; i < map.size(); i++) {
+			map[i] = UDATA_MAX;
+		}
+		map[map.size() - 3] = 0;
+		checkKernelsAgainstScalar(kernels, map, 7);
+
+		for (uintptr_t slots = 0; slots < 40; slots++) {
+			checkClear(kernels, slots, slots % 8);
+		}
+		/* large enough to take the streaming path, from an unaligned base */
+		checkClear(kernels, (HEAPMAPSCAN_TEST_SLOTS * 4) + 3, 1);
+	}
+}
+
+/**
+ * Compare the kernels on mark maps of realistic densities. Run with the perfTest filter, for example
+ * omrgctest --gtest_filter="perfTestHeapMapScanKernels*" -logLevel=info
+ */
+TEST(perfTestHeapMapScanKernels, markDensities)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	MM_HeapMapScanKernels::Level supportedLevel = MM_HeapMapScanKernels::getSupportedLevel(gcTestEnv->getPortLibrary());
+	const uintptr_t densities[] = {1, 5, 20, 50, 80, 95};
+	std::vector<uintptr_t> map(HEAPMAPSCAN_TEST_SLOTS);
+	const double megabytes = (double)(HEAPMAPSCAN_TEST_SLOTS * sizeof(uintptr_t)) / (1024.0 * 1024.0);
+
+	gcTestEnv->log(LEVEL_INFO, "%8s %6s %12s %12s %12s %12s\n", "kernels", "live%", "runs(GB/s)", "count(GB/s)", "clear(GB/s)", "empty(GB/s)");
+	for (uintptr_t i = 0; i < sizeof(densities) / sizeof(densities[0]); i++) {
+		fillMarkMap(map, densities[i], i + 1);
+		uintptr_t *base = &map[0];
+		uintptr_t *top = base + map.size();
+		uintptr_t expectedCount = 0;
+
+		for (uintptr_t level = MM_HeapMapScanKernels::LEVEL_SCALAR; level <= (uintptr_t)supportedLevel; level++) {
+			const MM_HeapMapScanKernels *kernels = MM_HeapMapScanKernels::getKernels((MM_HeapMapScanKernels::Level)level);
+
+			/* alternate between runs of empty and non-empty slots, as sweep does */
+			uintptr_t runs = 0;
+			uint64_t runsStart = omrtime_hires_clock();
+			for (uintptr_t repeat = 0; repeat < HEAPMAPSCAN_BENCHMARK_REPEAT; repeat++) {
+				uintptr_t *current = base;
+				while (current < top) {
+					current = kernels->findNonEmptySlot(current, top);
+					while ((current < top) && (0 != *current)) {
+						current += 1;
+					}
+					runs += 1;
+				}
+			}
+			uint64_t runsTime = omrtime_hires_delta(runsStart, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+			uintptr_t count = 0;
+			uint64_t start = omrtime_hires_clock();
+			for (uintptr_t repeat = 0; repeat < HEAPMAPSCAN_BENCHMARK_REPEAT; repeat++) {
+				count = kernels->countBits(base, top);
+			}
+			uint64_t countTime = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+			if (0 == expectedCount) {
+				expectedCount = count;
+			}
+			EXPECT_EQ(expectedCount, count) << kernels->name;
+
+			std::vector<uintptr_t> scratch(map);
+			uintptr_t *scratchBase = &scratch[0];
+			uintptr_t *scratchTop = scratchBase + scratch.size();
+			start = omrtime_hires_clock();
+			for (uintptr_t repeat = 0; repeat < HEAPMAPSCAN_BENCHMARK_REPEAT; repeat++) {
+				kernels->clearSlots(scratchBase, scratchTop);
+			}
+			uint64_t clearTime = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+			/* verify the cleared map is empty, as is done for every region before it is reused */
+			uintptr_t *found = NULL;
+			start = omrtime_hires_clock();
+			for (uintptr_t repeat = 0; repeat < HEAPMAPSCAN_BENCHMARK_REPEAT; repeat++) {
+				found = kernels->findNonEmptySlot(scratchBase, scratchTop);
+			}
+			uint64_t scanTime = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+			EXPECT_EQ(scratchTop, found) << kernels->name;
+
+			double bytes = megabytes * 1024.0 * 1024.0 * HEAPMAPSCAN_BENCHMARK_REPEAT;
+			gcTestEnv->log(LEVEL_INFO, "%8s %6zu %12.2f %12.2f %12.2f %12.2f (%zu runs)\n",
+				kernels->name, densities[i],
+				bytes / (double)OMR_MAX(runsTime, 1),
+				bytes / (double)OMR_MAX(countTime, 1),
+				bytes / (double)OMR_MAX(clearTime, 1),
+				bytes / (double)OMR_MAX(scanTime, 1),
+				runs / HEAPMAPSCAN_BENCHMARK_REPEAT);
+		}
+	}
+}
@@ -0,0 +1,320 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/*
+ * The scavenger copies objects breadth first, so a parent and the child a mutator reaches through it are usually
+ * far apart in survivor space. Depth copying hot fields copies such children next to their parent, and hot field
+ * discovery finds the hot fields the object model does not supply. This benchmark builds a list whose nodes also
+ * refer to cold leaves, scavenges it with scavengerHotFieldDiscovery off and on, and after every scavenge measures
+ * how often walking the list through its hot field leaves the current cache line, and how long the walk takes.
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ObjectModel.hpp"
+#include "omrgc.h"
+#include "SlotObject.hpp"
+#include "StandardWriteBarrier.hpp"
+#include "StartupManagerTestExample.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#define HOTFIELD_BENCHMARK_CONFIG "fvtest/gctest/configuration/scavenger_hotfields_GC_config.xml"
+#define HOTFIELD_BENCHMARK_LIST_NODES ((uintptr_t)8 * 1024)
+/* list nodes and leaves have different sizes, which the example object model uses as their class */
+#define HOTFIELD_BENCHMARK_NODE_FIELDS 4
+#define HOTFIELD_BENCHMARK_LEAF_FIELDS 2
+#define HOTFIELD_BENCHMARK_TWIG_FIELDS 1
+#define HOTFIELD_BENCHMARK_GARBAGE_FIELDS 30
+/* not the first field, which the scavenger depth copies when it knows no hot field of a class */
+#define HOTFIELD_BENCHMARK_HOT_FIELD 2
+#define HOTFIELD_BENCHMARK_CACHE_LINE 64
+#define HOTFIELD_BENCHMARK_SCAVENGES 4
+#define HOTFIELD_BENCHMARK_REPEAT 100
+
+/**
+ * Starts the heap of the hot fields configuration, with hot field discovery forced on or off.
+ */
+class HotFieldStartupManager : public MM_StartupManagerTestExample
+{
+private:
+	bool _discovery;
+
+protected:
+	virtual bool
+	parseLanguageOptions(MM_GCExtensionsBase *extensions)
+	{
+		bool result = MM_StartupManagerTestExample::parseLanguageOptions(extensions);
+		extensions->scavengerHotFieldDiscovery = _discovery;
+		return result;
+	}
+
+public:
+	HotFieldStartupManager(OMR_VM *omrVM, bool discovery)
+		: MM_StartupManagerTestExample(omrVM, HOTFIELD_BENCHMARK_CONFIG)
+		, _discovery(discovery)
+	{
+	}
+};
+
+/**
+ * A list built by the test thread in the heap, rooted in the root table of the example VM: the head, and the tail
+ * while the list grows.
+ */
+class HotFieldList
+{
+private:
+	OMR_VMThread *_omrVMThread;
+	MM_EnvironmentBase *_env;
+	MM_GCExtensionsBase *_extensions;
+	RootEntry *_head;
+	RootEntry *_tail;
+
+	MMINLINE static uintptr_t
+	sizeInBytes(uintptr_t fieldCount)
+	{
+		/* objects are laid out as in GCConfigTest: a header followed by reference fields */
+		return sizeof(omrobjectptr_t) + (fieldCount * sizeof(fomrobject_t));
+	}
+
+	MMINLINE static fomrobject_t *
+	field(omrobjectptr_t objectPtr, uintptr_t index)
+	{
+		return (fomrobject_t *)objectPtr + 1 + index;
+	}
+
+	omrobjectptr_t
+	allocate(uintptr_t fieldCount)
+	{
+		uint8_t allocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *allocationModel = new(allocationModelSpace)
+				MM_ObjectAllocationModel(_env, sizeInBytes(fieldCount), MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+		return OMR_GC_AllocateObject(_omrVMThread, allocationModel);
+	}
+
+public:
+	/**
+	 * Add the roots of the list to the root table.
+	 * @return true if the roots were added
+	 */
+	bool
+	initialize(J9HashTable *rootTable)
+	{
+		RootEntry rootEntry;
+		rootEntry.rootPtr = NULL;
+		rootEntry.name = "hotFieldListHead";
+		_head = (RootEntry *)hashTableAdd(rootTable, &rootEntry);
+		rootEntry.name = "hotFieldListTail";
+		_tail = (RootEntry *)hashTableAdd(rootTable, &rootEntry);
+		return (NULL != _head) && (NULL != _tail);
+	}
+
+	omrobjectptr_t
+	getHead()
+	{
+		return _head->rootPtr;
+	}
+
+	omrobjectptr_t
+	getNext(omrobjectptr_t node)
+	{
+		GC_SlotObject slotObject(_env->getOmrVM(), field(node, HOTFIELD_BENCHMARK_HOT_FIELD));
+		return slotObject.readReferenceFromSlot();
+	}
+
+	/**
+	 * Build the list. Every node refers to the next one through its hot field, and to a cold leaf through about
+	 * half of its other fields. Leaves refer to twigs, so that the breadth first copy order puts a node and the
+	 * next one more than a cache line apart.
+	 * @return true if every object was allocated
+	 */
+	bool
+	build(uintptr_t nodeCount)
+	{
+		uintptr_t seed = 1;
+		for (uintptr_t i = 0; i < nodeCount; i++) {
+			omrobjectptr_t node = allocate(HOTFIELD_BENCHMARK_NODE_FIELDS);
+			if (NULL == node) {
+				return false;
+			}
+			/* the allocation may have moved the tail, so it is read from its root */
+			if (NULL == _head->rootPtr) {
+				_head->rootPtr = node;
+			} else {
+				standardWriteBarrierStore(_omrVMThread, _tail->rootPtr, field(_tail->rootPtr, HOTFIELD_BENCHMARK_HOT_FIELD), node);
+			}
+			_tail->rootPtr = node;
+			for (uintptr_t index = 0; index < HOTFIELD_BENCHMARK_NODE_FIELDS; index++) {
+				seed = (seed * 1103515245) + 12345;
+				if ((HOTFIELD_BENCHMARK_HOT_FIELD != index) && (0 != ((seed >> 16) & 1))) {
+					omrobjectptr_t leaf = allocate(HOTFIELD_BENCHMARK_LEAF_FIELDS);
+					if (NULL == leaf) {
+						return false;
+					}
+					standardWriteBarrierStore(_omrVMThread, _tail->rootPtr, field(_tail->rootPtr, index), leaf);
+					for (uintptr_t leafIndex = 0; leafIndex < HOTFIELD_BENCHMARK_LEAF_FIELDS; leafIndex++) {
+						omrobjectptr_t twig = allocate(HOTFIELD_BENCHMARK_TWIG_FIELDS);
+						if (NULL == twig) {
+							return false;
+						}
+						GC_SlotObject leafSlot(_env->getOmrVM(), field(_tail->rootPtr, index));
+						leaf = leafSlot.readReferenceFromSlot();
+						standardWriteBarrierStore(_omrVMThread, leaf, field(leaf, leafIndex), twig);
+					}
+				}
+			}
+		}
+		_tail->rootPtr = NULL;
+		return true;
+	}
+
+	/**
+	 * Allocate garbage until the next scavenge completes.
+	 * @return true if a scavenge completed
+	 */
+	bool
+	scavenge()
+	{
+		uintptr_t gcCount = _extensions->scavengerStats._gcCount;
+		while (gcCount == _extensions->scavengerStats._gcCount) {
+			if (NULL == allocate(HOTFIELD_BENCHMARK_GARBAGE_FIELDS)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	explicit HotFieldList(OMR_VMThread *omrVMThread)
+		: _omrVMThread(omrVMThread)
+		, _env(MM_EnvironmentBase::getEnvironment(omrVMThread))
+		, _extensions(_env->getExtensions())
+		, _head(NULL)
+		, _tail(NULL)
+	{
+	}
+};
+
+/**
+ * Scavenge the list with hot field discovery off or on, and log the list walks after every scavenge.
+ */
+static void
+scavengeList(bool discovery)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	OMR_VM_Example *exampleVM = &gcTestEnv->exampleVM;
+	HotFieldStartupManager startupManager(exampleVM->_omrVM, discovery);
+
+	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "HotFieldCopyOrderThread");
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_Thread_Init failed, rc=" << rc;
+	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+	exampleVM->rootTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+	exampleVM->objectTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+	ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	HotFieldList list(exampleVM->_omrVMThread);
+	ASSERT_TRUE(list.initialize(exampleVM->rootTable));
+
+	/* the test thread is a mutator, so it holds VM access while it touches the heap */
+	env->acquireVMAccess();
+	EXPECT_TRUE(list.build(HOTFIELD_BENCHMARK_LIST_NODES));
+	for (uintptr_t scavenge = 1; scavenge <= HOTFIELD_BENCHMARK_SCAVENGES; scavenge++) {
+		if (!list.scavenge()) {
+			ADD_FAILURE() << "Failed to allocate garbage";
+			break;
+		}
+
+		/* a hop is far unless the next node starts within a cache line after the end of the current one */
+		uintptr_t farHops = 0;
+		uintptr_t walked = 0;
+		for (omrobjectptr_t node = list.getHead(); NULL != node; node = list.getNext(node)) {
+			omrobjectptr_t next = list.getNext(node);
+			uintptr_t nodeEnd = (uintptr_t)node + extensions->objectModel.getConsumedSizeInBytesWithHeader(node);
+			if ((NULL != next) && (((uintptr_t)next - nodeEnd) >= HOTFIELD_BENCHMARK_CACHE_LINE)) {
+				farHops += 1;
+			}
+			walked += 1;
+		}
+		EXPECT_EQ(HOTFIELD_BENCHMARK_LIST_NODES, walked);
+
+		uintptr_t sum = 0;
+		uint64_t start = omrtime_hires_clock();
+		for (uintptr_t repeat = 0; repeat < HOTFIELD_BENCHMARK_REPEAT; repeat++) {
+			for (omrobjectptr_t node = list.getHead(); NULL != node; node = list.getNext(node)) {
+				sum += (uintptr_t)node->header.raw();
+			}
+		}
+		uint64_t walkTime = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		EXPECT_NE((uintptr_t)0, sum);
+
+		gcTestEnv->log(LEVEL_INFO, "%10s %9zu %14.1f %14.3f %11zu\n", discovery ? "on" : "off", scavenge,
+			(100.0 * (double)farHops) / (double)(walked - 1),
+			(double)walkTime / (double)(walked * HOTFIELD_BENCHMARK_REPEAT),
+			extensions->scavengerStats._hotFieldHotClasses);
+	}
+	if (discovery) {
+		/* both list nodes and leaves are sampled, and list nodes have a hot field */
+		EXPECT_LE((uintptr_t)1, extensions->scavengerStats._hotFieldHotClasses);
+	}
+	env->releaseVMAccess();
+
+	hashTableFree(exampleVM->rootTable);
+	exampleVM->rootTable = NULL;
+	hashTableFree(exampleVM->objectTable);
+	exampleVM->objectTable = NULL;
+	rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+	rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_Thread_Free failed, rc=" << rc;
+	exampleVM->_omrVMThread = NULL;
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+}
+
+/**
+ * Compare list walks after real scavenges without and with hot field discovery. Run with the perfTest filter, for
+ * example omrgctest --gtest_filter="perfTestHotFieldCopyOrder*" -logLevel=info
+ */
+TEST(perfTestHotFieldCopyOrder, listWalk)
+{
+	gcTestEnv->log(LEVEL_INFO, "%10s %9s %14s %14s %11s\n", "discovery", "scavenge", "far hops(%)", "walk(ns/node)", "hot classes");
+	scavengeList(false);
+	scavengeList(true);
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,385 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+
+/*
+ * Snapshot at the beginning marking has every mutator log the references it overwrites into a barrier packet, and
+ * hand the packet over to the collector when it fills: the barrier slow path. This benchmark runs that slow path on
+ * the work packets of a started heap, with 1 to 128 attached mutator threads and a collector draining the handed
+ * over packets continuously. It compares handing packets over on a packet list under its sublist locks, on a
+ * lock-free packet list, and through MM_WorkPacketsSATB, for a few fill levels.
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "omrgc.h"
+#include "Packet.hpp"
+#include "PacketList.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "WorkPacketsSATB.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#if defined(OMR_GC_REALTIME) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#define SATB_BENCHMARK_CONFIG "fvtest/gctest/configuration/global_GC_config.xml"
+#define SATB_BENCHMARK_RECORDS ((uintptr_t)128 * 1024)
+#define SATB_BENCHMARK_MAX_THREADS 128
+#define SATB_BENCHMARK_PACKETS_PER_THREAD 4
+
+typedef enum SATBHandOff {
+	SATB_HANDOFF_LOCKED_LIST = 0, /**< push on a packet list under its sublist locks, popList() to drain */
+	SATB_HANDOFF_LOCKFREE_LIST, /**< push on a lock-free packet list, popList() to drain */
+	SATB_HANDOFF_WORKPACKETS, /**< MM_WorkPacketsSATB::putFullPacket(), drainFilledBarrierPackets() to drain */
+	SATB_HANDOFF_COUNT
+} SATBHandOff;
+
+typedef struct SATBQueue {
+	SATBHandOff handOff;
+	MM_WorkPacketsSATB *workPackets; /**< supplies the barrier packets for every hand off */
+	MM_PacketList *packetList; /**< the list packets are handed over on, for the list hand offs */
+	uintptr_t capacity; /**< records logged in a packet before it is handed over */
+	volatile uintptr_t start; /**< non-zero once all mutators are attached */
+	volatile uintptr_t mutatorsReady; /**< mutators which have attached, or failed to */
+	volatile uintptr_t mutatorsRunning; /**< mutators which have not handed over their last packet yet */
+	volatile uintptr_t mutatorsDetached; /**< mutators which are done with the VM */
+	volatile uintptr_t failures; /**< mutators which could not attach or get a barrier packet */
+	uintptr_t drained; /**< records drained by the collector */
+	uintptr_t checksum; /**< sum of the records drained by the collector */
+} SATBQueue;
+
+typedef struct SATBMutator {
+	SATBQueue *queue;
+	uintptr_t index; /**< distinguishes the records of this mutator */
+	uintptr_t handedOver; /**< packets handed over to the collector, private */
+	volatile uintptr_t returned; /**< packets the collector has drained and put back on the empty packet list */
+	uintptr_t stalls; /**< slow paths which had to wait for the collector to return a packet */
+} SATBMutator;
+
+/**
+ * Take an empty barrier packet, waiting for the collector to return one if the mutator has too many handed over.
+ * Mutators hold at most SATB_BENCHMARK_PACKETS_PER_THREAD packets each, so the work packets never overflow: the
+ * records are not objects.
+ */
+static MM_Packet *
+takePacket(MM_EnvironmentBase *env, SATBMutator *mutator)
+{
+	if (SATB_BENCHMARK_PACKETS_PER_THREAD <= (mutator->handedOver - mutator->returned)) {
+		mutator->stalls += 1;
+		do {
+			omrthread_yield();
+		} while (SATB_BENCHMARK_PACKETS_PER_THREAD <= (mutator->handedOver - mutator->returned));
+	}
+	return mutator->queue->workPackets->getBarrierPacket(env);
+}
+
+/**
+ * The barrier slow path: hand a packet over to the collector.
+ */
+static void
+handOverPacket(MM_EnvironmentBase *env, SATBMutator *mutator, MM_Packet *packet)
+{
+	SATBQueue *queue = mutator->queue;
+	mutator->handedOver += 1;
+	if (SATB_HANDOFF_WORKPACKETS == queue->handOff) {
+		queue->workPackets->putFullPacket(env, packet);
+	} else {
+		queue->packetList->push(env, packet);
+	}
+}
+
+static int J9THREAD_PROC
+satbMutator(void *arg)
+{
+	SATBMutator *mutator = (SATBMutator *)arg;
+	SATBQueue *queue = mutator->queue;
+	uintptr_t base = mutator->index * SATB_BENCHMARK_RECORDS;
+	OMR_VMThread *omrVMThread = NULL;
+
+	if (OMR_ERROR_NONE != OMR_Thread_Init(gcTestEnv->exampleVM._omrVM, NULL, &omrVMThread, "SATBBarrierQueueMutator")) {
+		MM_AtomicOperations::add(&queue->failures, 1);
+		MM_AtomicOperations::add(&queue->mutatorsReady, 1);
+		MM_AtomicOperations::subtract(&queue->mutatorsRunning, 1);
+		MM_AtomicOperations::add(&queue->mutatorsDetached, 1);
+		return 0;
+	}
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_AtomicOperations::add(&queue->mutatorsReady, 1);
+
+	while (0 == queue->start) {
+		omrthread_yield();
+	}
+
+	MM_Packet *packet = takePacket(env, mutator);
+	uintptr_t count = 0;
+	for (uintptr_t i = 1; (NULL != packet) && (i <= SATB_BENCHMARK_RECORDS); i++) {
+		if (queue->capacity == count) {
+			handOverPacket(env, mutator, packet);
+			packet = takePacket(env, mutator);
+			count = 0;
+			if (NULL == packet) {
+				break;
+			}
+		}
+		packet->push(env, (void *)(base + i));
+		count += 1;
+	}
+	if (NULL == packet) {
+		MM_AtomicOperations::add(&queue->failures, 1);
+	} else {
+		handOverPacket(env, mutator, packet);
+	}
+	MM_AtomicOperations::subtract(&queue->mutatorsRunning, 1);
+
+	OMR_Thread_Free(omrVMThread);
+	MM_AtomicOperations::add(&queue->mutatorsDetached, 1);
+	return 0;
+}
+
+/**
+ * Trace the records of a handed over packet, and return it to the empty packet list and to its owner.
+ */
+static void
+drainPacket(MM_EnvironmentBase *env, SATBQueue *queue, std::vector<SATBMutator> &mutators, MM_Packet *packet)
+{
+	uintptr_t owner = 0;
+	void *record = NULL;
+	while (NULL != (record = packet->pop(env))) {
+		owner = ((uintptr_t)record - 1) / SATB_BENCHMARK_RECORDS;
+		queue->checksum += (uintptr_t)record;
+		queue->drained += 1;
+	}
+	queue->workPackets->putPacket(env, packet);
+	MM_AtomicOperations::add(&mutators[owner].returned, 1);
+}
+
+/**
+ * Drain the packets handed over so far.
+ *
+ * @return true if any packet was drained
+ */
+static bool
+drainPackets(MM_EnvironmentBase *env, SATBQueue *queue, std::vector<SATBMutator> &mutators)
+{
+	bool drained = false;
+
+	if (SATB_HANDOFF_WORKPACKETS == queue->handOff) {
+		queue->workPackets->drainFilledBarrierPackets(env);
+		MM_Packet *packet = NULL;
+		while (NULL != (packet = queue->workPackets->getInputPacketNoWait(env))) {
+			drainPacket(env, queue, mutators, packet);
+			drained = true;
+		}
+	} else {
+		MM_Packet *head = NULL;
+		MM_Packet *tail = NULL;
+		uintptr_t count = 0;
+		if (queue->packetList->popList(&head, &tail, &count)) {
+			for (uintptr_t i = 0; i < count; i++) {
+				MM_Packet *next = head->_next;
+				drainPacket(env, queue, mutators, head);
+				head = next;
+			}
+			drained = true;
+		}
+	}
+
+	return drained;
+}
+
+/**
+ * Run the mutators against a collector draining on the calling thread.
+ *
+ * @return the elapsed time in nanoseconds, or 0 if a mutator could not be started
+ */
+static uint64_t
+runMutators(MM_EnvironmentBase *env, SATBQueue *queue, std::vector<SATBMutator> &mutators)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	uintptr_t threads = mutators.size();
+	bool started = true;
+
+	queue->start = 0;
+	queue->mutatorsReady = 0;
+	queue->mutatorsRunning = threads;
+	queue->mutatorsDetached = 0;
+	queue->failures = 0;
+	queue->drained = 0;
+	queue->checksum = 0;
+	for (uintptr_t i = 0; i < threads; i++) {
+		SATBMutator *mutator = &mutators[i];
+		mutator->queue = queue;
+		mutator->index = i;
+		mutator->handedOver = 0;
+		mutator->returned = 0;
+		mutator->stalls = 0;
+	}
+
+	for (uintptr_t i = 0; i < threads; i++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, 0, satbMutator, &mutators[i])) {
+			/* let the mutators already created run to completion before failing */
+			MM_AtomicOperations::subtract(&queue->mutatorsRunning, threads - i);
+			threads = i;
+			started = false;
+			break;
+		}
+	}
+	while (threads != queue->mutatorsReady) {
+		omrthread_yield();
+	}
+
+	uint64_t start = omrtime_hires_clock();
+	MM_AtomicOperations::set(&queue->start, 1);
+	while (true) {
+		/* read before draining: once no mutator is running, every packet has been handed over */
+		uintptr_t running = queue->mutatorsRunning;
+		if (!drainPackets(env, queue, mutators)) {
+			if (0 == running) {
+				break;
+			}
+			omrthread_yield();
+		}
+	}
+	uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+	/* the heap must outlive the mutators attached to it */
+	while (threads != queue->mutatorsDetached) {
+		omrthread_yield();
+	}
+
+	return (started && (0 == queue->failures)) ? OMR_MAX(elapsed, 1) : 0;
+}
+
+static uintptr_t
+expectedChecksum(uintptr_t threads)
+{
+	uintptr_t records = threads * SATB_BENCHMARK_RECORDS;
+	return (records * (records + 1)) / 2;
+}
+
+/**
+ * Start a heap, and hand packets over from minThreads to maxThreads mutators filling them with each of the given
+ * record counts, checking that the collector drains every record. Log the throughput of every hand off.
+ */
+static void
+measureHandOffs(const uintptr_t *capacities, uintptr_t capacityCount, uintptr_t minThreads, uintptr_t maxThreads)
+{
+	OMR_VM_Example *exampleVM = &gcTestEnv->exampleVM;
+	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, SATB_BENCHMARK_CONFIG);
+
+	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "SATBBarrierQueueCollector");
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_Thread_Init failed, rc=" << rc;
+	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* the count is rounded down to whole packet blocks, so ask for the packets of one more mutator than can run */
+	extensions->workpacketCount = (SATB_BENCHMARK_MAX_THREADS + 1) * SATB_BENCHMARK_PACKETS_PER_THREAD;
+	MM_WorkPacketsSATB *workPackets = MM_WorkPacketsSATB::newInstance(env);
+	extensions->workpacketCount = 0;
+	MM_PacketList lockedList(env);
+	MM_PacketList lockFreeList(env);
+	ASSERT_TRUE((NULL != workPackets) && lockedList.initialize(env, false) && lockFreeList.initialize(env, true));
+
+	SATBQueue queue;
+	queue.workPackets = workPackets;
+	for (uintptr_t c = 0; c < capacityCount; c++) {
+		queue.capacity = capacities[c];
+		for (uintptr_t threads = minThreads; threads <= maxThreads; threads *= 2) {
+			double throughput[SATB_HANDOFF_COUNT];
+			uintptr_t stalls[SATB_HANDOFF_COUNT];
+			for (uintptr_t handOff = 0; handOff < SATB_HANDOFF_COUNT; handOff++) {
+				queue.handOff = (SATBHandOff)handOff;
+				queue.packetList = (SATB_HANDOFF_LOCKED_LIST == handOff) ? &lockedList : &lockFreeList;
+				std::vector<SATBMutator> mutators(threads);
+				uint64_t elapsed = runMutators(env, &queue, mutators);
+				EXPECT_NE((uint64_t)0, elapsed);
+				EXPECT_EQ(threads * SATB_BENCHMARK_RECORDS, queue.drained);
+				EXPECT_EQ(expectedChecksum(threads), queue.checksum);
+				EXPECT_FALSE(workPackets->getOverflowFlag());
+				throughput[handOff] = ((double)(threads * SATB_BENCHMARK_RECORDS) * 1000.0) / (double)OMR_MAX(elapsed, 1);
+				stalls[handOff] = 0;
+				for (uintptr_t i = 0; i < threads; i++) {
+					stalls[handOff] += mutators[i].stalls;
+				}
+			}
+			gcTestEnv->log(LEVEL_INFO, "%8zu %8zu %16.2f %16.2f %16.2f %10zu %10zu %10zu\n", capacities[c], threads,
+				throughput[SATB_HANDOFF_LOCKED_LIST], throughput[SATB_HANDOFF_LOCKFREE_LIST], throughput[SATB_HANDOFF_WORKPACKETS],
+				stalls[SATB_HANDOFF_LOCKED_LIST], stalls[SATB_HANDOFF_LOCKFREE_LIST], stalls[SATB_HANDOFF_WORKPACKETS]);
+		}
+	}
+
+	lockFreeList.tearDown(env);
+	lockedList.tearDown(env);
+	workPackets->kill(env);
+
+	rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+	rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "OMR_Thread_Free failed, rc=" << rc;
+	exampleVM->_omrVMThread = NULL;
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+}
+
+static void
+logHeader()
+{
+	gcTestEnv->log(LEVEL_INFO, "%8s %8s %16s %16s %16s %10s %10s %10s\n", "slots", "threads",
+		"locked(Mrec/s)", "lockfree(Mrec/s)", "satb(Mrec/s)", "lock stall", "free stall", "satb stall");
+}
+
+TEST(gcFunctionalTestSATBBarrierQueue, noRecordLost)
+{
+	/* packets handed over nearly empty, so mutators keep waiting for the collector to return them */
+	const uintptr_t capacities[] = {16};
+	logHeader();
+	measureHandOffs(capacities, sizeof(capacities) / sizeof(capacities[0]), 8, 8);
+}
+
+/**
+ * Measure the throughput of the barrier, slow path included, from 1 to 128 mutators. Run with the perfTest filter,
+ * for example omrgctest --gtest_filter="perfTestSATBBarrierQueue*" -logLevel=info
+ */
+TEST(perfTestSATBBarrierQueue, slowPathThroughput)
+{
+	/* a work packet holds 512 records */
+	const uintptr_t capacities[] = {64, 256, 512};
+	logHeader();
+	measureHandOffs(capacities, sizeof(capacities) / sizeof(capacities[0]), 1, SATB_BENCHMARK_MAX_THREADS);
+}
+
+#endif /* defined(OMR_GC_REALTIME) && defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,285 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * The destination computation and the sub area dependency wait of the sliding compaction, on a simulated
+ * region: a word array holding objects whose every word is the object number, split into sub areas. They do
+ * not need a heap or a collector, so they run in the default build where compaction itself is compiled out.
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "SlidingCompaction.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#include <string.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define SLIDING_TEST_REGION_WORDS ((uintptr_t)64 * 1024)
+#define SLIDING_TEST_DEAD_WORD ((uintptr_t)0)
+#define SLIDING_TEST_MAX_THREADS 8
+
+/**
+ * A sub area table entry with the fields MM_SlidingCompaction uses, and the states it relies on.
+ */
+struct SlidingTestSubArea {
+	omrobjectptr_t firstObject;
+	uintptr_t liveBytes;
+	omrobjectptr_t destination;
+	volatile uintptr_t state;
+
+	enum State {
+		init = 0,
+		full,
+		end_segment
+	};
+};
+
+/**
+ * A simulated region: objects of 1 to 32 words, every word of a live object holding its (non zero) object
+ * number and every word of a dead object holding SLIDING_TEST_DEAD_WORD. Sub areas start on object boundaries.
+ */
+struct SlidingTestRegion {
+	std::vector<uintptr_t> words;
+	std::vector<uintptr_t> objectStarts; /**< word index of every object, in address order */
+	std::vector<uintptr_t> objectSizes; /**< size in words of every object */
+	std::vector<bool> objectLive;
+	std::vector<SlidingTestSubArea> subAreas;
+	std::vector<uintptr_t> subAreaFirstObject; /**< index of the first object of every sub area */
+	volatile uintptr_t nextSubArea; /**< next sub area to claim, in ascending order */
+	volatile uintptr_t threadsRunning;
+	volatile uintptr_t failures; /**< objects found overwritten before they were moved, or sub areas which moved the wrong amount */
+};
+
+static uintptr_t
+nextRandom(uintptr_t *seed)
+{
+	uintptr_t value = *seed;
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+	*seed = value;
+	return value;
+}
+
+static omrobjectptr_t
+wordAddress(SlidingTestRegion *region, uintptr_t index)
+{
+	return (omrobjectptr_t)(&region->words[0] + index);
+}
+
+/**
+ * Fill the region with objects, liveObjectPercent of them live, and split it into sub areas of about
+ * subAreaWords words each.
+ */
+static void
+fillRegion(SlidingTestRegion *region, uintptr_t liveObjectPercent, uintptr_t subAreaWords, uintptr_t seed)
+{
+	region->words.assign(SLIDING_TEST_REGION_WORDS, SLIDING_TEST_DEAD_WORD);
+	region->objectStarts.clear();
+	region->objectSizes.clear();
+	region->objectLive.clear();
+	region->subAreas.clear();
+	region->subAreaFirstObject.clear();
+
+	uintptr_t index = 0;
+	uintptr_t subAreaEnd = 0;
+	while (index < SLIDING_TEST_REGION_WORDS) {
+		uintptr_t size = 1 + (nextRandom(&seed) % 32);
+		size = OMR_MIN(size, SLIDING_TEST_REGION_WORDS - index);
+		bool live = (nextRandom(&seed) % 100) < liveObjectPercent;
+		uintptr_t objectNumber = region->objectStarts.size() + 1;
+
+		if (index >= subAreaEnd) {
+			SlidingTestSubArea subArea = {wordAddress(region, index), 0, NULL, SlidingTestSubArea::init};
+			region->subAreas.push_back(subArea);
+			region->subAreaFirstObject.push_back(region->objectStarts.size());
+			subAreaEnd = index + 1 + (nextRandom(&seed) % (2 * subAreaWords));
+		}
+		for (uintptr_t i = 0; i < size; i++) {
+			region->words[index + i] = live ? objectNumber : SLIDING_TEST_DEAD_WORD;
+		}
+		if (live) {
+			region->subAreas.back().liveBytes += size * sizeof(uintptr_t);
+		}
+		region->objectStarts.push_back(index);
+		region->objectSizes.push_back(size);
+		region->objectLive.push_back(live);
+		index += size;
+	}
+
+	SlidingTestSubArea end = {wordAddress(region, SLIDING_TEST_REGION_WORDS), 0, NULL, SlidingTestSubArea::end_segment};
+	region->subAreas.push_back(end);
+	region->subAreaFirstObject.push_back(region->objectStarts.size());
+	region->nextSubArea = 0;
+	region->failures = 0;
+}
+
+/**
+ * Slide the live objects of a sub area, the way MM_CompactScheme::slideSubArea() does once it may proceed.
+ */
+static void
+slideSubArea(SlidingTestRegion *region, intptr_t i)
+{
+	MM_SlidingCompaction::waitForOverlappedSubAreas(&region->subAreas[0], i);
+
+	uintptr_t *destination = (uintptr_t *)region->subAreas[i].destination;
+	for (uintptr_t object = region->subAreaFirstObject[i]; object < region->subAreaFirstObject[i + 1]; object++) {
+		if (region->objectLive[object]) {
+			uintptr_t *source = &region->words[0] + region->objectStarts[object];
+			uintptr_t size = region->objectSizes[object];
+			/* every word of a live object must still be intact when it is moved */
+			for (uintptr_t word = 0; word < size; word++) {
+				if ((object + 1) != source[word]) {
+					MM_AtomicOperations::add(&region->failures, 1);
+					break;
+				}
+			}
+			memmove(destination, source, size * sizeof(uintptr_t));
+			destination += size;
+		}
+	}
+	if ((uintptr_t *)region->subAreas[i + 1].destination != destination) {
+		MM_AtomicOperations::add(&region->failures, 1);
+	}
+
+	/* the moved objects must be visible before waiting sub areas proceed */
+	MM_AtomicOperations::storeSync();
+	region->subAreas[i].state = SlidingTestSubArea::full;
+}
+
+static int J9THREAD_PROC
+slidingThread(void *arg)
+{
+	SlidingTestRegion *region = (SlidingTestRegion *)arg;
+	uintptr_t subAreaCount = region->subAreas.size() - 1;
+
+	while (true) {
+		uintptr_t i = MM_AtomicOperations::add(&region->nextSubArea, 1) - 1;
+		if (i >= subAreaCount) {
+			break;
+		}
+		slideSubArea(region, (intptr_t)i);
+	}
+	MM_AtomicOperations::subtract(&region->threadsRunning, 1);
+	return 0;
+}
+
+/**
+ * Check that the live objects of the region are packed at its base, in their original order.
+ */
+static void
+checkSlidRegion(SlidingTestRegion *region)
+{
+	uintptr_t index = 0;
+	for (uintptr_t object = 0; object < region->objectStarts.size(); object++) {
+		if (region->objectLive[object]) {
+			for (uintptr_t word = 0; word < region->objectSizes[object]; word++) {
+				ASSERT_EQ(object + 1, region->words[index + word]) << "object " << object << " at word " << index;
+			}
+			index += region->objectSizes[object];
+		}
+	}
+	ASSERT_EQ(wordAddress(region, index), region->subAreas.back().destination);
+}
+
+TEST(gcFunctionalTestSlidingCompaction, destinationsArePrefixSums)
+{
+	SlidingTestRegion region;
+	const uintptr_t densities[] = {0, 10, 50, 90, 100};
+
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		fillRegion(&region, densities[d], 512, d + 1);
+		SlidingTestSubArea *subAreas = &region.subAreas[0];
+		intptr_t end = MM_SlidingCompaction::computeDestinations(subAreas, (uintptr_t)wordAddress(&region, 0));
+
+		ASSERT_EQ((intptr_t)region.subAreas.size() - 1, end);
+		uintptr_t liveBytes = 0;
+		for (intptr_t i = 0; i <= end; i++) {
+			EXPECT_EQ((uintptr_t)wordAddress(&region, 0) + liveBytes, (uintptr_t)subAreas[i].destination) << "sub area " << i;
+			/* a sub area never slides up */
+			EXPECT_LE((uintptr_t)subAreas[i].destination, (uintptr_t)subAreas[i].firstObject) << "sub area " << i;
+			liveBytes += subAreas[i].liveBytes;
+		}
+	}
+}
+
+TEST(gcFunctionalTestSlidingCompaction, waitsForExactlyTheOverlappedSubAreas)
+{
+	SlidingTestRegion region;
+	const uintptr_t densities[] = {0, 10, 50, 90, 100};
+
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		fillRegion(&region, densities[d], 64, d + 1);
+		SlidingTestSubArea *subAreas = &region.subAreas[0];
+		intptr_t end = MM_SlidingCompaction::computeDestinations(subAreas, (uintptr_t)wordAddress(&region, 0));
+
+		for (intptr_t i = 0; i < end; i++) {
+			intptr_t lowest = MM_SlidingCompaction::getLowestOverlappedSubArea(subAreas, i);
+			ASSERT_LE(lowest, i);
+			/* sub area j holds words up to the first object of sub area j + 1 */
+			for (intptr_t j = 0; j < i; j++) {
+				bool overlapped = (uintptr_t)subAreas[j + 1].firstObject > (uintptr_t)subAreas[i].destination;
+				EXPECT_EQ(overlapped, j >= lowest) << "sub area " << i << " and sub area " << j;
+			}
+		}
+	}
+}
+
+TEST(gcFunctionalTestSlidingCompaction, parallelSlideKeepsObjectOrder)
+{
+	SlidingTestRegion region;
+	const uintptr_t densities[] = {10, 50, 90, 100};
+
+	for (uintptr_t threads = 1; threads <= SLIDING_TEST_MAX_THREADS; threads *= 2) {
+		for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+			fillRegion(&region, densities[d], 256, (threads * 16) + d + 1);
+			MM_SlidingCompaction::computeDestinations(&region.subAreas[0], (uintptr_t)wordAddress(&region, 0));
+
+			bool started = true;
+			region.threadsRunning = threads;
+			for (uintptr_t t = 0; t < threads; t++) {
+				omrthread_t thread = NULL;
+				if (0 != omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, 0, slidingThread, &region)) {
+					/* the threads already created claim every sub area, so let them finish */
+					MM_AtomicOperations::subtract(&region.threadsRunning, threads - t);
+					started = (0 != t);
+					break;
+				}
+			}
+			while (0 != region.threadsRunning) {
+				omrthread_yield();
+			}
+			ASSERT_TRUE(started) << "could not start a sliding thread";
+			EXPECT_EQ((uintptr_t)0, region.failures) << threads << " threads at " << densities[d] << "% live";
+
+			gcTestEnv->log(LEVEL_VERBOSE, "Slid %zu sub areas with %zu threads at %zu%% live\n", region.subAreas.size() - 1, threads, densities[d]);
+			checkSlidRegion(&region);
+		}
+	}
+}
@@ -0,0 +1,366 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * The binary verbose GC writer encodes the XML stanzas into a dictionary coded record stream. These tests check that
+ * decoding gives back the XML the encoder was fed, that encoding a line from its format and arguments gives the same
+ * stream as encoding its text, and compare the size and the encoding and decoding time of the binary stream with
+ * loading the XML.
+ */
+
+#include "omrport.h"
+
+#include "VerboseBinaryDecoder.hpp"
+#include "VerboseBinaryEncoder.hpp"
+
+#include "gcTestHelpers.hpp"
+#include "pugixml.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include <gtest/gtest.h>
+
+/**
+ * Rebuild the XML from the decoded stream, one element or text per line and indented two spaces per level
+ * below the root, as the verbose handlers write it.
+ */
+class XMLRebuilder : public MM_VerboseBinaryDecoder::Listener
+{
+public:
+	std::string xml;
+
+	virtual void
+	startElement(const char *name, uintptr_t depth, const MM_VerboseBinaryDecoder::Attribute *attributes, uintptr_t attributeCount, bool isEmpty)
+	{
+		indent(depth);
+		xml += "<";
+		xml += name;
+		for (uintptr_t i = 0; i < attributeCount; i++) {
+			xml += " ";
+			xml += attributes[i].name;
+			xml += "=\"";
+			xml += attributes[i].value;
+			xml += "\"";
+		}
+		xml += isEmpty ? " />\n" : ">\n";
+	}
+
+	virtual void
+	endElement(const char *name, uintptr_t depth)
+	{
+		indent(depth);
+		xml += "</";
+		xml += name;
+		xml += ">\n";
+	}
+
+	virtual void
+	text(const char *text, uintptr_t length, uintptr_t depth)
+	{
+		indent(depth);
+		xml.append(text, length);
+		xml += "\n";
+	}
+
+private:
+	void
+	indent(uintptr_t depth)
+	{
+		if (depth > 1) {
+			xml.append(2 * (depth - 1), ' ');
+		}
+	}
+};
+
+/**
+ * Counts the decoded events without keeping them, as a streaming consumer would.
+ */
+class EventCounter : public MM_VerboseBinaryDecoder::Listener
+{
+public:
+	uintptr_t events;
+
+	EventCounter() : events(0) {}
+
+	virtual void
+	startElement(const char *name, uintptr_t depth, const MM_VerboseBinaryDecoder::Attribute *attributes, uintptr_t attributeCount, bool isEmpty)
+	{
+		events += 1 + attributeCount;
+	}
+
+	virtual void endElement(const char *name, uintptr_t depth) { events += 1; }
+	virtual void text(const char *text, uintptr_t length, uintptr_t depth) { events += 1; }
+};
+
+/**
+ * Append the stanzas of the given number of collections, as the verbose handlers write them.
+ */
+static void
+appendCollections(std::string &xml, uintptr_t cycles)
+{
+	char buffer[2048];
+	for (uintptr_t cycle = 0; cycle < cycles; cycle++) {
+		uintptr_t id = 2 + (cycle * 6);
+		uintptr_t second = cycle % 60;
+		snprintf(buffer, sizeof(buffer),
+			"<exclusive-start id=\"%zu\" timestamp=\"2026-10-17T02:29:%02zu.064\" intervalms=\"73.633\">\n"
+			"  <response-info timems=\"0.000\" idlems=\"0.000\" threads=\"0\" lastid=\"0000000000000000\" lastname=\"OMR_VMThread [0000000000000000]\" />\n"
+			"</exclusive-start>\n"
+			"<gc-start id=\"%zu\" type=\"global\" contextid=\"%zu\" timestamp=\"2026-10-17T02:29:%02zu.064\">\n"
+			"  <mem-info id=\"%zu\" free=\"527851520\" total=\"536870912\" percent=\"98\">\n"
+			"    <mem type=\"tenure\" free=\"527851520\" total=\"536870912\" percent=\"98\" />\n"
+			"  </mem-info>\n"
+			"</gc-start>\n"
+			"<gc-end id=\"%zu\" type=\"global\" contextid=\"%zu\" durationms=\"15.%03zu\" usertimems=\"11.603\" systemtimems=\"3.876\" stalltimems=\"0.003\" timestamp=\"2026-10-17T02:29:%02zu.080\" activeThreads=\"1\">\n"
+			"  <mem-info id=\"%zu\" free=\"529984928\" total=\"536870912\" percent=\"98\">\n"
+			"    <mem type=\"tenure\" free=\"529984928\" total=\"536870912\" percent=\"98\" />\n"
+			"  </mem-info>\n"
+			"</gc-end>\n"
+			"<exclusive-end id=\"%zu\" timestamp=\"2026-10-17T02:29:%02zu.080\" durationms=\"16.%03zu\" />\n",
+			id, second,
+			id + 1, id, second, id + 2,
+			id + 3, id, (cycle * 7919) % 1000, second, id + 4,
+			id + 5, second, (cycle * 104729) % 1000);
+		xml += buffer;
+	}
+}
+
+/**
+ * Build a verbose GC log of the given number of collections.
+ */
+static std::string
+syntheticLog(uintptr_t cycles)
+{
+	std::string xml =
+		"<?xml version=\"1.0\" ?>\n"
+		"<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"69015bf\">\n"
+		"<initialized id=\"1\" timestamp=\"2026-10-17T02:29:09.000\">\n"
+		"  <attribute name=\"gcPolicy\" value=\"-Xgcpolicy:optthruput\" />\n"
+		"  <attribute name=\"maxHeapSize\" value=\"0x20000000\" />\n"
+		"  <attribute name=\"binaryLoggingVersion\" value=\"1\" />\n"
+		"</initialized>\n";
+	appendCollections(xml, cycles);
+	xml += "</verbosegc>\n";
+	return xml;
+}
+
+/**
+ * Encode the XML in one piece and return the binary stream, or an empty string on failure.
+ */
+static std::string
+encode(MM_VerboseBinaryEncoder *encoder, const std::string &xml)
+{
+	encoder->reset();
+	if (!encoder->encode(xml.c_str(), xml.size())) {
+		return std::string();
+	}
+	std::string binary((const char *)encoder->getOutput(), encoder->getOutputSize());
+	encoder->consumeOutput();
+	return binary;
+}
+
+TEST(gcFunctionalTestVerboseBinaryFormat, roundTrip)
+{
+	std::string xml =
+		"<?xml version=\"1.0\" ?>\n"
+		"<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"69015bf\">\n"
+		"<!-- numbers which must come back as written -->\n"
+		"<numbers zero=\"0\" small=\"7\" large=\"18446744073709551615\" negative=\"-42\" hex=\"0x7fa0c0001000\" decimal=\"0.003\" fraction=\"12.000100\" />\n"
+		"<strings padded=\"007\" paddedHex=\"0x00ff\" minusZero=\"-0\" dot=\"1.\" empty=\"\" entity=\"a &lt; b &amp;&amp; c\" />\n"
+		"<nested depth=\"1\">\n"
+		"  <inner depth=\"2\">\n"
+		"    <innermost depth=\"3\" />\n"
+		"    text inside an element\n"
+		"  </inner>\n"
+		"</nested>\n";
+	/* overflow the dictionary with distinct long values, which share prefixes with the value before them */
+	char buffer[256];
+	for (uintptr_t i = 0; i < VERBOSE_BINARY_DICTIONARY_LIMIT + 100; i++) {
+		snprintf(buffer, sizeof(buffer),
+			"<event name=\"unique-name-%zu\" timestamp=\"2026-10-17T02:29:%02zu.%03zu\" detail=\"a string longer than the dictionary value limit, number %zu\" />\n",
+			i, i % 60, i % 1000, i);
+		xml += buffer;
+	}
+	/* values defined before the dictionary filled up come back as references */
+	appendCollections(xml, 3);
+	xml += "</verbosegc>\n";
+
+	MM_VerboseBinaryEncoder encoder;
+	ASSERT_TRUE(encoder.initialize(gcTestEnv->getPortLibrary()));
+	std::string binary = encode(&encoder, xml);
+	encoder.tearDown();
+	ASSERT_FALSE(binary.empty());
+	EXPECT_LT(binary.size(), xml.size());
+
+	XMLRebuilder rebuilder;
+	MM_VerboseBinaryDecoder decoder;
+	ASSERT_TRUE(decoder.initialize(gcTestEnv->getPortLibrary(), &rebuilder));
+	ASSERT_TRUE(decoder.decode((const uint8_t *)binary.data(), binary.size())) << decoder.getError();
+	EXPECT_TRUE(decoder.atRecordBoundary());
+	EXPECT_EQ((uintptr_t)0, decoder.getDepth());
+	EXPECT_EQ(xml, rebuilder.xml);
+
+	/* the same stream fed one byte at a time */
+	rebuilder.xml.clear();
+	decoder.reset();
+	for (uintptr_t i = 0; i < binary.size(); i++) {
+		ASSERT_TRUE(decoder.decode((const uint8_t *)binary.data() + i, 1)) << decoder.getError();
+	}
+	EXPECT_TRUE(decoder.atRecordBoundary());
+	EXPECT_EQ(xml, rebuilder.xml);
+	decoder.tearDown();
+}
+
+/**
+ * Encode a line with one encoder from its format and arguments, and with the other from its formatted text, and
+ * check that both give the same records.
+ */
+static void
+expectSameEncoding(MM_VerboseBinaryEncoder *fromFormat, MM_VerboseBinaryEncoder *fromText, const char *format, ...)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	char text[1024];
+	va_list args;
+
+	va_start(args, format);
+	bool encoded = fromFormat->encodeFormat(format, args);
+	va_end(args);
+	ASSERT_TRUE(encoded) << format;
+
+	va_start(args, format);
+	omrstr_vprintf(text, sizeof(text), format, args);
+	va_end(args);
+	ASSERT_TRUE(fromText->encode(text, strlen(text))) << text;
+
+	std::string formatBinary((const char *)fromFormat->getOutput(), fromFormat->getOutputSize());
+	std::string textBinary((const char *)fromText->getOutput(), fromText->getOutputSize());
+	fromFormat->consumeOutput();
+	fromText->consumeOutput();
+	EXPECT_EQ(textBinary, formatBinary) << text;
+}
+
+TEST(gcFunctionalTestVerboseBinaryFormat, encodeFormat)
+{
+	MM_VerboseBinaryEncoder fromFormat;
+	MM_VerboseBinaryEncoder fromText;
+	ASSERT_TRUE(fromFormat.initialize(gcTestEnv->getPortLibrary()));
+	ASSERT_TRUE(fromText.initialize(gcTestEnv->getPortLibrary()));
+
+	/* the encoders see the same lines in the same order, so their dictionaries and previous values stay the same */
+	for (uintptr_t i = 0; i < 3; i++) {
+		uintptr_t id = 2 + (i * 4);
+		expectSameEncoding(&fromFormat, &fromText, "<exclusive-start id=\"%zu\" timestamp=\"%s\" intervalms=\"%llu.%03llu\">", id, "2026-10-17T02:29:09.064", (uint64_t)73, (uint64_t)(i * 7));
+		expectSameEncoding(&fromFormat, &fromText, "<response-info timems=\"%llu.%03llu\" idlems=\"%llu.%03llu\" threads=\"%zu\" lastid=\"%p\" lastname=\"%s\" />", (uint64_t)0, (uint64_t)0, (uint64_t)1, (uint64_t)1000, (uintptr_t)0, (void *)0x7fa0c0001000, "OMR_VMThread [0x7fa0c0001000]");
+		expectSameEncoding(&fromFormat, &fromText, "</exclusive-start>");
+		/* tag templates and the end of tag are string arguments holding markup */
+		expectSameEncoding(&fromFormat, &fromText, "<gc-op %s>", "id=\"5\" type=\"scavenge\" timems=\"1.234\" contextid=\"3\" timestamp=\"2026-10-17T02:29:09.070\"");
+		expectSameEncoding(&fromFormat, &fromText, "<mem type=\"%s\" free=\"%zu\" total=\"%zu\" percent=\"%zu\"%s", "tenure", (uintptr_t)527851520, (uintptr_t)536870912, (uintptr_t)98, (0 == i) ? ">" : " />");
+		expectSameEncoding(&fromFormat, &fromText, "<heap-resize type=\"expand\" amount=\"%zu\" timems=\"%03.3llu\" reason=\"%s\" />", (uintptr_t)65536, (uint64_t)(i * 500), "excessive time being spent in gc");
+		expectSameEncoding(&fromFormat, &fromText, "<region address=\"0x%zx\" size=\"%4zx\" upper=\"0x%zX\" />", (uintptr_t)0x7fa0c0001000, (uintptr_t)(0x10 << i), (uintptr_t)0xabc);
+		expectSameEncoding(&fromFormat, &fromText, "<delta negative=\"%d\" zero=\"%d\" positive=\"%d\" smallest=\"%lld\" largest=\"%llu\" />", -42, 0, 7, (int64_t)INT64_MIN, (uint64_t)UINT64_MAX);
+		expectSameEncoding(&fromFormat, &fromText, "<ratio value=\"%.3f\" percent=\"%zu%%\" />", 0.25 * i, (uintptr_t)(i * 10));
+		expectSameEncoding(&fromFormat, &fromText, "<nursery><allocation-stats totalBytes=\"%zu\" /></nursery>", (uintptr_t)i);
+		expectSameEncoding(&fromFormat, &fromText, "</mem>");
+		expectSameEncoding(&fromFormat, &fromText, "</gc-op>");
+		/* lines which are not only tags, or with arguments outside attribute values, are formatted first */
+		expectSameEncoding(&fromFormat, &fromText, "<t%zu />", i);
+		expectSameEncoding(&fromFormat, &fromText, "<!-- cycle %zu -->", i);
+		expectSameEncoding(&fromFormat, &fromText, "text in cycle %zu", i);
+		expectSameEncoding(&fromFormat, &fromText, "<warning details=\"%c\" />", (uint32_t)'"');
+		expectSameEncoding(&fromFormat, &fromText, "<object name=\"%s\" />", (const char *)NULL);
+	}
+
+	fromText.tearDown();
+	fromFormat.tearDown();
+}
+
+TEST(gcFunctionalTestVerboseBinaryFormat, malformedStream)
+{
+	MM_VerboseBinaryEncoder encoder;
+	ASSERT_TRUE(encoder.initialize(gcTestEnv->getPortLibrary()));
+	std::string binary = encode(&encoder, syntheticLog(2));
+	encoder.tearDown();
+	ASSERT_FALSE(binary.empty());
+
+	EventCounter counter;
+	MM_VerboseBinaryDecoder decoder;
+	ASSERT_TRUE(decoder.initialize(gcTestEnv->getPortLibrary(), &counter));
+
+	/* a stream cut within a record decodes up to the cut */
+	ASSERT_TRUE(decoder.decode((const uint8_t *)binary.data(), binary.size() - 3));
+	EXPECT_FALSE(decoder.atRecordBoundary());
+	EXPECT_NE((uintptr_t)0, counter.events);
+
+	/* a stream which is not binary verbose GC is rejected */
+	decoder.reset();
+	std::string xml = syntheticLog(1);
+	EXPECT_FALSE(decoder.decode((const uint8_t *)xml.data(), xml.size()));
+	EXPECT_TRUE(NULL != decoder.getError());
+	EXPECT_FALSE(decoder.atRecordBoundary());
+	decoder.tearDown();
+}
+
+/**
+ * Compare the size of the binary stream with the XML, and the time to encode it and to decode it with the time
+ * to load the XML. Run with the perfTest filter, for example
+ * omrgctest --gtest_filter="perfTestVerboseBinaryFormat*" -logLevel=info
+ */
+TEST(perfTestVerboseBinaryFormat, sizeAndTime)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const uintptr_t cycleCounts[] = {100, 1000, 10000};
+
+	MM_VerboseBinaryEncoder encoder;
+	ASSERT_TRUE(encoder.initialize(OMRPORTLIB));
+	EventCounter counter;
+	MM_VerboseBinaryDecoder decoder;
+	ASSERT_TRUE(decoder.initialize(OMRPORTLIB, &counter));
+
+	gcTestEnv->log(LEVEL_INFO, "%8s %12s %12s %8s %12s %12s %12s\n", "cycles", "xml(bytes)", "binary(bytes)", "ratio", "encode(ms)", "decode(ms)", "xmlload(ms)");
+	for (uintptr_t c = 0; c < sizeof(cycleCounts) / sizeof(cycleCounts[0]); c++) {
+		std::string xml = syntheticLog(cycleCounts[c]);
+
+		uint64_t start = omrtime_hires_clock();
+		std::string binary = encode(&encoder, xml);
+		uint64_t encodeTime = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		ASSERT_FALSE(binary.empty());
+
+		decoder.reset();
+		start = omrtime_hires_clock();
+		ASSERT_TRUE(decoder.decode((const uint8_t *)binary.data(), binary.size())) << decoder.getError();
+		uint64_t decodeTime = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		pugi::xml_document document;
+		start = omrtime_hires_clock();
+		ASSERT_TRUE(document.load_buffer(xml.data(), xml.size()));
+		uint64_t loadTime = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		gcTestEnv->log(LEVEL_INFO, "%8zu %12zu %12zu %8.2f %12.3f %12.3f %12.3f\n",
+			cycleCounts[c], xml.size(), binary.size(), (double)xml.size() / (double)binary.size(),
+			(double)encodeTime / 1000.0, (double)decodeTime / 1000.0, (double)loadTime / 1000.0);
+	}
+
+	decoder.tearDown();
+	encoder.tearDown();
+}
@@ -30,6 +30,7 @@
 #include "EnvironmentBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionManager.hpp"
+#include "Math.hpp"
 #include "MemoryManager.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "ParallelDispatcher.hpp"
@@ -256,6 +257,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			summarizeDirtyCard(card);
 		}
 	}
 }
@@ -270,6 +272,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
+			summarizeDirtyCard(card);
 		}
 	}
 }
@@ -314,6 +317,7 @@ MM_CardTable::cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, C
 		}
 		thisCard += 1;
 	}
+	env->_cardCleaningStats._cardsScanned += (uintptr_t)(endCard - low);
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
 }
 
@@ -378,6 +382,8 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* h
 	Card *lastCard = heapAddrToCardAddr(env,heapTop);
 	uintptr_t sizeToClear = (uint8_t *)lastCard - (uint8_t *)firstCard;
 
+	clearDirtyCardSummary(firstCard, lastCard);
+
 	/* We can't use OMRZeroMemory() here as that requires the  area to
 	 * be cleared to be uintptr_t aligned
 	 */
@@ -386,6 +392,42 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* h
 	return sizeToClear;
 }
 
+/**
+ * Clear the dirty card summary bits of the cards in [lowCard, highCard) which are about to be cleared.
+ * Only the bits whose cards all lie within the range are cleared. A card dirtied concurrently after
+ * it has been cleared sets its bit again, as the summary is cleared before the cards are.
+ */
+void
+MM_CardTable::clearDirtyCardSummary(Card *lowCard, Card *highCard)
+{
+	if (NULL != _dirtyCardSummary) {
+		uintptr_t group = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_BIT, (uintptr_t)(lowCard - _cardTableStart)) / CARD_SUMMARY_CARDS_PER_BIT;
+		uintptr_t topGroup = (uintptr_t)(highCard - _cardTableStart) / CARD_SUMMARY_CARDS_PER_BIT;
+
+		while (group < topGroup) {
+			volatile uintptr_t *slot = (volatile uintptr_t *)&_dirtyCardSummary[group / J9BITS_BITS_IN_SLOT];
+			uintptr_t bitIndex = group % J9BITS_BITS_IN_SLOT;
+			uintptr_t bitCount = OMR_MIN(J9BITS_BITS_IN_SLOT - bitIndex, topGroup - group);
+			if (J9BITS_BITS_IN_SLOT == bitCount) {
+				*slot = 0;
+			} else {
+				/* other bits of the slot describe cards outside of the range, which may be dirtied concurrently */
+				uintptr_t mask = (((uintptr_t)1 << bitCount) - 1) << bitIndex;
+				uintptr_t oldValue = *slot;
+				while (0 != (oldValue & mask)) {
+					uintptr_t value = MM_AtomicOperations::lockCompareExchange(slot, oldValue, oldValue & ~mask);
+					if (value == oldValue) {
+						break;
+					}
+					oldValue = value;
+				}
+			}
+			group += bitCount;
+		}
+		MM_AtomicOperations::storeSync();
+	}
+}
+
 void
 MM_CardTable::kill(MM_EnvironmentBase *env)
 {
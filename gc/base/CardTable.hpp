@@ -33,9 +33,14 @@
 #include "omrmodroncore.h"
 #include "modronbase.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
+#include "Bits.hpp"
 #include "MemoryManager.hpp"
 
+/* Number of cards described by one bit of the dirty card summary */
+#define CARD_SUMMARY_CARDS_PER_BIT ((uintptr_t)64)
+
 class MM_EnvironmentBase;
 class MM_CardCleaner;
 class MM_Heap;
@@ -57,6 +62,7 @@ class MM_CardTable : public MM_BaseVirtual
 public:
 protected:
 	void *_heapAlloc;
+	uintptr_t *_dirtyCardSummary; /**< one bit per CARD_SUMMARY_CARDS_PER_BIT cards, set once any of them is dirtied (NULL if the card table is not summarized) */
 private:
 	MM_MemoryHandle _cardTableMemoryHandle;	/**< memory handle for array backing store */
 	Card *_cardTableStart;
@@ -84,6 +90,36 @@ public:
 	 */
 	void *getHeapBase() { return _heapBase; };
 
+	/**
+	 * @return the dirty card summary, or NULL if the card table is not summarized
+	 */
+	uintptr_t *getDirtyCardSummary() { return _dirtyCardSummary; };
+
+	/**
+	 * Record in the dirty card summary that a card has been dirtied. Must be called after the card is written,
+	 * so that a clear summary bit observed at a safe point guarantees that the cards it describes are clean.
+	 * Summary bits are only cleared when their cards are cleared (see clearCardsInRange()).
+	 * @param[in] card The card which has just been dirtied
+	 */
+	MMINLINE void
+	summarizeDirtyCard(Card *card)
+	{
+		if (NULL != _dirtyCardSummary) {
+			uintptr_t group = (uintptr_t)(card - _cardTableStart) / CARD_SUMMARY_CARDS_PER_BIT;
+			volatile uintptr_t *slot = (volatile uintptr_t *)&_dirtyCardSummary[group / J9BITS_BITS_IN_SLOT];
+			uintptr_t bit = (uintptr_t)1 << (group % J9BITS_BITS_IN_SLOT);
+			uintptr_t oldValue = *slot;
+			/* the bit is almost always set already, so only pay for the atomic update the first time */
+			while (0 == (oldValue & bit)) {
+				uintptr_t value = MM_AtomicOperations::lockCompareExchange(slot, oldValue, oldValue | bit);
+				if (value == oldValue) {
+					break;
+				}
+				oldValue = value;
+			}
+		}
+	}
+
 	/**
 	 * Checks if card is dirty or has a specific value
  	 * @param[in] env A GC thread
@@ -99,6 +135,7 @@ public:
 	 * @param[in] env The thread which is attempting to write to obj
 	 * @param[in] objectRef The object being modified
 	 * @note Called by the write barrier so this must be fast (although the operation is inlined, in the JIT)
+	 * @note An inlined barrier must also summarize the card (see summarizeDirtyCard()) if the card table is summarized
 	 */
 	void dirtyCard(MM_EnvironmentBase *env, omrobjectptr_t objectRef);
 
@@ -264,6 +301,7 @@ protected:
 	MM_CardTable()
 		: MM_BaseVirtual()
 		, _heapAlloc(NULL)
+		, _dirtyCardSummary(NULL)
 		, _cardTableMemoryHandle()
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
@@ -274,6 +312,7 @@ protected:
 
 private:
 	void cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, Card *low, Card *high);
+	void clearDirtyCardSummary(Card *lowCard, Card *highCard);
 };
 
 #endif /* CARDTABLE_HPP_ */
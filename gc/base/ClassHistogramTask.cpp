@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "ClassHistogramTask.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMapIterator.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "MarkingScheme.hpp"
+#include "ParallelDispatcher.hpp"
+
+void
+MM_ClassHistogramTask::run(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		uint8_t *chunkBase = (uint8_t *)region->getLowAddress();
+		uint8_t *regionTop = (uint8_t *)region->getHighAddress();
+		while (chunkBase < regionTop) {
+			uint8_t *chunkTop = chunkBase + OMR_MIN(CLASS_HISTOGRAM_WORK_UNIT_SIZE, (uintptr_t)(regionTop - chunkBase));
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				/* objects starting in the chunk belong to it, even when they extend past its top */
+				MM_HeapMapIterator markedObjectIterator(extensions, _markingScheme->getMarkMap(), (uintptr_t *)chunkBase, (uintptr_t *)chunkTop, false);
+				omrobjectptr_t object = NULL;
+				while (NULL != (object = markedObjectIterator.nextObject())) {
+					_markingScheme->countObjectByClass(env, object);
+				}
+			}
+			chunkBase = chunkTop;
+		}
+	}
+	regionManager->unlock();
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(CLASSHISTOGRAMTASK_HPP_)
+#define CLASSHISTOGRAMTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "ParallelTask.hpp"
+
+class MM_EnvironmentBase;
+class MM_MarkingScheme;
+class MM_ParallelDispatcher;
+
+/* Bytes of heap whose marked objects are counted as one unit of work (a multiple of J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT) */
+#define CLASS_HISTOGRAM_WORK_UNIT_SIZE ((uintptr_t)1024 * 1024)
+
+/**
+ * Count the objects marked by a completed mark by class (markingClassHistogram only). Every GC thread walks
+ * chunks of the mark map and counts into the histogram of its environment, so the census includes objects
+ * marked without being traced, such as objects allocated during a concurrent mark, and marking itself is
+ * not slowed down.
+ * @ingroup GC_Base_Core
+ */
+class MM_ClassHistogramTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_MarkingScheme *_markingScheme;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; }
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a ClassHistogramTask object.
+	 */
+	MM_ClassHistogramTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_MarkingScheme *markingScheme)
+		: MM_ParallelTask(env, dispatcher)
+		, _markingScheme(markingScheme)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* CLASSHISTOGRAMTASK_HPP_ */
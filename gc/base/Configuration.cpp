@@ -39,6 +39,7 @@
 #include "HeapRegionManager.hpp"
 #include "OMR_VM.hpp"
 #include "OMR_VMThread.hpp"
+#include "Math.hpp"
 #include "MemoryManager.hpp"
 #include "MemorySpace.hpp"
 #include "ParallelDispatcher.hpp"
@@ -468,6 +469,17 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 	}
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
+	if (extensions->numaGCThreadAffinity) {
+		/* round the lock splitting factors up so that every node gets an equal group of sublists */
+		uintptr_t nodeCount = extensions->_numaManager.getAffinityLeaderCount();
+		if (1 < nodeCount) {
+			extensions->packetListSplit = MM_Math::roundToCeiling(nodeCount, extensions->packetListSplit);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+			extensions->cacheListSplit = MM_Math::roundToCeiling(nodeCount, extensions->cacheListSplit);
+#endif /* OMR_GC_MODRON_SCAVENGER */
+		}
+	}
+
 	/* initialize default split freelist split amount */
 	if (0 == extensions->splitFreeListSplitAmount) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -31,6 +31,7 @@
 #include "ut_j9mm.h"
 
 #include "AllocateDescription.hpp"
+#include "ClassHistogram.hpp"
 #include "Collector.hpp"
 #include "ConcurrentGCStats.hpp"
 #include "GCExtensionsBase.hpp"
@@ -106,6 +107,15 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	if (extensions->markingClassHistogram) {
+		_markClassHistogram = MM_ClassHistogram::newInstance(this);
+		if (NULL == _markClassHistogram) {
+			return false;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	if (extensions->isSegregatedHeap()) {
 		_regionWorkList = MM_RegionPoolSegregated::allocateHeapRegionQueue(this, MM_HeapRegionList::HRL_KIND_LOCAL_WORK, true, false, false);
@@ -165,6 +175,13 @@ MM_EnvironmentBase::tearDown(MM_GCExtensionsBase *extensions)
 
 	_freeEntrySizeClassStats.tearDown(this);
 
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	if (NULL != _markClassHistogram) {
+		_markClassHistogram->kill(this);
+		_markClassHistogram = NULL;
+	}
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+
 	if (NULL != extensions->globalAllocationManager) {
 		extensions->globalAllocationManager->releaseAllocationContext(this);
 	}
@@ -25,6 +25,7 @@
 
 #include "omrcomp.h"
 #include "modronbase.h"
+#include "omrmodroncore.h"
 #include "omr.h"
 #include "thread_api.h"
 
@@ -45,6 +46,7 @@
 
 class MM_AllocationContext;
 class MM_AllocateDescription;
+class MM_ClassHistogram;
 class MM_Collector;
 class MM_HeapRegionQueue;
 class MM_MemorySpace;
@@ -66,7 +68,8 @@ typedef enum {
 	WRITE_BARRIER_THREAD,
 	CON_MARK_HELPER_THREAD,
 	GC_WORKER_THREAD,
-	GC_MAIN_THREAD
+	GC_MAIN_THREAD,
+	CON_SWEEP_HELPER_THREAD
 } ThreadType;
 
 /**
@@ -143,6 +146,7 @@ public:
 	MM_WorkPacketStats _workPacketStatsRSScan;   /**< work packet Stats specifically for RS Scan Phase of Concurrent STW GC */
 
 	uint64_t _workerThreadCpuTimeNanos;	/**< Total CPU time used by this worker thread (or 0 for non-workers) */
+	uintptr_t _numaNode; /**< The NUMA affinity leader (starting from 1) this GC worker thread is associated with, or 0 if none */
 
 	MM_FreeEntrySizeClassStats _freeEntrySizeClassStats;  /**< GC thread local statistics structure for heap free entry size (sizeClass) distribution */
 
@@ -155,6 +159,7 @@ public:
 	MM_Validator *_activeValidator; /**< Used to identify and report crashes inside Validators */
 
 	MM_MarkStats _markStats;
+	MM_ClassHistogram *_markClassHistogram; /**< marked objects counted by this thread after a mark, by class (markingClassHistogram only) */
 
 	MM_RootScannerStats _rootScannerStats; /**< Per thread stats to track the performance of the root scanner */
 
@@ -167,6 +172,11 @@ public:
 	volatile uint32_t _allocationColor; /**< Flag field to indicate whether premarking is enabled on the thread */
 
 	MM_CardCleaningStats _cardCleaningStats; /**< Per thread stats to track the performance of the card cleaning */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	Card *_cardCleaningChunkNext; /**< next card to check in the chunk of card table claimed by this thread for concurrent or final card cleaning */
+	Card *_cardCleaningChunkTop; /**< card following the claimed chunk */
+	uintptr_t _cardCleaningChunkEpoch; /**< cleaning pass of the card table the chunk was claimed in */
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 	MM_SweepStats _sweepStats;
 #if defined(OMR_GC_MODRON_COMPACTION)
@@ -710,16 +720,23 @@ public:
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
 		,_workerThreadCpuTimeNanos(0)
+		,_numaNode(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
+		,_markClassHistogram(NULL)
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		,_cardCleaningChunkNext(NULL)
+		,_cardCleaningChunkTop(NULL)
+		,_cardCleaningChunkEpoch(0)
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
@@ -767,16 +784,23 @@ public:
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
 		,_workerThreadCpuTimeNanos(0)
+		,_numaNode(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
+		,_markClassHistogram(NULL)
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		,_cardCleaningChunkNext(NULL)
+		,_cardCleaningChunkTop(NULL)
+		,_cardCleaningChunkEpoch(0)
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
@@ -70,6 +70,9 @@ class MM_ObjectMap;
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 class MM_ReferenceChainWalkerMarkMap;
 class MM_RememberedSetCardBucket;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+class MM_RememberedSetCardTable;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_REALTIME)
 class MM_RememberedSetSATB;
 #endif /* defined(OMR_GC_REALTIME) */
@@ -265,9 +268,19 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	enum HugePagePolicy {
+		HUGE_PAGE_POLICY_DEFAULT = 0, /**< leave huge page use for the heap to the requested page size and the system settings */
+		HUGE_PAGE_POLICY_OFF, /**< back the heap with default size pages only */
+		HUGE_PAGE_POLICY_TRANSPARENT, /**< advise transparent huge pages for the heap */
+		HUGE_PAGE_POLICY_EXPLICIT, /**< reserve the heap in the default large (hugetlbfs) page size */
+	};
+	HugePagePolicy heapHugePagePolicy; /**< how the heap should be backed by huge pages */
+	uintptr_t transparentHugePageSize; /**< size of a transparent huge page; an advised heap is only decommitted in whole ones */
+	bool heapPretouch; /**< fault in and zero memory committed by heap expansion before it is used for allocation */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
+	MM_RememberedSetCardTable *rememberedSetCardTable; /**< card based remembered set, used instead of rememberedSet when scavengerRememberedSetCards is enabled */
 	uintptr_t oldHeapSizeOnLastGlobalGC;
 	uintptr_t freeOldHeapSizeOnLastGlobalGC;
 	float concurrentKickoffTenuringHeadroom; /**< percentage of free memory remaining in tenure heap. Used in conjunction with free memory to determine concurrent mark kickoff */
@@ -326,6 +339,9 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	bool tlhAdaptiveSizing; /**< size TLHs from each thread's allocation between collections instead of growing them by tlhIncrementSize */
+	uintptr_t tlhAdaptiveRefreshTarget; /**< number of refreshes per thread between collections that adaptive TLH sizing aims for */
+	uintptr_t tlhRefreshBatchCount; /**< number of refresh sized chunks carved by a fresh TLH refresh; chunks beyond the first are kept by the thread for its next refreshes (1 disables batching, and the refresh counts and latencies reported with it) */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 
@@ -375,6 +391,8 @@ public:
 	uintptr_t heapContractionGCTimeThreshold; /**< min percentage of time spent in gc before contraction */
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	bool heapSizingForecast; /**< size the heap from the forecast allocation rate and live set instead of the free ratio thresholds */
+	uintptr_t heapSizingGCOverheadTarget; /**< percentage of time the forecast sizing aims to spend in global collections */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */	
@@ -382,9 +400,12 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool packetListLockFree; /**< push and pop work packets with a compare-and-swap of tagged sublist heads rather than under the packet list locks */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	bool markingClassHistogram; /**< count the objects and bytes left marked by every mark by class, premarked and allocated marked ones included, and report the largest classes; the count is a pass over the mark map once the mark completes */
+	uintptr_t markingClassHistogramTopK; /**< number of classes reported by markingClassHistogram */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 	bool rootScannerStatsUsed; /**< Flag that indicates if rootScannerStats are used for in the last increment (by any thread, for any of its roots) */
@@ -440,6 +461,11 @@ public:
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
 	uintptr_t dispatcherHybridNotifyThreadBound; /** Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
+	bool dispatcherParkWorkers; /**< if true, idle worker threads spin and then park on their own task generation word instead of waiting on the shared dispatcher monitor */
+	uintptr_t dispatcherParkSpinCount; /**< number of spin iterations an idle worker makes before parking (dispatcherParkWorkers only, ignored on uniprocessors) */
+	bool adaptiveGCThreadCount; /**< if true, the dispatcher chooses the thread count of scavenge, mark, sweep and compact tasks from a model of their past parallel efficiency */
+	float adaptiveGCThreadCountWeight; /**< weight of the history in the running averages of the adaptive thread count model */
+	bool heapMapSIMDScanning; /**< if true, heap map scanning and clearing use the vector kernels supported by the processor, otherwise the scalar kernels */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -476,6 +502,11 @@ public:
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerWorkStealing; /**< distribute scan caches through per-thread work-stealing deques, falling back to the shared scan list only on overflow */
+	uintptr_t scavengerScanCacheDequeSize; /**< capacity (rounded up to a power of two) of each GC thread's scan cache deque when scavengerWorkStealing is enabled */
+	bool scavengerRememberedSetCards; /**< index remembered objects with a card table and object map instead of remembered set lists, which can overflow */
+	bool scavengerHotFieldDiscovery; /**< discover hot fields by sampling scanned objects, for objects whose hot fields are not given by the object model (dynamicBreadthFirstScanOrdering only) */
+	uintptr_t scavengerHotFieldSampleInterval; /**< a GC thread samples one in this many objects it scans when scavengerHotFieldDiscovery is enabled */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
@@ -549,6 +580,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool parallelSlidingCompaction; /**< slide each region towards its base using forwarding addresses from a prefix sum of sub area live bytes, rather than evacuating sub areas */
+	uintptr_t compactPrefetchDistance; /**< number of marked objects compaction prefetches ahead of the one it moves (0 disables, at most 32) */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -562,6 +595,8 @@ public:
 	bool dirtCardDuringRSScan;
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
+	bool concurrentHelperPacing; /**< concurrent helper threads do the tracing and card cleaning, mutators pay allocation tax only when the helpers fall behind schedule */
+	bool concurrentCardCleaningSummary; /**< summarize dirty cards one bit per 64 cards so card cleaning skips clean parts of the card table. Only valid if every card is dirtied through MM_CardTable::dirtyCard*(), with no inline barrier storing to the card table directly: a card dirtied otherwise is never cleaned (asserted before final card cleaning in DEBUG builds) */
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
@@ -668,6 +703,9 @@ public:
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
 	bool nonDeterministicSweep;
+	bool segregatedConcurrentSweep; /**< if true, the segregated collector leaves small regions unswept at the end of the pause; they are swept on demand by allocating threads and by background helpers */
+	uintptr_t segregatedConcurrentSweepHelperThreads; /**< number of background threads sweeping small regions after the pause (segregatedConcurrentSweep only) */
+	bool segregatedSizeClassStats; /**< if true, the segregated heap counts allocations, live cells, region occupancy and region flips per size class */
 /* OMR_GC_REALTIME (in for all) */
 
 	MM_ConfigurationOptions configurationOptions; /**< holds the options struct, used during startup for selecting a Configuration */
@@ -679,6 +717,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asynchronousLogging; /**< Enabled by -Xgc:asynchronousLogging.  Queue verbose:gc output in a ring and write it to the file from a dedicated thread */
+	uintptr_t asynchronousLoggingBufferSize; /**< size of the asynchronous logging ring (rounded up to a power of two); output is dropped and counted when it is full */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc files in the compact binary format (see VerboseBinaryFormat.hpp) */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -713,6 +754,7 @@ public:
 	uintptr_t regionSize; /**< The size, in bytes, of a fixed-size table-backed region of the heap (does not apply to AUX regions) */
 	MM_NUMAManager _numaManager; /**< The object which abstracts the details of our NUMA support so that the GCExtensions and the callers don't need to duplicate the support to interpret our intention */
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
+	bool numaGCThreadAffinity; /**< if true, GC worker threads are bound round-robin to the NUMA affinity leaders and prefer work from threads on their own node */
 
 	bool padToPageSize;
 	
@@ -822,6 +864,9 @@ public:
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
 	bool compactOnIdle; /**< Forces compaction if global GC executed while VM Runtime State set to IDLE, default is false */
 	float gcOnIdleCompactThreshold; /**< Enables compaction when fragmented memory and dark matter exceed this limit. The larger this number, the more memory can be fragmented before compact is triggered **/
+	uintptr_t gcOnIdleDelay; /**< milliseconds without allocation after which a background thread starts an idle collection (gcOnIdle only), 0 to disable */
+	volatile uintptr_t allocationActivityCount; /**< bumped, without synchronization, whenever a mutator refreshes its TLH or allocates outside one (gcOnIdleDelay only); the idle GC detector times inactivity from when it last changed */
+	bool gcOnIdleReleaseLazily; /**< free heap pages are released lazily (MADV_FREE) on idle, so they stay resident until memory pressure and are not counted as returned, default is false (they are decommitted) */
 #endif
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -874,6 +919,19 @@ public:
 	 */
 	MMINLINE OMR::GC::Forge* getForge() { return &_forge; }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Note that a mutator took memory from the heap, so the idle GC detector restarts timing inactivity.
+	 * Only called on allocation slow paths; concurrent increments may be lost, as only a change matters.
+	 */
+	MMINLINE void recordAllocationActivity()
+	{
+		if (0 != gcOnIdleDelay) {
+			allocationActivityCount += 1;
+		}
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 	/**
 	 * Return back true if object references are compressed
 	 * @return true, if object references are compressed
@@ -1401,8 +1459,12 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, heapHugePagePolicy(HUGE_PAGE_POLICY_DEFAULT)
+		, transparentHugePageSize((uintptr_t)2 * 1024 * 1024)
+		, heapPretouch(false)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
+		, rememberedSetCardTable(NULL)
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
 		, freeOldHeapSizeOnLastGlobalGC(UDATA_MAX)
 		, concurrentKickoffTenuringHeadroom((float)0.02)
@@ -1446,6 +1508,9 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveRefreshTarget(50)
+		, tlhRefreshBatchCount(1)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
 		, allocationStats()
@@ -1483,13 +1548,18 @@ public:
 		, heapContractionGCTimeThreshold(5)
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, heapSizingForecast(false)
+		, heapSizingGCOverheadTarget(5)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)	
 		, useGCStartupHints(true)	
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, packetListLockFree(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingClassHistogram(false)
+		, markingClassHistogramTopK(10)
 		, rootScannerStatsEnabled(false)
 		, rootScannerStatsUsed(false)
 		, fvtest_forceOldResize(0)
@@ -1535,6 +1605,11 @@ public:
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
 		, dispatcherHybridNotifyThreadBound(16)
+		, dispatcherParkWorkers(false)
+		, dispatcherParkSpinCount(4096)
+		, adaptiveGCThreadCount(false)
+		, adaptiveGCThreadCountWeight(0.5f)
+		, heapMapSIMDScanning(true)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
@@ -1566,6 +1641,11 @@ public:
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerWorkStealing(false)
+		, scavengerScanCacheDequeSize(256)
+		, scavengerRememberedSetCards(false)
+		, scavengerHotFieldDiscovery(false)
+		, scavengerHotFieldSampleInterval(16)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, concurrentScavenger(false)
@@ -1627,6 +1707,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, parallelSlidingCompaction(false)
+		, compactPrefetchDistance(8)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1638,6 +1720,8 @@ public:
 		, dirtCardDuringRSScan(false)
 		, concurrentLevel(8)
 		, concurrentBackground(1)
+		, concurrentHelperPacing(false)
+		, concurrentCardCleaningSummary(false)
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
@@ -1719,12 +1803,18 @@ public:
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
 		, nonDeterministicSweep(false)
+		, segregatedConcurrentSweep(false)
+		, segregatedConcurrentSweepHelperThreads(1)
+		, segregatedSizeClassStats(false)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
 		, verbosegcCycleTime(1000)  /* by default metronome outputs verbosegc every 1sec */
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asynchronousLogging(false)
+		, asynchronousLoggingBufferSize(1024 * 1024)
+		, binaryLogging(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1744,6 +1834,7 @@ public:
 		, regionSize(0)
 		, _numaManager()
 		, numaForced(false)
+		, numaGCThreadAffinity(false)
 		, padToPageSize(false)
 		, fvtest_disableExplictMainThread(false)
 #if defined(OMR_GC_VLHGC)
@@ -1828,6 +1919,9 @@ public:
 		, gcOnIdle(false)
 		, compactOnIdle(false)
 		, gcOnIdleCompactThreshold((float)0.10)
+		, gcOnIdleDelay(0)
+		, allocationActivityCount(0)
+		, gcOnIdleReleaseLazily(false)
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #if defined(OMR_VALGRIND_MEMCHECK)
 		, valgrindMempoolAddr(0)
@@ -30,6 +30,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapResizeStats.hpp"
+#include "HeapSizingForecast.hpp"
 #include "PercolateStats.hpp"
 
 class MM_HeapRegionDescriptor;
@@ -55,6 +56,7 @@ protected:
 	uintptr_t _maximumMemorySize;
 
 	MM_HeapResizeStats _heapResizeStats;
+	MM_HeapSizingForecast _heapSizingForecast;
 	MM_PercolateStats _percolateStats;
 
 	MM_HeapRegionManager *_heapRegionManager;
@@ -74,6 +76,7 @@ public:
 	virtual uintptr_t calculateOffsetFromHeapBase(void*) = 0;
 
 	MMINLINE MM_HeapResizeStats *getResizeStats() { return &_heapResizeStats; }
+	MMINLINE MM_HeapSizingForecast *getSizingForecast() { return &_heapSizingForecast; }
 
 	MMINLINE MM_PercolateStats *getPercolateStats() { return &_percolateStats; }
 
@@ -127,6 +130,9 @@ public:
 
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	virtual bool releaseMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
@@ -178,6 +184,7 @@ public:
 		,_memorySpaceList(NULL)
 		,_maximumMemorySize(maximumMemorySize)
 		,_heapResizeStats()
+		,_heapSizingForecast()
 		,_percolateStats()
 		,_heapRegionManager(regionManager)
 	{
@@ -62,6 +62,7 @@ MM_HeapMap::initialize(MM_EnvironmentBase *env)
 		_heapMapBits = (uintptr_t *)memoryManager->getHeapBase(&_heapMapMemoryHandle);
 		_heapBase = _extensions->heap->getHeapBase();
 		_heapMapBaseDelta = (uintptr_t)_heapBase;
+		_scanKernels = MM_HeapMapScanKernels::selectKernels(env);
 		result = true;
 	}
 	return result;
@@ -266,7 +267,7 @@ MM_HeapMap::setBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *high
 	bytesToSet= (topIndex - baseIndex) * sizeof(uintptr_t);
 		
 	if (clear) {
-		OMRZeroMemory((void *)&(_heapMapBits[baseIndex]), bytesToSet);
+		_scanKernels->clearSlots(&(_heapMapBits[baseIndex]), &(_heapMapBits[topIndex]));
 	} else {
 		memset(&(_heapMapBits[baseIndex]), 0xFF, bytesToSet);
 	}
@@ -284,7 +285,6 @@ bool
 MM_HeapMap::checkBitsForRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region)
 {
 	uintptr_t baseIndex, topIndex;
-	uintptr_t bytesToCheck;
 
 	void *lowAddress = region->getLowAddress();
 	void *highAddress = region->getHighAddress();
@@ -305,14 +305,41 @@ MM_HeapMap::checkBitsForRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor
 	topIndex = _extensions->heap->calculateOffsetFromHeapBase(highAddress);
 	topIndex >>= _heapMapIndexShift;
 
-	bytesToCheck= (topIndex - baseIndex) * sizeof(uintptr_t);
+	return &(_heapMapBits[topIndex]) == _scanKernels->findNonEmptySlot(&(_heapMapBits[baseIndex]), &(_heapMapBits[topIndex]));
+}
 
-	uint8_t *markMapBytes = (uint8_t *)(&_heapMapBits[baseIndex]);
-	for (uintptr_t i = 0; i < bytesToCheck; i++) {
-		if (0 != markMapBytes[i]) {
-			return false;
-		}
+uintptr_t
+MM_HeapMap::countBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	uintptr_t baseIndex, topIndex;
+
+	/* Validate passed heap references */
+	Assert_MM_true(lowAddress >= _heapBase);
+	Assert_MM_true(lowAddress <= highAddress);
+	Assert_MM_true(highAddress <= _heapTop);
+
+	if (lowAddress == highAddress) {
+		return 0;
+	}
+
+	baseIndex = _extensions->heap->calculateOffsetFromHeapBase(lowAddress);
+	baseIndex >>= _heapMapIndexShift;
+
+	/* round the top up so that a partial trailing slot is included */
+	topIndex = _extensions->heap->calculateOffsetFromHeapBase(highAddress);
+	topIndex = (topIndex + ((uintptr_t)1 << _heapMapIndexShift) - 1) >> _heapMapIndexShift;
+
+	uintptr_t count = _scanKernels->countBits(&(_heapMapBits[baseIndex]), &(_heapMapBits[topIndex]));
+
+	/* discount bits outside of the range in the partial leading and trailing slots */
+	uintptr_t lowBitIndex = getBitIndex((omrobjectptr_t)lowAddress);
+	if (0 != lowBitIndex) {
+		count -= MM_Bits::populationCount(_heapMapBits[baseIndex] & (((uintptr_t)1 << lowBitIndex) - 1));
+	}
+	uintptr_t highBitIndex = getBitIndex((omrobjectptr_t)highAddress);
+	if (0 != highBitIndex) {
+		count -= MM_Bits::populationCount(_heapMapBits[topIndex - 1] & ~(((uintptr_t)1 << highBitIndex) - 1));
 	}
 
-	return true;
+	return count;
 }
@@ -39,6 +39,7 @@
 #include "BaseVirtual.hpp"
 #include "Bits.hpp"
 #include "EnvironmentBase.hpp"
+#include "HeapMapScanKernels.hpp"
 #include "MemoryHandle.hpp"
 
 class MM_GCExtensionsBase;
@@ -106,6 +107,8 @@ protected:
 	
 	uintptr_t _maxHeapSize;
 
+	const MM_HeapMapScanKernels *_scanKernels; /**< kernels used to scan, count and clear runs of heap map slots */
+
 public:
 	
 /*
@@ -128,6 +131,8 @@ public:
 	MMINLINE void *getHeapBase() { return _heapBase; }
 
 	MMINLINE uintptr_t *getHeapMapBits() { return _heapMapBits; }
+
+	MMINLINE const MM_HeapMapScanKernels *getScanKernels() const { return _scanKernels; }
 	MMINLINE const uintptr_t *getHeapMapBits() const { return _heapMapBits; }
 
 	MMINLINE uintptr_t getObjectGrain() { return ((uintptr_t)1) << _heapMapBitShift; };
@@ -308,6 +313,15 @@ public:
 	 * @return true if cleared
 	 */
 	bool checkBitsForRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region);
+
+	/**
+	 * Count the heap map bits set for a specified heap range. For a mark map this is the number of
+	 * marked objects, which together with an average object size gives a cheap live bytes estimate.
+	 * @param lowAddress - base of region of heap whose heap map bits are to be counted
+	 * @param highAddress - top of region of heap whose heap map bits are to be counted
+	 * @return the number of bits set
+	 */
+	uintptr_t countBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
 	
 	/**
 	 * Create a HeapMap object.
@@ -335,6 +349,7 @@ public:
 		,_heapMapBaseDelta(0)
 		,_heapMapBits(NULL)
 		,_maxHeapSize(maxHeapSize)
+		,_scanKernels(MM_HeapMapScanKernels::getKernels(MM_HeapMapScanKernels::LEVEL_SCALAR))
 	{
 		_typeId = __FUNCTION__;
 	}
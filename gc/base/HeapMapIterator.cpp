@@ -37,6 +37,7 @@ MM_HeapMapIterator::setHeapMap(MM_HeapMap *heapMap)
 
 	_heapMapSlotCurrent = (uintptr_t *) ( ((uint8_t *)heapMap->getHeapMapBits())
 		+ (MM_Math::roundToFloor(J9MODRON_HMI_HEAPMAP_ALIGNMENT, heapOffsetInBytes) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT) );
+	setHeapMapSlotTop(heapMap);
 
 	/* Cache the first heap map value ONLY if we are starting the iteration with at least 1 valid heap slot to scan */
 	if(_heapSlotCurrent < _heapChunkTop) {
@@ -58,6 +59,7 @@ MM_HeapMapIterator::reset(MM_HeapMap *heapMap, uintptr_t *heapChunkBase, uintptr
 	
 	_heapMapSlotCurrent = (uintptr_t *) ( ((uint8_t *)heapMap->getHeapMapBits())
 		+ (MM_Math::roundToFloor(J9MODRON_HMI_HEAPMAP_ALIGNMENT, heapOffsetInBytes) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT) );
+	setHeapMapSlotTop(heapMap);
 
 	/* Cache the first heap map value ONLY if we are starting the iteration with at least 1 valid heap slot to scan */
 	if(_heapSlotCurrent < _heapChunkTop) {
@@ -68,6 +70,17 @@ MM_HeapMapIterator::reset(MM_HeapMap *heapMap, uintptr_t *heapChunkBase, uintptr
 	return true;
 }
 
+void
+MM_HeapMapIterator::setHeapMapSlotTop(MM_HeapMap *heapMap)
+{
+	uintptr_t heapTopOffsetInBytes = (uintptr_t)_heapChunkTop - (uintptr_t)heapMap->getHeapBase();
+
+	/* The last heap map slot may only be partially covered by the chunk */
+	_heapMapSlotTop = (uintptr_t *) ( ((uint8_t *)heapMap->getHeapMapBits())
+		+ (MM_Math::roundToCeiling(J9MODRON_HMI_HEAPMAP_ALIGNMENT, heapTopOffsetInBytes) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT) );
+	_scanKernels = heapMap->getScanKernels();
+}
+
 omrobjectptr_t
 MM_HeapMapIterator::nextObject()
 {
@@ -126,8 +139,13 @@ MM_HeapMapIterator::nextObject()
 		/* The termination point may not be at the end of the map slot - adjust accordingly */
 		_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * (J9BITS_BITS_IN_SLOT - _bitIndexHead);
 
-		/* Move to the next mark map slot */
-		_heapMapSlotCurrent += 1;
+		/* Move to the next mark map slot, skipping a run of empty slots in bulk */
+		uintptr_t *heapMapSlotNext = _heapMapSlotCurrent + 1;
+		if ((heapMapSlotNext < _heapMapSlotTop) && (J9MODRON_HMI_SLOT_EMPTY == *heapMapSlotNext)) {
+			heapMapSlotNext = _scanKernels->findNonEmptySlot(heapMapSlotNext + 1, _heapMapSlotTop);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNext - _heapMapSlotCurrent - 1);
+		}
+		_heapMapSlotCurrent = heapMapSlotNext;
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
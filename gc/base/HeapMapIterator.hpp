@@ -50,11 +50,15 @@ private:
 	uintptr_t *_heapSlotCurrent;  /**< Current heap slot that corresponds to the heap map bit index being scanned */
 	uintptr_t *_heapChunkTop;  /**< Ending heap slot to scan */
 	uintptr_t *_heapMapSlotCurrent;  /**< Current heap map slot that contains the bits to scan for the corresponding heap */
+	uintptr_t *_heapMapSlotTop;  /**< Heap map slot following the one that contains the bit for the last heap slot to scan */
 	uintptr_t _bitIndexHead;  /**< Current bit index in heap map slot that is being scanned */
 	uintptr_t _heapMapSlotValue;  /**< Cached heap map slot value to avoid memory cache polution */
 	MM_GCExtensionsBase * const _extensions; /**< The GC extensions for the JVM */
+	const MM_HeapMapScanKernels *_scanKernels; /**< Kernels of the heap map, used to skip runs of empty heap map slots */
 	bool _useLargeObjectOptimization;	/**< Set to true if we want to read objects from the heap and determine their size in order to skip mark map bits which are inside the object.  If this is set to false, we will blindly return the addresses representing the set bits in the mark map */
 
+	void setHeapMapSlotTop(MM_HeapMap *heapMap);
+
 public:
 	omrobjectptr_t nextObject();
 
@@ -64,6 +68,7 @@ public:
 
 	MM_HeapMapIterator(MM_GCExtensionsBase *extensions, MM_HeapMap *heapMap, uintptr_t *heapChunkBase, uintptr_t *heapChunkTop, bool useLargeObjectOptimization = true)
 		: _extensions(extensions)
+		, _scanKernels(NULL)
 		, _useLargeObjectOptimization(useLargeObjectOptimization)
 	{
 		reset(heapMap, heapChunkBase, heapChunkTop);
@@ -77,9 +82,11 @@ public:
 		: _heapSlotCurrent(NULL)
 		, _heapChunkTop(NULL)
 		, _heapMapSlotCurrent(NULL)
+		, _heapMapSlotTop(NULL)
 		, _bitIndexHead(0)
 		, _heapMapSlotValue(0)
 		, _extensions(extensions)
+		, _scanKernels(NULL)
 		, _useLargeObjectOptimization(true)
 	{}
 
@@ -0,0 +1,376 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrutil.h"
+
+#include "HeapMapScanKernels.hpp"
+
+#include "Bits.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+/* The vector kernels are compiled with per-function target attributes so that the rest of the GC
+ * keeps its baseline instruction set; this needs a GNU compatible compiler and a 64-bit x86 target.
+ */
+#if defined(J9HAMMER) && defined(OMR_ENV_DATA64) && (defined(__GNUC__) || defined(__clang__))
+#define J9MODRON_HEAPMAP_SCAN_VECTOR_KERNELS
+#include <immintrin.h>
+#endif /* defined(J9HAMMER) && defined(OMR_ENV_DATA64) && (defined(__GNUC__) || defined(__clang__)) */
+
+/* Ranges of at least this many bytes are cleared with non-temporal stores. A range this large will not
+ * fit in the last level cache anyway, so there is no point in evicting the live working set to clear it;
+ * below it, plain vector stores are faster since the map is usually still cached from marking.
+ */
+#define J9MODRON_HEAPMAP_SCAN_STREAMING_THRESHOLD ((uintptr_t)(16 * 1024 * 1024))
+
+/* XCR0 state components that the operating system must save for each level */
+#define J9MODRON_HEAPMAP_SCAN_XCR0_AVX ((uint64_t)0x6)
+#define J9MODRON_HEAPMAP_SCAN_XCR0_AVX512 ((uint64_t)0xE6)
+
+static uintptr_t *
+scalarFindNonEmptySlot(uintptr_t *base, uintptr_t *top)
+{
+	uintptr_t *current = base;
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+static uintptr_t *
+scalarFindNonFullSlot(uintptr_t *base, uintptr_t *top)
+{
+	uintptr_t *current = base;
+	while ((current < top) && (UDATA_MAX == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+static uintptr_t
+scalarCountBits(uintptr_t *base, uintptr_t *top)
+{
+	uintptr_t count = 0;
+	for (uintptr_t *current = base; current < top; current++) {
+		count += MM_Bits::populationCount(*current);
+	}
+	return count;
+}
+
+static void
+scalarClearSlots(uintptr_t *base, uintptr_t *top)
+{
+	if (base < top) {
+		OMRZeroMemory((void *)base, (uintptr_t)(top - base) * sizeof(uintptr_t));
+	}
+}
+
+static const MM_HeapMapScanKernels scalarKernels = {
+	"scalar",
+	MM_HeapMapScanKernels::LEVEL_SCALAR,
+	scalarFindNonEmptySlot,
+	scalarFindNonFullSlot,
+	scalarCountBits,
+	scalarClearSlots
+};
+
+#if defined(J9MODRON_HEAPMAP_SCAN_VECTOR_KERNELS)
+
+#define J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS (sizeof(__m256i) / sizeof(uintptr_t))
+#define J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS (sizeof(__m512i) / sizeof(uintptr_t))
+
+/**
+ * Check that the operating system saves the given extended register state on context switch.
+ * Only valid once CPUID has reported OSXSAVE.
+ */
+static bool
+isExtendedStateEnabled(uint64_t xcr0Mask)
+{
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+	__asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+	uint64_t xcr0 = ((uint64_t)edx << 32) | (uint64_t)eax;
+	return xcr0Mask == (xcr0 & xcr0Mask);
+}
+
+__attribute__((target("avx2"))) static uintptr_t *
+avx2FindNonEmptySlot(uintptr_t *base, uintptr_t *top)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	uintptr_t *current = base;
+	/* test one cache line per iteration */
+	while ((uintptr_t)(top - current) >= (2 * J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS)) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)current);
+		__m256i high = _mm256_loadu_si256((const __m256i *)(current + J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS));
+		__m256i any = _mm256_or_si256(low, high);
+		if (!_mm256_testz_si256(any, any)) {
+			/* locate the first non-empty slot in the line from the per-slot comparison masks */
+			uint32_t emptyMask = (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(low, zero)))
+				| ((uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(high, zero))) << J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS);
+			return current + __builtin_ctz(~emptyMask);
+		}
+		current += 2 * J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS;
+	}
+	return scalarFindNonEmptySlot(current, top);
+}
+
+__attribute__((target("avx2"))) static uintptr_t *
+avx2FindNonFullSlot(uintptr_t *base, uintptr_t *top)
+{
+	const __m256i ones = _mm256_set1_epi64x(-1);
+	uintptr_t *current = base;
+	while ((uintptr_t)(top - current) >= (2 * J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS)) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)current);
+		__m256i high = _mm256_loadu_si256((const __m256i *)(current + J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS));
+		__m256i all = _mm256_and_si256(low, high);
+		if (!_mm256_testc_si256(all, ones)) {
+			uint32_t fullMask = (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(low, ones)))
+				| ((uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(high, ones))) << J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS);
+			return current + __builtin_ctz(~fullMask);
+		}
+		current += 2 * J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS;
+	}
+	return scalarFindNonFullSlot(current, top);
+}
+
+__attribute__((target("avx2"))) static uintptr_t
+avx2CountBits(uintptr_t *base, uintptr_t *top)
+{
+	/* Count each nibble with a 16 entry table lookup and sum the byte counts with SAD (Mula et al.) */
+	const __m256i lookup = _mm256_setr_epi8(
+		0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+		0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i lowNibbleMask = _mm256_set1_epi8(0x0F);
+	const __m256i zero = _mm256_setzero_si256();
+	__m256i total = zero;
+	uintptr_t *current = base;
+	while ((uintptr_t)(top - current) >= J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS) {
+		__m256i value = _mm256_loadu_si256((const __m256i *)current);
+		__m256i lowNibbles = _mm256_and_si256(value, lowNibbleMask);
+		__m256i highNibbles = _mm256_and_si256(_mm256_srli_epi16(value, 4), lowNibbleMask);
+		__m256i byteCounts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lowNibbles), _mm256_shuffle_epi8(lookup, highNibbles));
+		total = _mm256_add_epi64(total, _mm256_sad_epu8(byteCounts, zero));
+		current += J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS;
+	}
+	uintptr_t count = (uintptr_t)_mm256_extract_epi64(total, 0) + (uintptr_t)_mm256_extract_epi64(total, 1)
+		+ (uintptr_t)_mm256_extract_epi64(total, 2) + (uintptr_t)_mm256_extract_epi64(total, 3);
+	return count + scalarCountBits(current, top);
+}
+
+__attribute__((target("avx2"))) static void
+avx2ClearSlots(uintptr_t *base, uintptr_t *top)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	uintptr_t *current = base;
+	if (((uintptr_t)(top - current) * sizeof(uintptr_t)) >= J9MODRON_HEAPMAP_SCAN_STREAMING_THRESHOLD) {
+		/* non-temporal stores must be aligned to the vector size */
+		while (0 != ((uintptr_t)current & (sizeof(__m256i) - 1))) {
+			*current = 0;
+			current += 1;
+		}
+		while ((uintptr_t)(top - current) >= J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS) {
+			_mm256_stream_si256((__m256i *)current, zero);
+			current += J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS;
+		}
+		/* order the streaming stores before anything that publishes the cleared map */
+		_mm_sfence();
+	} else {
+		while ((uintptr_t)(top - current) >= J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS) {
+			_mm256_storeu_si256((__m256i *)current, zero);
+			current += J9MODRON_HEAPMAP_SCAN_AVX2_SLOTS;
+		}
+	}
+	while (current < top) {
+		*current = 0;
+		current += 1;
+	}
+}
+
+static const MM_HeapMapScanKernels avx2Kernels = {
+	"avx2",
+	MM_HeapMapScanKernels::LEVEL_AVX2,
+	avx2FindNonEmptySlot,
+	avx2FindNonFullSlot,
+	avx2CountBits,
+	avx2ClearSlots
+};
+
+__attribute__((target("avx512f,avx512bw"))) static uintptr_t *
+avx512FindNonEmptySlot(uintptr_t *base, uintptr_t *top)
+{
+	uintptr_t *current = base;
+	/* test two cache lines per iteration */
+	while ((uintptr_t)(top - current) >= (2 * J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS)) {
+		__m512i low = _mm512_loadu_si512((const void *)current);
+		__m512i high = _mm512_loadu_si512((const void *)(current + J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS));
+		__m512i any = _mm512_or_si512(low, high);
+		if (0 != _mm512_test_epi64_mask(any, any)) {
+			uint32_t nonEmptyMask = (uint32_t)_mm512_test_epi64_mask(low, low)
+				| ((uint32_t)_mm512_test_epi64_mask(high, high) << J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS);
+			return current + __builtin_ctz(nonEmptyMask);
+		}
+		current += 2 * J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS;
+	}
+	return scalarFindNonEmptySlot(current, top);
+}
+
+__attribute__((target("avx512f,avx512bw"))) static uintptr_t *
+avx512FindNonFullSlot(uintptr_t *base, uintptr_t *top)
+{
+	const __m512i ones = _mm512_set1_epi64(-1);
+	uintptr_t *current = base;
+	while ((uintptr_t)(top - current) >= (2 * J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS)) {
+		__m512i low = _mm512_loadu_si512((const void *)current);
+		__m512i high = _mm512_loadu_si512((const void *)(current + J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS));
+		__m512i all = _mm512_and_si512(low, high);
+		if (0 != _mm512_cmpneq_epi64_mask(all, ones)) {
+			uint32_t nonFullMask = (uint32_t)_mm512_cmpneq_epi64_mask(low, ones)
+				| ((uint32_t)_mm512_cmpneq_epi64_mask(high, ones) << J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS);
+			return current + __builtin_ctz(nonFullMask);
+		}
+		current += 2 * J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS;
+	}
+	return scalarFindNonFullSlot(current, top);
+}
+
+__attribute__((target("avx512f,avx512bw"))) static uintptr_t
+avx512CountBits(uintptr_t *base, uintptr_t *top)
+{
+	/* Same nibble lookup as the AVX2 kernel; VPOPCNTQ is not assumed since few processors implement it */
+	const __m512i lookup = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+	const __m512i lowNibbleMask = _mm512_set1_epi8(0x0F);
+	const __m512i zero = _mm512_setzero_si512();
+	__m512i total = zero;
+	uintptr_t *current = base;
+	while ((uintptr_t)(top - current) >= J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS) {
+		__m512i value = _mm512_loadu_si512((const void *)current);
+		__m512i lowNibbles = _mm512_and_si512(value, lowNibbleMask);
+		__m512i highNibbles = _mm512_and_si512(_mm512_srli_epi16(value, 4), lowNibbleMask);
+		__m512i byteCounts = _mm512_add_epi8(_mm512_shuffle_epi8(lookup, lowNibbles), _mm512_shuffle_epi8(lookup, highNibbles));
+		total = _mm512_add_epi64(total, _mm512_sad_epu8(byteCounts, zero));
+		current += J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS;
+	}
+	return (uintptr_t)_mm512_reduce_add_epi64(total) + scalarCountBits(current, top);
+}
+
+__attribute__((target("avx512f,avx512bw"))) static void
+avx512ClearSlots(uintptr_t *base, uintptr_t *top)
+{
+	const __m512i zero = _mm512_setzero_si512();
+	uintptr_t *current = base;
+	if (((uintptr_t)(top - current) * sizeof(uintptr_t)) >= J9MODRON_HEAPMAP_SCAN_STREAMING_THRESHOLD) {
+		while (0 != ((uintptr_t)current & (sizeof(__m512i) - 1))) {
+			*current = 0;
+			current += 1;
+		}
+		while ((uintptr_t)(top - current) >= J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS) {
+			_mm512_stream_si512((__m512i *)current, zero);
+			current += J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS;
+		}
+		_mm_sfence();
+	} else {
+		while ((uintptr_t)(top - current) >= J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS) {
+			_mm512_storeu_si512((void *)current, zero);
+			current += J9MODRON_HEAPMAP_SCAN_AVX512_SLOTS;
+		}
+	}
+	while (current < top) {
+		*current = 0;
+		current += 1;
+	}
+}
+
+static const MM_HeapMapScanKernels avx512Kernels = {
+	"avx512",
+	MM_HeapMapScanKernels::LEVEL_AVX512,
+	avx512FindNonEmptySlot,
+	avx512FindNonFullSlot,
+	avx512CountBits,
+	avx512ClearSlots
+};
+
+#endif /* defined(J9MODRON_HEAPMAP_SCAN_VECTOR_KERNELS) */
+
+const MM_HeapMapScanKernels *
+MM_HeapMapScanKernels::getKernels(Level level)
+{
+	const MM_HeapMapScanKernels *kernels = NULL;
+
+	switch (level) {
+	case LEVEL_SCALAR:
+		kernels = &scalarKernels;
+		break;
+#if defined(J9MODRON_HEAPMAP_SCAN_VECTOR_KERNELS)
+	case LEVEL_AVX2:
+		kernels = &avx2Kernels;
+		break;
+	case LEVEL_AVX512:
+		kernels = &avx512Kernels;
+		break;
+#endif /* defined(J9MODRON_HEAPMAP_SCAN_VECTOR_KERNELS) */
+	default:
+		break;
+	}
+
+	return kernels;
+}
+
+MM_HeapMapScanKernels::Level
+MM_HeapMapScanKernels::getSupportedLevel(OMRPortLibrary *portLibrary)
+{
+	Level level = LEVEL_SCALAR;
+
+#if defined(J9MODRON_HEAPMAP_SCAN_VECTOR_KERNELS)
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRProcessorDesc processorDescription;
+
+	if ((0 == omrsysinfo_get_processor_description(&processorDescription))
+		&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_OSXSAVE)
+	) {
+		if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX2)
+			&& isExtendedStateEnabled(J9MODRON_HEAPMAP_SCAN_XCR0_AVX)
+		) {
+			level = LEVEL_AVX2;
+
+			if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX512F)
+				&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX512BW)
+				&& isExtendedStateEnabled(J9MODRON_HEAPMAP_SCAN_XCR0_AVX512)
+			) {
+				level = LEVEL_AVX512;
+			}
+		}
+	}
+#endif /* defined(J9MODRON_HEAPMAP_SCAN_VECTOR_KERNELS) */
+
+	return level;
+}
+
+const MM_HeapMapScanKernels *
+MM_HeapMapScanKernels::selectKernels(MM_EnvironmentBase *env)
+{
+	Level level = LEVEL_SCALAR;
+	if (env->getExtensions()->heapMapSIMDScanning) {
+		level = getSupportedLevel(env->getPortLibrary());
+	}
+	return getKernels(level);
+}
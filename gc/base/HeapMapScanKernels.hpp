@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HEAPMAPSCANKERNELS_HPP_)
+#define HEAPMAPSCANKERNELS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+
+class MM_EnvironmentBase;
+
+/**
+ * Bulk operations over runs of heap map slots.
+ *
+ * Walking the heap map one slot at a time dominates sweep and heap map iteration on large, sparsely
+ * marked heaps. A kernel set implements the operations that scan or write long runs of slots; the scalar
+ * set is always available and the vector sets are selected at startup from the processor features
+ * reported by the port library.
+ *
+ * All ranges are half open, [base, top), and expressed in heap map slots. Kernels never read or write
+ * outside of the range.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapMapScanKernels
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum Level {
+		LEVEL_SCALAR = 0, /**< portable implementation */
+		LEVEL_AVX2, /**< 256 bit x86 vector implementation */
+		LEVEL_AVX512, /**< 512 bit x86 vector implementation (requires AVX-512 F and BW) */
+		LEVEL_COUNT
+	};
+
+	typedef uintptr_t *(*FindSlotFunction)(uintptr_t *base, uintptr_t *top);
+	typedef uintptr_t (*CountBitsFunction)(uintptr_t *base, uintptr_t *top);
+	typedef void (*ClearSlotsFunction)(uintptr_t *base, uintptr_t *top);
+
+	const char *name; /**< name of the kernel set, as reported in verbose output */
+	Level level; /**< the instruction set level implemented by this kernel set */
+	FindSlotFunction findNonEmptySlot; /**< returns the first slot with any bit set, or top if the range is empty */
+	FindSlotFunction findNonFullSlot; /**< returns the first slot with any bit clear, or top if the range is full */
+	CountBitsFunction countBits; /**< returns the number of bits set in the range */
+	ClearSlotsFunction clearSlots; /**< clears every bit in the range */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Fetch the kernel set for a given level.
+	 * @param level[in] the requested level
+	 * @return the kernel set, or NULL if the level was not built for this platform
+	 */
+	static const MM_HeapMapScanKernels *getKernels(Level level);
+
+	/**
+	 * Determine the highest level supported by both the processor and the operating system.
+	 * @param portLibrary[in] the port library used to query processor features
+	 * @return the highest supported level
+	 */
+	static Level getSupportedLevel(OMRPortLibrary *portLibrary);
+
+	/**
+	 * Select the kernel set the GC should use, honouring the heapMapSIMDScanning option.
+	 * @param env[in] the current thread
+	 * @return the kernel set to use
+	 */
+	static const MM_HeapMapScanKernels *selectKernels(MM_EnvironmentBase *env);
+};
+
+#endif /* HEAPMAPSCANKERNELS_HPP_ */
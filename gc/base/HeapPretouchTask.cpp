@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "HeapPretouchTask.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMapScanKernels.hpp"
+#include "HeapResizeStats.hpp"
+#include "ParallelDispatcher.hpp"
+
+void
+MM_HeapPretouchTask::run(MM_EnvironmentBase *env)
+{
+	uintptr_t unitSlots = HEAP_PRETOUCH_WORK_UNIT_SIZE / sizeof(uintptr_t);
+	for (uintptr_t *unitBase = _base; unitBase < _top; unitBase += OMR_MIN(unitSlots, (uintptr_t)(_top - unitBase))) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			_kernels->clearSlots(unitBase, unitBase + OMR_MIN(unitSlots, (uintptr_t)(_top - unitBase)));
+		}
+	}
+}
+
+void
+MM_HeapPretouchTask::pretouch(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (!extensions->heapPretouch || (lowAddress >= highAddress)) {
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	const MM_HeapMapScanKernels *kernels = MM_HeapMapScanKernels::selectKernels(env);
+	MM_ParallelDispatcher *dispatcher = extensions->dispatcher;
+	uintptr_t size = (uintptr_t)highAddress - (uintptr_t)lowAddress;
+	uint64_t startTime = omrtime_hires_clock();
+
+	/* a thread already running a task (a scavenger expanding tenure, for example) cannot dispatch another one */
+	if ((NULL != dispatcher) && (NULL == env->_currentTask) && (1 < dispatcher->threadCount()) && (HEAP_PRETOUCH_WORK_UNIT_SIZE < size)) {
+		MM_HeapPretouchTask pretouchTask(env, dispatcher, lowAddress, highAddress, kernels);
+		dispatcher->run(env, &pretouchTask, OMR_MIN(dispatcher->threadCount(), size / HEAP_PRETOUCH_WORK_UNIT_SIZE));
+	} else {
+		kernels->clearSlots((uintptr_t *)lowAddress, (uintptr_t *)highAddress);
+	}
+
+	extensions->heap->getResizeStats()->addPretouch(omrtime_hires_clock() - startTime, size);
+}
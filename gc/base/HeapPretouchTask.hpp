@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HEAPPRETOUCHTASK_HPP_)
+#define HEAPPRETOUCHTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "ParallelTask.hpp"
+
+class MM_EnvironmentBase;
+class MM_HeapMapScanKernels;
+class MM_ParallelDispatcher;
+
+/* Bytes of newly committed heap faulted in as one unit of work */
+#define HEAP_PRETOUCH_WORK_UNIT_SIZE ((uintptr_t)2 * 1024 * 1024)
+
+/**
+ * Fault in and zero a newly committed heap range before it is handed to the memory pools, so that the
+ * page faults are taken by the GC threads rather than by the first mutators to allocate from it.
+ * The range is written with the bulk clear kernel, which uses non-temporal stores for large ranges.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapPretouchTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t *_base; /**< first word of the range */
+	uintptr_t *_top; /**< word following the range */
+	const MM_HeapMapScanKernels *_kernels; /**< kernels used to write the range */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PERFORM_RESIZE; }
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * Pre-touch a newly committed range, in parallel when the calling thread can dispatch GC threads.
+	 * Does nothing unless the heapPretouch option is set. The time spent is recorded in the heap resize stats.
+	 * @param lowAddress[in] base of the range
+	 * @param highAddress[in] top (non-inclusive) of the range
+	 */
+	static void pretouch(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Create a HeapPretouchTask object.
+	 */
+	MM_HeapPretouchTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, void *lowAddress, void *highAddress, const MM_HeapMapScanKernels *kernels)
+		: MM_ParallelTask(env, dispatcher)
+		, _base((uintptr_t *)lowAddress)
+		, _top((uintptr_t *)highAddress)
+		, _kernels(kernels)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* HEAPPRETOUCHTASK_HPP_ */
@@ -294,6 +294,29 @@ MM_HeapSplit::decommitMemory(void *address, uintptr_t size, void *lowValidAddres
 	return success;
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+/**
+ * Release the physical memory behind a free address range, leaving it committed.
+ * Unlike decommit, the range may lie anywhere within one of the extents.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_HeapSplit::releaseMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	bool success = false;
+
+	if ((_lowExtent->getHeapBase() <= address) && (address < _lowExtent->getHeapTop())) {
+		success = _lowExtent->releaseMemory(address, size, lowValidAddress, highValidAddress);
+	} else if ((_highExtent->getHeapBase() <= address) && (address < _highExtent->getHeapTop())) {
+		success = _highExtent->releaseMemory(address, size, lowValidAddress, highValidAddress);
+	} else {
+		/* This is neither range so fail */
+		Assert_MM_true(false);
+	}
+	return success;
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 
 /**
  * Calculate the offset of an address from the base of the heap.
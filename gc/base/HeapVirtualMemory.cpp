@@ -342,6 +342,20 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+/**
+ * Release the physical memory behind a free address range, leaving it committed.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_HeapVirtualMemory::releaseMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	return memoryManager->releaseMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
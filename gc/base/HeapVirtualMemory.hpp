@@ -68,6 +68,9 @@ public:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	virtual bool releaseMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 	virtual uintptr_t calculateOffsetFromHeapBase(void* address);
 
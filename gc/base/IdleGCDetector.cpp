@@ -0,0 +1,213 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "IdleGCDetector.hpp"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapResizeStats.hpp"
+
+extern "C" {
+
+/**
+ * Idle detector thread procedure
+ *
+ * @parm info Address of the MM_IdleGCDetector
+ */
+static int J9THREAD_PROC
+idle_gc_detector_thread_proc(void *info)
+{
+	MM_IdleGCDetector *detector = (MM_IdleGCDetector *)info;
+	OMR_VMThread *omrThread = MM_EnvironmentBase::attachVMThread(detector->getExtensions()->getOmrVM(), "Idle GC Detector");
+	detector->threadStarted(NULL != omrThread);
+	if (NULL != omrThread) {
+		detector->threadEntryPoint(omrThread);
+	}
+
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_IdleGCDetector *
+MM_IdleGCDetector::newInstance(MM_EnvironmentBase *env)
+{
+	MM_IdleGCDetector *detector = (MM_IdleGCDetector *)env->getForge()->allocate(sizeof(MM_IdleGCDetector), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != detector) {
+		new(detector) MM_IdleGCDetector(env);
+		if (!detector->initialize(env)) {
+			detector->kill(env);
+			detector = NULL;
+		}
+	}
+	return detector;
+}
+
+void
+MM_IdleGCDetector::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_IdleGCDetector::initialize(MM_EnvironmentBase *env)
+{
+	return 0 == omrthread_monitor_init_with_name(&_monitor, 0, "MM_IdleGCDetector");
+}
+
+void
+MM_IdleGCDetector::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+bool
+MM_IdleGCDetector::startup(MM_GCExtensionsBase *extensions)
+{
+	omrthread_t thread = NULL;
+
+	omrthread_monitor_enter(_monitor);
+	intptr_t threadForkResult = createThreadWithCategory(&thread,
+						OMR_OS_STACK_SIZE,
+						J9THREAD_PRIORITY_MIN,
+						0,
+						idle_gc_detector_thread_proc,
+						(void *)this,
+						J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == threadForkResult) {
+		while (!_started && !_terminated) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return _started;
+}
+
+void
+MM_IdleGCDetector::shutdown(MM_GCExtensionsBase *extensions)
+{
+	if (_started) {
+		omrthread_monitor_enter(_monitor);
+		_shutdownRequested = true;
+		omrthread_monitor_notify_all(_monitor);
+		while (!_terminated) {
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+/**
+ * Signal the thread starting the detector that the detector thread has attached (or failed to).
+ */
+void
+MM_IdleGCDetector::threadStarted(bool attached)
+{
+	omrthread_monitor_enter(_monitor);
+	if (attached) {
+		_started = true;
+	} else {
+		_terminated = true;
+	}
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+}
+
+/**
+ * Start an idle collection if nothing has been allocated for gcOnIdleDelay milliseconds.
+ * @return milliseconds to wait before checking again
+ */
+uint64_t
+MM_IdleGCDetector::checkIdle(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t delay = _extensions->gcOnIdleDelay;
+	uintptr_t activityCount = _extensions->allocationActivityCount;
+	uint64_t now = omrtime_hires_clock();
+
+	if (activityCount != _lastActivityCount) {
+		_lastActivityCount = activityCount;
+		_lastActivityTime = now;
+		_idleCollected = false;
+	}
+
+	/* nothing to do until the application allocates again after the previous idle collection */
+	if (!_idleCollected) {
+		uint64_t idleTime = omrtime_hires_delta(_lastActivityTime, now, OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+		if (idleTime < delay) {
+			delay -= idleTime;
+		} else {
+			/* like any thread requesting a collection, the detector must hold VM access */
+			env->acquireVMAccess();
+			_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
+			env->releaseVMAccess();
+			_lastActivityCount = _extensions->allocationActivityCount;
+			_idleCollected = true;
+		}
+	}
+
+	return delay;
+}
+
+void
+MM_IdleGCDetector::threadEntryPoint(OMR_VMThread *omrThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	/* an application which never allocates after startup is idle from then on */
+	_lastActivityCount = _extensions->allocationActivityCount;
+	_lastActivityTime = omrtime_hires_clock();
+
+	omrthread_monitor_enter(_monitor);
+	while (!_shutdownRequested) {
+		omrthread_monitor_exit(_monitor);
+		uint64_t waitMillis = checkIdle(env);
+		omrthread_monitor_enter(_monitor);
+		if (!_shutdownRequested) {
+			omrthread_monitor_wait_timed(_monitor, (int64_t)OMR_MAX(waitMillis, 1), 0);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrThread);
+
+	omrthread_monitor_enter(_monitor);
+	_terminated = true;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(IDLEGCDETECTOR_HPP_)
+#define IDLEGCDETECTOR_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+class MM_GCExtensionsBase;
+
+/**
+ * Background thread which starts an idle collection once no mutator has taken memory from the heap
+ * (refreshed a TLH or allocated outside one) for gcOnIdleDelay milliseconds. The collection compacts
+ * the heap (with compactOnIdle) and releases the free pages to the operating system, as for a
+ * J9MMCONSTANT_EXPLICIT_GC_IDLE_GC system collection.
+ *
+ * Allocation is sampled from MM_GCExtensionsBase::allocationActivityCount at every check, so the
+ * collection starts between gcOnIdleDelay and twice that after the last allocation, without the
+ * allocation paths reading a clock. At most one idle collection runs per period of inactivity: after
+ * it, the detector waits for the next allocation before it starts timing again. The thread runs at
+ * minimum priority and holds VM access only while it collects, like any thread requesting a
+ * collection, so the runtime must make its mutators hold VM access while they touch the heap.
+ * @ingroup GC_Base_Core
+ */
+class MM_IdleGCDetector : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _monitor; /**< protects the state below, and is waited on between checks */
+	volatile bool _started; /**< the detector thread is attached */
+	volatile bool _shutdownRequested;
+	volatile bool _terminated; /**< the detector thread has detached */
+	uintptr_t _lastActivityCount; /**< allocation activity count seen by the last check */
+	uint64_t _lastActivityTime; /**< time the allocation activity count was first seen at its current value */
+	bool _idleCollected; /**< an idle collection ran and nothing was allocated since */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	uint64_t checkIdle(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_IdleGCDetector *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the detector thread.
+	 * @return true if the thread was started and attached, false otherwise
+	 */
+	bool startup(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Ask the detector thread to terminate, and wait for it to do so.
+	 */
+	void shutdown(MM_GCExtensionsBase *extensions);
+
+	MMINLINE MM_GCExtensionsBase *getExtensions() { return _extensions; }
+
+	void threadEntryPoint(OMR_VMThread *omrThread);
+	void threadStarted(bool attached);
+
+	/**
+	 * Create an IdleGCDetector object.
+	 */
+	MM_IdleGCDetector(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _monitor(NULL)
+		, _started(false)
+		, _shutdownRequested(false)
+		, _terminated(false)
+		, _lastActivityCount(0)
+		, _lastActivityTime(0)
+		, _idleCollected(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
+#endif /* IDLEGCDETECTOR_HPP_ */
@@ -30,12 +30,15 @@
 #include "ConcurrentGC.hpp"
 #include "ConcurrentGCStats.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#include "ClassHistogramTask.hpp"
 #include "Configuration.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
+#include "OMRVMThreadListIterator.hpp"
+#include "ParallelDispatcher.hpp"
 #include "Task.hpp"
 #if defined(OMR_GC_REALTIME)
 #include "WorkPacketsSATB.hpp"
@@ -246,6 +249,26 @@ MM_MarkingScheme::markObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr,
 	return inlineMarkObject(env, objectPtr, leafType);
 }
 
+void
+MM_MarkingScheme::takeClassHistogram(MM_EnvironmentBase *env, MM_ClassHistogram *histogram)
+{
+	OMR_VMThread *vmThread = NULL;
+
+	MM_ClassHistogramTask histogramTask(env, _extensions->dispatcher, this);
+	_extensions->dispatcher->run(env, &histogramTask);
+
+	/* the threads which ran the task need not be the first ones attached, so drain every thread */
+	omrthread_monitor_enter(env->getOmrVM()->_vmThreadListMutex);
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	while (NULL != (vmThread = threadListIterator.nextOMRVMThread())) {
+		MM_ClassHistogram *threadHistogram = MM_EnvironmentBase::getEnvironment(vmThread)->_markClassHistogram;
+		if (NULL != threadHistogram) {
+			histogram->drain(threadHistogram);
+		}
+	}
+	omrthread_monitor_exit(env->getOmrVM()->_vmThreadListMutex);
+}
+
 /**************************************************************************
  * name        -  numMarkBitsInRange
  *
@@ -393,11 +416,12 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env)
 	MM_WorkPackets *workPackets = NULL;
 	if (_extensions->isConcurrentMarkEnabled()) {
 		if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
-#if defined(OMR_GC_REALTIME)
+#if defined(OMR_GC_REALTIME) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
+			/* the SATB work packets are built with the concurrent mark sources */
 			MM_WorkPacketsSATB *workPacketsSATB = MM_WorkPacketsSATB::newInstance(env);
 			_extensions->sATBBarrierRememberedSet = MM_RememberedSetSATB::newInstance(env, workPacketsSATB);
 			workPackets = workPacketsSATB;
-#endif /* defined(OMR_GC_REALTIME) */
+#endif /* defined(OMR_GC_REALTIME) && defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 		} else {
 #if defined OMR_GC_MODRON_CONCURRENT_MARK
 			workPackets = MM_WorkPacketsConcurrent::newInstance(env);
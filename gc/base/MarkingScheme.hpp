@@ -28,6 +28,7 @@
 #include "omrgcconsts.h"
 
 #include "BaseVirtual.hpp"
+#include "ClassHistogram.hpp"
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -205,6 +206,26 @@ public:
 		return marked;
 	}
 
+	/**
+	 * Count a marked object into the class histogram of the calling thread (markingClassHistogram only).
+	 * @param[in] env calling thread environment
+	 * @param[in] objectPtr the marked object
+	 */
+	MMINLINE void
+	countObjectByClass(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		env->_markClassHistogram->add(_delegate.getClassHistogramKey(env, objectPtr), 1, _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+	}
+
+	/**
+	 * Take the class histogram of every object the completed mark left marked, including objects premarked or
+	 * allocated marked during a concurrent mark, on the GC threads (markingClassHistogram only). Marking does
+	 * no counting, so the census costs one pass over the mark map, and nothing when it is disabled.
+	 * @param[in] env main GC thread environment, able to dispatch a task
+	 * @param[in] histogram the histogram to add the census to
+	 */
+	void takeClassHistogram(MM_EnvironmentBase *env, MM_ClassHistogram *histogram);
+
 	uintptr_t numMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop);
 	uintptr_t setMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop, bool clear);
 	uintptr_t numHeapBytesPerMarkMapByte() { return (_markMap->getObjectGrain() * BITS_PER_BYTE); };
@@ -73,6 +73,38 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	uintptr_t pageFlags = extensions->requestedPageFlags;
 	Assert_MM_true(0 != pageSize);
 
+	switch (extensions->heapHugePagePolicy) {
+	case MM_GCExtensionsBase::HUGE_PAGE_POLICY_OFF:
+	{
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		mode |= OMRPORT_VMEM_MEMORY_MODE_NO_HUGEPAGE;
+		pageSize = omrvmem_supported_page_sizes()[0];
+		pageFlags = omrvmem_supported_page_flags()[0];
+		break;
+	}
+	case MM_GCExtensionsBase::HUGE_PAGE_POLICY_TRANSPARENT:
+		mode |= OMRPORT_VMEM_MEMORY_MODE_ADVISE_HUGEPAGE;
+		break;
+	case MM_GCExtensionsBase::HUGE_PAGE_POLICY_EXPLICIT:
+	{
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uintptr_t largePageSize = 0;
+		uintptr_t largePageFlags = OMRPORT_VMEM_PAGE_FLAG_NOT_USED;
+		/* no large page size is returned if the system has no huge page pool; the default pages are kept */
+		omrvmem_default_large_page_size_ex(mode, &largePageSize, &largePageFlags);
+		if (largePageSize > pageSize) {
+			pageSize = largePageSize;
+			pageFlags = largePageFlags;
+		}
+		break;
+	}
+	case MM_GCExtensionsBase::HUGE_PAGE_POLICY_DEFAULT:
+	default:
+		break;
+	}
+	extensions->requestedPageSize = pageSize;
+	extensions->requestedPageFlags = pageFlags;
+
 	uintptr_t allocateSize = size;
 
 	uintptr_t concurrentScavengerPageSize = 0;
@@ -605,6 +637,17 @@ MM_MemoryManager::decommitMemory(MM_MemoryHandle* handle, void* address, uintptr
 	return memory->decommitMemory(address, size, lowValidAddress, highValidAddress);
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+bool
+MM_MemoryManager::releaseMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	Assert_MM_true(NULL != handle);
+	MM_VirtualMemory* memory = handle->getVirtualMemory();
+	Assert_MM_true(NULL != memory);
+	return memory->releaseMemory(address, size, lowValidAddress, highValidAddress);
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 bool
 MM_MemoryManager::isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize)
 {
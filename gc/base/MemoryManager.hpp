@@ -234,6 +234,21 @@ public:
 	 */
 	bool decommitMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Release the physical storage behind a range of specified virtual memory instance, leaving it committed.
+	 * The contents of the range are undefined afterwards.
+	 *
+	 * @param pointer to memory handle
+	 * @param address start address of memory should be released
+	 * @param size size of memory should be released
+	 * @param lowValidAddress
+	 * @param highValidAddress
+	 * @return true if succeed
+	 */
+	bool releaseMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 #if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
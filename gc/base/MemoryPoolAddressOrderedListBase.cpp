@@ -209,9 +209,9 @@ MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentB
 				decommitPagesCount = totalFreePagesCount - commitPagesCount;
 				/* leave commited pages of memory aside header */
 				addressBase += commitPagesCount * pageSize;
-				/* now decommit pages of memory */
+				/* now release pages of memory; they stay committed, so the free entry can be reused without expanding */
 				if (0 < decommitPagesCount) {
-					if (_extensions->heap->decommitMemory((void*)addressBase, decommitPagesCount * pageSize, NULL, currentFreeEntry->afterEnd())) {
+					if (_extensions->heap->releaseMemory((void*)addressBase, decommitPagesCount * pageSize, NULL, currentFreeEntry->afterEnd())) {
 						releasedMemory += decommitPagesCount * pageSize;
 					}
 				}
@@ -942,6 +942,14 @@ MM_MemorySubSpace::systemGarbageCollect(MM_EnvironmentBase* env, uint32_t gcCode
 			uint64_t startTime = omrtime_hires_clock();
 			uintptr_t releasedBytes = _extensions->heap->getDefaultMemorySpace()->releaseFreeMemoryPages(env);
 			uint64_t endTime = omrtime_hires_clock();
+			/* lazily freed pages stay resident until the operating system needs them, so they are not counted as returned */
+			if (_extensions->gcOnIdleReleaseLazily) {
+				_extensions->heap->getResizeStats()->setLastReleasedBytes(0);
+				_extensions->heap->getResizeStats()->setLastLazilyFreedBytes(releasedBytes);
+			} else {
+				_extensions->heap->getResizeStats()->setLastReleasedBytes(releasedBytes);
+				_extensions->heap->getResizeStats()->setLastLazilyFreedBytes(0);
+			}
 			TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
 				_extensions->privateHookInterface,
 				env->getOmrVMThread(),
@@ -1225,6 +1233,7 @@ MM_MemorySubSpace::expand(MM_EnvironmentBase* env, uintptr_t expandSize)
 		return 0;
 	}
 
+	_extensions->heap->getResizeStats()->resetLastPretouch();
 	timeStart = omrtime_hires_clock();
 	/* Expand the sub arena by as much as we can up to the desrired amount */
 	uintptr_t alignedExpandSize = MM_Math::roundToCeiling(_extensions->heapAlignment, expandSize);
@@ -1826,6 +1835,7 @@ MM_MemorySubSpace::runEnqueuedCounterBalancing(MM_EnvironmentBase* env)
 			uintptr_t expandSize;
 			uint64_t timeStart, timeEnd;
 
+			_extensions->heap->getResizeStats()->resetLastPretouch();
 			timeStart = omrtime_hires_clock();
 			expandSize = _physicalSubArena->expandNoCheck(env, _counterBalanceSize);
 			timeEnd = omrtime_hires_clock();
@@ -28,6 +28,8 @@
 #include "AllocateDescription.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "Heap.hpp"
+#include "HeapSizingForecast.hpp"
 #include "PhysicalSubArena.hpp"
 #include "MemorySpace.hpp"
 
@@ -95,8 +97,10 @@ void
 MM_MemorySubSpaceUniSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool _systemGC)
 {
 	uintptr_t oldVMState = env->pushVMstate(OMRVMSTATE_GC_CHECK_RESIZE);
-	if (!timeForHeapContract(env, allocDescription, _systemGC)) {
-		timeForHeapExpand(env, allocDescription);
+	if (!_extensions->heapSizingForecast || !timeForHeapResizeFromForecast(env, allocDescription, _systemGC)) {
+		if (!timeForHeapContract(env, allocDescription, _systemGC)) {
+			timeForHeapExpand(env, allocDescription);
+		}
 	}
 	env->popVMstate(oldVMState);
 }
@@ -350,6 +354,84 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 	return true;
 }
 
+/**
+ * Determine how much we should expand or contract the subspace by to reach the heap size forecast to
+ * spend heapSizingGCOverheadTarget percent of the time in global collections, and store the result in
+ * _expansionSize or _contractionSize.
+ * The free ratio heuristics are left to decide when the forecast is not ready yet, when the pending
+ * allocation cannot be satisfied or when the heap is above the softmx.
+ * @return true if the forecast decided the resize (which may be none)
+ */
+bool
+MM_MemorySubSpaceUniSpace::timeForHeapResizeFromForecast(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool systemGC)
+{
+	MM_Heap *heap = _extensions->heap;
+	MM_HeapSizingForecast *forecast = heap->getSizingForecast();
+
+	if ((NULL == _physicalSubArena) || !forecast->isReady()) {
+		return false;
+	}
+
+	uintptr_t allocSize = 0;
+	if (NULL != allocDescription) {
+		allocSize = allocDescription->getBytesRequested();
+		/* MS in allocDescription may be NULL so get from env */
+		if (env->getMemorySpace()->findLargestFreeEntry(env, allocDescription) < allocSize) {
+			return false;
+		}
+	}
+
+	uintptr_t currentSize = getActiveMemorySize();
+	uintptr_t actualSoftMx = heap->getActualSoftMxSize(env);
+	if ((0 != actualSoftMx) && (actualSoftMx < currentSize)) {
+		return false;
+	}
+
+	uintptr_t currentFree = getApproximateActiveFreeMemorySize();
+	uintptr_t liveBytes = (currentSize > currentFree) ? (currentSize - currentFree) : 0;
+	uintptr_t targetSize = forecast->calculateTargetSize(liveBytes + allocSize, _extensions->heapSizingGCOverheadTarget);
+	targetSize = MM_Math::roundToCeiling(_extensions->regionSize, MM_Math::roundToCeiling(_extensions->heapAlignment, targetSize));
+
+	uintptr_t gcCount = 0;
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	gcCount = _extensions->globalGCStats.gcCount;
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+	uintptr_t lastExpansionGCCount = heap->getResizeStats()->getLastHeapExpansionGCCount();
+
+	_expansionSize = 0;
+	_contractionSize = 0;
+
+	if (targetSize > currentSize) {
+		if (_physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))
+			&& ((lastExpansionGCCount + _extensions->heapExpansionStabilizationCount) <= gcCount)
+		) {
+			uintptr_t expandSize = adjustExpansionWithinFreeLimits(env, targetSize - currentSize);
+			expandSize = adjustExpansionWithinUserIncrement(env, expandSize);
+			_expansionSize = adjustExpansionWithinSoftMax(env, expandSize, 0);
+			if (0 != _expansionSize) {
+				heap->getResizeStats()->setLastExpandReason(FORECAST_GC_OVERHEAD_TOO_HIGH);
+			}
+		}
+	} else if (!systemGC && _physicalSubArena->canContract(env) && (0 != maxContraction(env))
+		&& ((lastExpansionGCCount + _extensions->heapContractionStabilizationCount) <= gcCount)
+	) {
+		/* explicit collections say nothing about the allocation rate, so only contract on implicit ones,
+		 * and as with the free ratio heuristics, neither too quickly nor by a trivial amount
+		 */
+		uintptr_t contractionGranule = _extensions->regionSize;
+		uintptr_t maxContract = (uintptr_t)(currentSize * _extensions->globalMaximumContraction);
+		uintptr_t minContract = (uintptr_t)(currentSize * _extensions->globalMinimumContraction);
+		maxContract = OMR_MAX(contractionGranule, MM_Math::roundToCeiling(contractionGranule, maxContract));
+
+		uintptr_t contractionSize = MM_Math::roundToFloor(contractionGranule, OMR_MIN(currentSize - targetSize, maxContract));
+		if ((0 != contractionSize) && (contractionSize >= minContract)) {
+			_contractionSize = contractionSize;
+			heap->getResizeStats()->setLastContractReason(FORECAST_GC_OVERHEAD_TOO_LOW);
+		}
+	}
+
+	return true;
+}
 
 /**
  * Determine the amount of heap to contract.
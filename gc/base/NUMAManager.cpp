@@ -213,6 +213,19 @@ MM_NUMAManager::getMaximumNodeNumber() const
 	return _maximumNodeNumber;
 }
 
+uintptr_t
+MM_NUMAManager::getSublistsPerNode(uintptr_t sublistCount) const
+{
+	uintptr_t sublistsPerNode = 0;
+
+	/* an uneven split would leave some node sharing its sublists with another */
+	if ((1 < _affinityLeaderCount) && (0 == (sublistCount % _affinityLeaderCount))) {
+		sublistsPerNode = sublistCount / _affinityLeaderCount;
+	}
+
+	return sublistsPerNode;
+}
+
 J9MemoryNodeDetail const*
 MM_NUMAManager::getAffinityLeaders(uintptr_t *arrayLength) const
 {
@@ -141,6 +141,36 @@ public:
 	 */
 	bool isPhysicalNUMASupported() const;
 
+	/**
+	 * Determine how a set of work sublists should be divided between the affinity leaders.
+	 * @param sublistCount[in] The number of sublists being divided
+	 * @return The number of sublists reserved for each node, or 0 if the sublists should not be grouped by node
+	 */
+	uintptr_t getSublistsPerNode(uintptr_t sublistCount) const;
+
+	/**
+	 * Determine which of a set of node-grouped sublists a thread should visit on the given probe.
+	 * All of the sublists of the thread's own node are visited before those of the other nodes.
+	 * @param numaNode[in] The node the thread is bound to, or 0 if it is not bound
+	 * @param threadID[in] The thread's ID, used to spread threads of the same node over its sublists
+	 * @param probe[in] The number of sublists already visited (0 for the thread's home sublist)
+	 * @param sublistsPerNode[in] The value returned by getSublistsPerNode() for this set of sublists
+	 * @param sublistCount[in] The total number of sublists
+	 * @return An index into the set of sublists
+	 */
+	static MMINLINE uintptr_t
+	getSublistIndex(uintptr_t numaNode, uintptr_t threadID, uintptr_t probe, uintptr_t sublistsPerNode, uintptr_t sublistCount)
+	{
+		if ((0 != sublistsPerNode) && (0 != numaNode) && ((numaNode * sublistsPerNode) <= sublistCount)) {
+			uintptr_t nodeBase = (numaNode - 1) * sublistsPerNode;
+			if (probe < sublistsPerNode) {
+				return nodeBase + ((threadID + probe) % sublistsPerNode);
+			}
+			return (nodeBase + probe) % sublistCount;
+		}
+		return (threadID + probe) % sublistCount;
+	}
+
 	/**
 	 * Called to disable NUMA support and clear any caches allocated to track NUMA support
 	 * @param env[in] The main GC thread
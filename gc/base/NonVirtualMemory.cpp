@@ -108,6 +108,18 @@ MM_NonVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVali
 	return true;
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+/**
+ * Release the physical memory behind the address range.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_NonVirtualMemory::releaseMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	return true;
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 bool
 MM_NonVirtualMemory::setNumaAffinity(uintptr_t numaNode, void* address, uintptr_t byteAmount)
 {
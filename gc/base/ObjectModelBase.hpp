@@ -840,6 +840,31 @@ public:
 		return _delegate.isIndexable(forwardedHeader);
 	}
 
+	/**
+	 * Returns a key shared by all objects of the class of the object referred to by the forwarded header.
+	 * The scavenger indexes the hot fields it discovers (scavengerHotFieldDiscovery) with this key.
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @return the class key of the object, or 0 if hot fields should not be discovered for the object
+	 */
+	MMINLINE uintptr_t
+	getHotFieldClassKey(MM_ForwardedHeader *forwardedHeader)
+	{
+		return _delegate.getHotFieldClassKey(forwardedHeader);
+	}
+
+	/**
+	 * Returns a key shared by all objects of the class of an object, as for getHotFieldClassKey(MM_ForwardedHeader *).
+	 *
+	 * @param objectPtr pointer to the object
+	 * @return the class key of the object, or 0 if hot fields should not be discovered for the object
+	 */
+	MMINLINE uintptr_t
+	getHotFieldClassKey(omrobjectptr_t objectPtr)
+	{
+		return _delegate.getHotFieldClassKey(objectPtr);
+	}
+
 	/**
 	 * Return true if the object holds references to heap objects not reachable from reference graph. For
 	 * example, an object may be associated with a class and the class may have associated meta-objects
@@ -28,14 +28,20 @@
 #include "PacketList.hpp"
 
 bool 
-MM_PacketList::initialize(MM_EnvironmentBase *env)
+MM_PacketList::initialize(MM_EnvironmentBase *env, bool lockFree)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
+	_lockFree = lockFree;
 	_sublistCount = extensions->packetListSplit;
 	Assert_MM_true(0 < _sublistCount);
 
+	if (extensions->numaGCThreadAffinity) {
+		/* give each node its own group of sublists (see MM_Configuration::initializeGCParameters) */
+		_sublistsPerNode = extensions->_numaManager.getSublistsPerNode(_sublistCount);
+	}
+
 	_sublists = (struct PacketSublist *)extensions->getForge()->allocate(sizeof(struct PacketSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
 		result = false;
@@ -73,6 +79,15 @@ MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 	PacketSublist *list = &_sublists[0];
 	MM_Packet *current = head;
 	uintptr_t i;
+
+	if (_lockFree) {
+		for (i = 0; i < count; ++i) {
+			current->setSublistIndex(0);
+			current = current->_next;
+		}
+		pushLockFree(NULL, 0, head, tail, count);
+		return;
+	}
 	
 	list->_lock.acquire();
 	
@@ -102,6 +117,10 @@ MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 	*tail = NULL;
 	*count = 0;
 	
+	if (_lockFree) {
+		return popListLockFree(head, tail, count);
+	}
+
 	/* acquire all of our locks */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
 		PacketSublist *list = &_sublists[i];
@@ -140,12 +159,195 @@ MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 	return didPop;
 }
 
+bool
+MM_PacketList::popListLockFree(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
+{
+	bool didPop = false;
+
+	/* detach each chain and walk it to find its tail, since tails are not maintained; pushes and pops may proceed concurrently */
+	for (uintptr_t i = 0; i < _sublistCount; i++) {
+		PacketSublist *list = &_sublists[i];
+		uint64_t taggedHead = MM_AtomicOperations::getU64(&list->_taggedHead);
+
+		while (NULL != untagHead(taggedHead)) {
+			uint64_t foundTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, taggedHead, tagHead(NULL, taggedHead));
+			if (foundTaggedHead == taggedHead) {
+				break;
+			}
+			taggedHead = foundTaggedHead;
+		}
+
+		MM_Packet *listHead = untagHead(taggedHead);
+		if (NULL != listHead) {
+			didPop = true;
+
+			if (NULL == *head) {
+				*head = listHead;
+			} else {
+				(*tail)->_next = listHead;
+			}
+
+			MM_Packet *current = listHead;
+			*count += 1;
+			while (NULL != current->_next) {
+				current = current->_next;
+				*count += 1;
+			}
+			*tail = current;
+		}
+	}
+
+	/* packets pushed after their chain was detached remain accounted for */
+	decrementCount(*count);
+
+	return didPop;
+}
+
+uintptr_t
+MM_PacketList::popFromSublistLockFree(MM_EnvironmentBase *env, PacketSublist *list, MM_Packet **packets, uintptr_t maxCount)
+{
+	uintptr_t popped = 0;
+	uint64_t taggedHead = MM_AtomicOperations::getU64(&list->_taggedHead);
+
+	while (NULL != untagHead(taggedHead)) {
+		/* _next is written before a packet is published, read it after the head */
+		MM_AtomicOperations::readBarrier();
+		MM_Packet *last = untagHead(taggedHead);
+		uintptr_t count = 1;
+		while ((count < maxCount) && (NULL != last->_next)) {
+			last = last->_next;
+			count += 1;
+		}
+
+		uint64_t foundTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, taggedHead, tagHead(last->_next, taggedHead));
+		if (foundTaggedHead == taggedHead) {
+			/* the tag did not change, so no packet of the chain has been taken since it was walked */
+			MM_Packet *current = untagHead(taggedHead);
+			for (popped = 0; popped < count; popped++) {
+				packets[popped] = current;
+				current = current->_next;
+			}
+			decrementCount(count);
+			break;
+		}
+
+		/* a concurrent push or pop changed the head */
+		taggedHead = foundTaggedHead;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.packetListCASRetries += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	}
+
+	return popped;
+}
+
+uintptr_t
+MM_PacketList::popLockFree(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t maxCount)
+{
+	uintptr_t popped = 0;
+
+	for (uintptr_t i = 0; i < _sublistCount; i++) {
+		PacketSublist *list = &_sublists[getSublistIndex(env, i)];
+
+		if (NULL != getLockFreeHead(list)) {
+			popped = popFromSublistLockFree(env, list, packets, maxCount);
+			if (0 != popped) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				if (0 != i) {
+					env->_workPacketStats.packetListShardMisses += 1;
+				}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				break;
+			}
+		}
+	}
+
+	return popped;
+}
+
+void
+MM_PacketList::pushBatch(MM_EnvironmentBase *env, MM_Packet *head, MM_Packet *tail, uintptr_t count)
+{
+	uintptr_t index = getSublistIndex(env);
+	PacketSublist *list = &_sublists[index];
+	MM_Packet *current = head;
+	MM_Packet *previous = NULL;
+
+	if (_lockFree) {
+		for (uintptr_t i = 0; i < count; i++) {
+			current->_previous = NULL;
+			current->setSublistIndex(index);
+			current = current->_next;
+		}
+		pushLockFree(env, index, head, tail, count);
+		return;
+	}
+
+	/* link the chain both ways before taking the lock */
+	for (uintptr_t i = 0; i < count; i++) {
+		current->_previous = previous;
+		current->setSublistIndex(index);
+		previous = current;
+		current = current->_next;
+	}
+
+	list->_lock.acquire();
+
+	tail->_next = list->_head;
+	if (NULL == list->_head) {
+		list->_tail = tail;
+	} else {
+		list->_head->_previous = tail;
+	}
+	list->_head = head;
+	incrementCount(count);
+
+	list->_lock.release();
+}
+
+uintptr_t
+MM_PacketList::popBatch(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t maxCount)
+{
+	uintptr_t popped = 0;
+
+	if (_lockFree) {
+		return popLockFree(env, packets, maxCount);
+	}
+
+	for (uintptr_t i = 0; (0 == popped) && (i < _sublistCount); i++) {
+		PacketSublist *list = &_sublists[getSublistIndex(env, i)];
+
+		if (NULL != list->_head) {
+			list->_lock.acquire();
+			while ((popped < maxCount) && (NULL != list->_head)) {
+				packets[popped] = list->_head;
+				list->_head = list->_head->_next;
+				popped += 1;
+			}
+			if (0 != popped) {
+				decrementCount(popped);
+				if (NULL == list->_head) {
+					list->_tail = NULL;
+				} else {
+					list->_head->_previous = NULL;
+				}
+			}
+			list->_lock.release();
+		}
+	}
+
+	return popped;
+}
+
 void
 MM_PacketList::remove(MM_Packet *packetToRemove)
 {
 	PacketSublist *list = &_sublists[packetToRemove->getSublistIndex()];
 	MM_Packet *previous = NULL;
 	MM_Packet *next = NULL;
+
+	/* lock-free lists are singly linked */
+	Assert_MM_true(!_lockFree);
 	
 	list->_lock.acquire();
 	
@@ -188,7 +390,7 @@ MM_PacketList::getHead()
 	
 	if (popList(&head, &tail, &count)) {
 		pushList(head, tail, count);
-		result = _sublists[0]._head;
+		result = _lockFree ? getLockFreeHead(&_sublists[0]) : _sublists[0]._head;
 	}
 
 	return result;
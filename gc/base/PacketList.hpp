@@ -36,19 +36,31 @@
 #include "BaseNonVirtual.hpp"
 #include "EnvironmentBase.hpp"
 #include "LightweightNonReentrantLock.hpp"
+#include "NUMAManager.hpp"
 #include "Packet.hpp"
 
 class MM_GCExtensionsBase;
 
+/* In lock-free mode the head of a sublist shares a 64 bit word with a tag which changes on every update of the head.
+ * User space addresses fit in 48 bits on the supported 64 bit platforms, which leaves the top 16 bits for the tag.
+ */
+#if defined(OMR_ENV_DATA64)
+#define PACKET_LIST_TAG_SHIFT 48
+#else /* OMR_ENV_DATA64 */
+#define PACKET_LIST_TAG_SHIFT 32
+#endif /* OMR_ENV_DATA64 */
+#define PACKET_LIST_POINTER_MASK ((((uint64_t)1) << PACKET_LIST_TAG_SHIFT) - 1)
+
 class MM_PacketList: public MM_BaseNonVirtual
 {
 
 /* Data Section */
 public:
 	struct PacketSublist {
-		MM_Packet * _head;  /**< Head of the list */
-		MM_Packet * _tail;  /**< Tail of the list */
+		MM_Packet * volatile _head;  /**< Head of the list (not maintained in lock-free mode) */
+		MM_Packet * _tail;  /**< Tail of the list (not maintained in lock-free mode) */
 		MM_LightweightNonReentrantLock _lock;  /**< Lock for getting/putting packets */
+		volatile uint64_t _taggedHead;  /**< Head of the list and its update tag (lock-free mode only) */
 
 		bool
 		initialize(MM_EnvironmentBase *env)
@@ -62,6 +74,7 @@ public:
 		PacketSublist()
 			: _head(NULL)
 			, _tail(NULL)
+			, _taggedHead(0)
 		{
 		}
 	};
@@ -73,6 +86,8 @@ private:
 	
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
 	volatile uintptr_t _count;  /**< Number of items in the list */
+	uintptr_t _sublistsPerNode; /**< the number of sublists reserved for each NUMA node, or 0 if the sublists are not grouped by node */
+	bool _lockFree; /**< true if packets are pushed and popped with a compare-and-swap of the tagged sublist heads rather than under the sublist locks */
 	
 /* Functionality Section */
 private:
@@ -84,7 +99,7 @@ private:
 	 */
 	void incrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && !_lockFree) {
 			_count += value;
 		} else {
 			/* use an atomic, as the locks have been split up */
@@ -100,7 +115,7 @@ private:
 	 */
 	void decrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && !_lockFree) {
 			_count -= value;
 		} else {
 			/* use an atomic, as the locks have been split up */
@@ -119,14 +134,122 @@ private:
 	MMINLINE uintptr_t
 	getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		return getSublistIndex(env, 0);
+	}
+
+	/**
+	 * Determine which sublist the specified environment should visit on the given probe
+	 * (see MM_NUMAManager::getSublistIndex()).
+	 *
+	 * @param env the current environment
+	 * @param probe the number of sublists already visited (0 for the thread's home sublist)
+	 *
+	 * @return an index into the _sublists array
+	 */
+	MMINLINE uintptr_t
+	getSublistIndex(MM_EnvironmentBase *env, uintptr_t probe)
+	{
+		return MM_NUMAManager::getSublistIndex(env->_numaNode, env->getEnvironmentId(), probe, _sublistsPerNode, _sublistCount);
+	}
+
+	/**
+	 * Return the packet a tagged sublist head refers to.
+	 */
+	MMINLINE static MM_Packet *
+	untagHead(uint64_t taggedHead)
+	{
+		return (MM_Packet *)(uintptr_t)(taggedHead & PACKET_LIST_POINTER_MASK);
+	}
+
+	/**
+	 * Return the tagged sublist head which replaces oldTaggedHead to make packet the head of the sublist.
+	 * The tag is bumped on every update, so a head which has been popped and pushed back does not compare
+	 * equal to the value a concurrent popper read (no ABA).
+	 */
+	MMINLINE static uint64_t
+	tagHead(MM_Packet *packet, uint64_t oldTaggedHead)
+	{
+		return ((oldTaggedHead & ~PACKET_LIST_POINTER_MASK) + (((uint64_t)1) << PACKET_LIST_TAG_SHIFT)) | (uint64_t)(uintptr_t)packet;
+	}
+
+	/**
+	 * Return the current head of a sublist in lock-free mode.
+	 */
+	MMINLINE static MM_Packet *
+	getLockFreeHead(PacketSublist *list)
+	{
+		return untagHead(MM_AtomicOperations::getU64(&list->_taggedHead));
+	}
+
+	/**
+	 * Atomically push a chain of packets onto the head of the specified sublist.
+	 * The count is incremented before the chain is published so that it never
+	 * under-reports the number of packets which can be popped.
+	 *
+	 * @param env the current environment, or NULL if no statistics should be recorded
+	 * @param index the sublist to push on to
+	 * @param head The first entry in the chain
+	 * @param tail The last entry in the chain
+	 * @param count The number of entries in the chain
+	 */
+	MMINLINE void
+	pushLockFree(MM_EnvironmentBase *env, uintptr_t index, MM_Packet *head, MM_Packet *tail, uintptr_t count)
+	{
+		PacketSublist *list = &_sublists[index];
+		uint64_t oldTaggedHead = MM_AtomicOperations::getU64(&list->_taggedHead);
+
+		Assert_MM_true(0 == ((uint64_t)(uintptr_t)head & ~PACKET_LIST_POINTER_MASK));
+		incrementCount(count);
+		while (true) {
+			tail->_next = untagHead(oldTaggedHead);
+			uint64_t foundTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldTaggedHead, tagHead(head, oldTaggedHead));
+			if (foundTaggedHead == oldTaggedHead) {
+				break;
+			}
+			oldTaggedHead = foundTaggedHead;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			if (NULL != env) {
+				env->_workPacketStats.packetListCASRetries += 1;
+			}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
 	}
+
+	/**
+	 * Pop up to maxCount packets from the specified sublist with a single compare-and-swap of its tagged head.
+	 * Packets are never freed while the list exists, so the chain can be walked while other threads pop and
+	 * push: if any of them succeeded, the tag has changed and the compare-and-swap fails.
+	 *
+	 * @param packets[out] array of at least maxCount entries which receives the packets
+	 * @return the number of packets stored in packets
+	 */
+	uintptr_t popFromSublistLockFree(MM_EnvironmentBase *env, PacketSublist *list, MM_Packet **packets, uintptr_t maxCount);
+
+	/**
+	 * Pop up to maxCount packets in lock-free mode, starting with the sublist associated with env and
+	 * moving on to the others when it is empty. The packets all come from the same sublist.
+	 *
+	 * @param packets[out] array of at least maxCount entries which receives the packets
+	 * @return the number of packets stored in packets, 0 if every sublist is empty
+	 */
+	uintptr_t popLockFree(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t maxCount);
+
+	/**
+	 * Lock-free mode implementation of popList().
+	 */
+	bool popListLockFree(MM_Packet **head, MM_Packet **tail, uintptr_t *count);
 		
 protected:
 	
 public:
 	
-	bool initialize(MM_EnvironmentBase *env);
+	/**
+	 * Initialize the list.
+	 *
+	 * @param lockFree true to push and pop packets with a compare-and-swap of the tagged sublist head
+	 * instead of taking the sublist lock. A lock-free list does not support remove().
+	 */
+	bool initialize(MM_EnvironmentBase *env, bool lockFree = false);
 	void tearDown(MM_EnvironmentBase *env) ;
 	
 	/**
@@ -162,6 +285,13 @@ public:
 	{
 		uintptr_t index = getSublistIndex(env);
 		PacketSublist *list = &_sublists[index];
+
+		if (_lockFree) {
+			packet->_previous = NULL;
+			packet->setSublistIndex(index);
+			pushLockFree(env, index, packet, packet, 1);
+			return;
+		}
 	
 		list->_lock.acquire();
 
@@ -186,11 +316,15 @@ public:
 	 */
 	MMINLINE MM_Packet *pop(MM_EnvironmentBase *env)
 	{
-		uintptr_t index = getSublistIndex(env);
 		MM_Packet *packet = NULL;
 
+		if (_lockFree) {
+			popLockFree(env, &packet, 1);
+			return packet;
+		}
+
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
-			PacketSublist *list = &_sublists[index];
+			PacketSublist *list = &_sublists[getSublistIndex(env, i)];
 
 			if (NULL != list->_head) {
 				list->_lock.acquire();
@@ -210,13 +344,33 @@ public:
 					break;
 				}
 			}
-			
-			index = (index + 1) %  _sublistCount;
 		}
 
 		return packet;
 	}
 	
+	/**
+	 * Push a chain of packets, linked through _next, onto the sublist associated with env.
+	 * The whole chain is published with a single compare-and-swap in lock-free mode, and
+	 * under a single acquisition of the sublist lock otherwise.
+	 *
+	 * @param head The first entry in the chain
+	 * @param tail The last entry in the chain
+	 * @param count The number of entries in the chain
+	 */
+	void pushBatch(MM_EnvironmentBase *env, MM_Packet *head, MM_Packet *tail, uintptr_t count);
+
+	/**
+	 * Pop up to maxCount packets off of the packetList.
+	 * The packets are detached from a single sublist with a single compare-and-swap in
+	 * lock-free mode, and under a single acquisition of its lock otherwise.
+	 *
+	 * @param packets[out] array of at least maxCount entries which receives the packets
+	 * @param maxCount the maximum number of packets to pop
+	 * @return the number of packets popped
+	 */
+	uintptr_t popBatch(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t maxCount);
+
 	/**
 	 * Check to see if the list is empty
 	 *
@@ -254,6 +408,8 @@ public:
 		,_sublists(NULL)
 		,_sublistCount(0)
 		,_count(0)
+		,_sublistsPerNode(0)
+		,_lockFree(false)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -26,16 +26,21 @@
  * @ingroup GC_Base
  */
 
+#include <math.h>
+
 #include "omrcfg.h"
 #include "omr.h"
+#include "omrmodroncore.h"
 #include "ModronAssertions.h"
 #include "ut_j9mm.h"
 
+#include "AtomicOperations.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterfaceImpl.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "Math.hpp"
 #include "Task.hpp"
 
 #include "ParallelDispatcher.hpp"
@@ -76,6 +81,7 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 	env->setWorkerID(workerID);
 	/* Enviroment initialization specific for GC threads (after worker ID is set) */
 	env->initializeGCThread();
+	dispatcher->setWorkerNumaAffinity(env);
 
 	/* Signal that the thread was created succesfully */
 	workerInfo->workerFlags = WORKER_INFO_FLAG_OK;
@@ -96,6 +102,7 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 
 	/* Thread is terminating -- shut it down */
 	env->setWorkerID(0);
+	env->_numaNode = 0;
 	MM_EnvironmentBase::detachVMThread(omrVM, omrVMThread, MM_EnvironmentBase::ATTACH_GC_DISPATCHER_THREAD);
 	
 	omrthread_monitor_enter(dispatcher->_dispatcherMonitor);
@@ -151,6 +158,11 @@ void
 MM_ParallelDispatcher::workerEntryPoint(MM_EnvironmentBase *env) 
 {
 	uintptr_t workerID = env->getWorkerID();
+
+	if (_parkWorkers) {
+		workerEntryPointParked(env);
+		return;
+	}
 	
 	setThreadInitializationComplete(env);
 	
@@ -193,6 +205,81 @@ MM_ParallelDispatcher::workerEntryPoint(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_workerThreadMutex);	
 }
 
+void
+MM_ParallelDispatcher::workerEntryPointParked(MM_EnvironmentBase *env)
+{
+	uintptr_t workerID = env->getWorkerID();
+
+	/* Sample the generation before advertising the thread as waiting, so that no dispatch can be missed */
+	uintptr_t generation = _workerTaskGenerations[workerID].generation;
+	setThreadInitializationComplete(env);
+
+	while (true) {
+		generation = waitForTaskGeneration(env, generation);
+
+		/* The main thread sets the status (under _workerThreadMutex) before it bumps the generation */
+		uintptr_t status = _statusTable[workerID];
+		if (worker_status_dying == status) {
+			break;
+		}
+
+		if (worker_status_reserved == status) {
+			/* Accepting does not need _workerThreadMutex: the main thread only looks at this thread's status again once the task is complete */
+			acceptTask(env);
+
+			env->_currentTask->run(env);
+
+			omrthread_monitor_enter(_workerThreadMutex);
+			completeTask(env);
+			omrthread_monitor_exit(_workerThreadMutex);
+		}
+	}
+}
+
+uintptr_t
+MM_ParallelDispatcher::waitForTaskGeneration(MM_EnvironmentBase *env, uintptr_t observedGeneration)
+{
+	WorkerTaskGeneration *taskGeneration = &_workerTaskGenerations[env->getWorkerID()];
+
+	for (uintptr_t spin = 0; spin < _parkSpinCount; spin++) {
+		if (observedGeneration != taskGeneration->generation) {
+			MM_AtomicOperations::add(&_taskSpinWakeups, 1);
+			MM_AtomicOperations::readBarrier();
+			return taskGeneration->generation;
+		}
+		MM_AtomicOperations::yieldCPU();
+	}
+
+	/* Advertise the park before the final check; wakeUpWorker() bumps the generation before it looks at the flag */
+	taskGeneration->parked = 1;
+	MM_AtomicOperations::readWriteBarrier();
+	while (observedGeneration == taskGeneration->generation) {
+		/* An unpark that arrives before the park is remembered, so the wake up cannot be lost.
+		 * GC worker threads are never interrupted, so park only returns early spuriously.
+		 */
+		omrthread_park(0, 0);
+	}
+	taskGeneration->parked = 0;
+	MM_AtomicOperations::add(&_taskParkWakeups, 1);
+
+	MM_AtomicOperations::readBarrier();
+	return taskGeneration->generation;
+}
+
+void
+MM_ParallelDispatcher::wakeUpWorker(uintptr_t workerID)
+{
+	WorkerTaskGeneration *taskGeneration = &_workerTaskGenerations[workerID];
+
+	/* The status and task table entries must be visible before the new generation */
+	MM_AtomicOperations::writeBarrier();
+	taskGeneration->generation += 1;
+	MM_AtomicOperations::readWriteBarrier();
+	if (0 != taskGeneration->parked) {
+		omrthread_unpark(_threadTable[workerID]);
+	}
+}
+
 void
 MM_ParallelDispatcher::mainEntryPoint(MM_EnvironmentBase *env)
 {
@@ -203,6 +290,78 @@ MM_ParallelDispatcher::mainEntryPoint(MM_EnvironmentBase *env)
 	assume0(0);
 }
 
+uintptr_t
+MM_ParallelDispatcher::getWorkerNumaNode(uintptr_t workerID)
+{
+	uintptr_t numaNode = 0;
+
+	if (_extensions->numaGCThreadAffinity && ((0 != workerID) || useSeparateMainThread())) {
+		uintptr_t affinityLeaderCount = _extensions->_numaManager.getAffinityLeaderCount();
+		if (1 < affinityLeaderCount) {
+			numaNode = (workerID % affinityLeaderCount) + 1;
+		}
+	}
+
+	return numaNode;
+}
+
+void
+MM_ParallelDispatcher::setWorkerNumaAffinity(MM_EnvironmentBase *env)
+{
+	env->_numaNode = getWorkerNumaNode(env->getWorkerID());
+
+	/* simulated nodes only affect how work is distributed, they have no processors to bind to */
+	if ((0 != env->_numaNode) && _extensions->_numaManager.isPhysicalNUMASupported()) {
+		uintptr_t j9NodeNumber = _extensions->_numaManager.getJ9NodeNumber(env->_numaNode);
+		if (!env->setNumaAffinity(&j9NodeNumber, 1)) {
+			/* the thread runs unbound; work is still preferentially taken from its node's lists */
+			Trc_MM_ParallelDispatcher_setWorkerNumaAffinity_failed(env->getLanguageVMThread(), env->getWorkerID(), j9NodeNumber);
+		}
+	}
+}
+
+uintptr_t
+MM_ParallelDispatcher::getAdaptiveTaskType(uintptr_t vmStateID)
+{
+	uintptr_t taskType = adaptive_task_none;
+
+	switch (vmStateID) {
+	case OMRVMSTATE_GC_SCAVENGE:
+		taskType = adaptive_task_scavenge;
+		break;
+	case OMRVMSTATE_GC_MARK:
+		taskType = adaptive_task_mark;
+		break;
+	case OMRVMSTATE_GC_SWEEP:
+		taskType = adaptive_task_sweep;
+		break;
+	case OMRVMSTATE_GC_COMPACT:
+		taskType = adaptive_task_compact;
+		break;
+	default:
+		break;
+	}
+
+	return taskType;
+}
+
+MM_ParallelDispatcher::AdaptiveThreadCountModel *
+MM_ParallelDispatcher::getAdaptiveThreadCountModel(uintptr_t vmStateID)
+{
+	AdaptiveThreadCountModel *model = NULL;
+	uintptr_t taskType = getAdaptiveTaskType(vmStateID);
+
+	if (_extensions->adaptiveGCThreadCount && (adaptive_task_none != taskType)) {
+		model = &_adaptiveThreadCountModels[taskType];
+		if (0 == model->threadCount) {
+			/* no task of this type has been dispatched yet */
+			model = NULL;
+		}
+	}
+
+	return model;
+}
+
 MM_ParallelDispatcher *
 MM_ParallelDispatcher::newInstance(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize)
 {
@@ -249,6 +408,10 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		forge->free(_threadTable);
 		_threadTable = NULL;
 	}
+	if(NULL != _workerTaskGenerations) {
+		forge->free(_workerTaskGenerations);
+		_workerTaskGenerations = NULL;
+	}
 
 	env->getForge()->free(this);
 }
@@ -286,6 +449,21 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	_parkWorkers = _extensions->dispatcherParkWorkers;
+	if (_parkWorkers) {
+		_workerTaskGenerations = (WorkerTaskGeneration *)forge->allocate(_threadCountMaximum * sizeof(WorkerTaskGeneration), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _workerTaskGenerations) {
+			goto error_no_memory;
+		}
+		memset(_workerTaskGenerations, 0, _threadCountMaximum * sizeof(WorkerTaskGeneration));
+
+		/* Spinning cannot help when the dispatching thread needs the only processor */
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		if (1 < omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE)) {
+			_parkSpinCount = _extensions->dispatcherParkSpinCount;
+		}
+	}
+
 	return true;
 
 error_no_memory:
@@ -338,6 +516,16 @@ MM_ParallelDispatcher::startUpThreads()
 			goto error;
 		}
 
+		if (_parkWorkers && (0 != workerThreadCount)) {
+			/* Parked workers are picked by status, so a worker can only take part in a task once it is waiting */
+			while (worker_status_waiting != _statusTable[workerThreadCount]) {
+				if(_inShutdown) {
+					goto error;
+				}
+				omrthread_monitor_wait(_dispatcherMonitor);
+			}
+		}
+
 		_threadShutdownCount += 1;
 		workerThreadCount += 1;
 	}
@@ -403,6 +591,17 @@ MM_ParallelDispatcher::shutDownThreads()
 void
 MM_ParallelDispatcher::wakeUpThreads(uintptr_t count)
 {
+	if (_parkWorkers) {
+		/* Workers have been reserved (or made dying) individually - wake exactly those */
+		for (uintptr_t workerID = 0; workerID < _threadCountMaximum; workerID++) {
+			uintptr_t status = _statusTable[workerID];
+			if ((NULL != _threadTable[workerID]) && ((worker_status_reserved == status) || (worker_status_dying == status))) {
+				wakeUpWorker(workerID);
+			}
+		}
+		return;
+	}
+
 	/* This thread should notify and release _workerThreadMutex asap. Threads waking up will need to
 	 * reacquire the mutex before proceeding with the task.
 	 *
@@ -457,10 +656,91 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 	 * available and ready to run).
 	 */
 	uintptr_t taskActiveThreadCount = OMR_MIN(_activeThreadCount, threadCount);
+
+	/* Only choose for the caller if it did not ask for a specific count */
+	if (_extensions->adaptiveGCThreadCount && (UDATA_MAX == threadCount)) {
+		taskActiveThreadCount = getAdaptiveThreadCount(env, task, taskActiveThreadCount);
+	}
+
 	task->setThreadCount(taskActiveThreadCount);
  	return taskActiveThreadCount;
 }
 
+uintptr_t
+MM_ParallelDispatcher::getAdaptiveThreadCount(MM_EnvironmentBase *env, MM_Task *task, uintptr_t maximumThreadCount)
+{
+	uintptr_t taskType = getAdaptiveTaskType(task->getVMStateID());
+	if (adaptive_task_none == taskType) {
+		return maximumThreadCount;
+	}
+
+	AdaptiveThreadCountModel *model = &_adaptiveThreadCountModels[taskType];
+	uintptr_t threadCount = maximumThreadCount;
+
+	/* Until both the work rate and the cost of starting a thread have been measured, use every thread available */
+	if ((0.0f < model->workRate) && (0.0f < model->threadStartCost)) {
+		/* pause(n) = W / (n * rate) + n * startCost is minimized at n = sqrt(W / (rate * startCost)) */
+		double optimalThreadCount = sqrt((double)model->workVolume / ((double)model->workRate * (double)model->threadStartCost));
+		threadCount = (uintptr_t)(optimalThreadCount + 0.5);
+		threadCount = OMR_MAX(threadCount, 1);
+		threadCount = OMR_MIN(threadCount, maximumThreadCount);
+	}
+
+	model->threadCount = threadCount;
+	model->maximumThreadCount = maximumThreadCount;
+	model->decisionWorkVolume = model->workVolume;
+	model->decisionWorkRate = model->workRate;
+	model->decisionThreadStartCost = model->threadStartCost;
+
+	Trc_MM_ParallelDispatcher_adaptiveThreadCount(env->getLanguageVMThread(), task->getVMStateID(), threadCount, maximumThreadCount,
+		(uintptr_t)model->workVolume, (uintptr_t)model->workRate, (uintptr_t)(model->threadStartCost * 1000.0f));
+
+	return threadCount;
+}
+
+void
+MM_ParallelDispatcher::updateAdaptiveThreadCountModel(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount, uint64_t endTime)
+{
+	uintptr_t taskType = getAdaptiveTaskType(task->getVMStateID());
+	uintptr_t workVolume = task->getCompletedWorkVolume(env);
+	if ((adaptive_task_none == taskType) || (0 == workVolume)) {
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	AdaptiveThreadCountModel *model = &_adaptiveThreadCountModels[taskType];
+	float weight = _extensions->adaptiveGCThreadCountWeight;
+
+	float elapsedMillis = (float)omrtime_hires_delta(_taskDispatchTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS) / 1000.0f;
+	float startMillis = 0.0f;
+	if ((1 < threadCount) && (_taskAllAcceptedTime > _taskDispatchTime)) {
+		startMillis = (float)omrtime_hires_delta(_taskDispatchTime, _taskAllAcceptedTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS) / 1000.0f;
+	}
+	/* time during which all threads were working; never let it collapse to zero for very short tasks */
+	float workMillis = OMR_MAX(elapsedMillis - startMillis, 0.001f);
+	float workRate = (float)workVolume / ((float)threadCount * workMillis);
+
+	if (0 == model->sampleCount) {
+		model->workVolume = (float)workVolume;
+		model->workRate = workRate;
+	} else {
+		model->workVolume = MM_Math::weightedAverage(model->workVolume, (float)workVolume, weight);
+		model->workRate = MM_Math::weightedAverage(model->workRate, workRate, weight);
+	}
+
+	/* the start cost can only be observed when helper threads were dispatched */
+	if (1 < threadCount) {
+		float threadStartCost = OMR_MAX(startMillis / (float)(threadCount - 1), 0.001f);
+		if (0.0f == model->threadStartCost) {
+			model->threadStartCost = threadStartCost;
+		} else {
+			model->threadStartCost = MM_Math::weightedAverage(model->threadStartCost, threadStartCost, weight);
+		}
+	}
+
+	model->sampleCount += 1;
+}
+
 uintptr_t 
 MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 {
@@ -514,7 +794,20 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	/* Main thread doesn't need to be woken up */
 	Assert_MM_true(_threadsToReserve == 0);
 	_threadsToReserve = threadCount - 1;
-	wakeUpThreads(_threadsToReserve);
+
+	if (_parkWorkers) {
+		/* Hand the task to specific waiting workers rather than letting woken workers race for it */
+		for (uintptr_t workerID = 0; (0 < _threadsToReserve) && (workerID < _threadCountMaximum); workerID++) {
+			if (worker_status_waiting == _statusTable[workerID]) {
+				_statusTable[workerID] = worker_status_reserved;
+				_taskTable[workerID] = task;
+				_threadsToReserve -= 1;
+			}
+		}
+		Assert_MM_true(_threadsToReserve == 0);
+	}
+
+	wakeUpThreads(threadCount - 1);
 
 	omrthread_monitor_exit(_workerThreadMutex);
 }
@@ -528,6 +821,12 @@ MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase *env)
 	_statusTable[workerID] = worker_status_active;
 	env->_currentTask = _taskTable[workerID];
 
+	if (env->_currentTask->getThreadCount() == MM_AtomicOperations::add(&_taskAcceptedCount, 1)) {
+		/* the last thread to accept ends the start latency of the task */
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		_taskAllAcceptedTime = omrtime_hires_clock();
+	}
+
 	env->_currentTask->accept(env);
 }
 
@@ -563,16 +862,51 @@ MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 void
 MM_ParallelDispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount)
 {
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	_taskDispatchTime = omrtime_hires_clock();
+	_taskAllAcceptedTime = 0;
+	_taskAcceptedCount = 0;
+	_taskSpinWakeups = 0;
+	_taskParkWakeups = 0;
+
 	uintptr_t activeThreads = recomputeActiveThreadCountForTask(env, task, newThreadCount);
 	task->mainSetup(env);
 	prepareThreadsForTask(env, task, activeThreads);
 	acceptTask(env);
 	task->run(env);
 	completeTask(env);
+	recordTaskDispatchStats(env, task);
+	if (_extensions->adaptiveGCThreadCount && (UDATA_MAX == newThreadCount)) {
+		/* all threads have completed (and merged their stats) once the main thread returns from completeTask */
+		updateAdaptiveThreadCountModel(env, task, activeThreads, omrtime_hires_clock());
+	}
 	cleanupAfterTask(env);
 	task->mainCleanup(env);
 }
 
+void
+MM_ParallelDispatcher::recordTaskDispatchStats(MM_EnvironmentBase *env, MM_Task *task)
+{
+	MM_TaskDispatchStats *stats = &_extensions->globalGCStats.taskDispatchStats;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (OMRVMSTATE_GC_SCAVENGE == task->getVMStateID()) {
+		stats = &_extensions->incrementScavengerStats._taskDispatchStats;
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+	/* all threads have accepted (and completed) the task once the main thread returns from completeTask */
+	uint64_t startLatency = 0;
+	if (_taskAllAcceptedTime > _taskDispatchTime) {
+		startLatency = _taskAllAcceptedTime - _taskDispatchTime;
+	}
+
+	stats->_taskCount += 1;
+	stats->_startLatency += startLatency;
+	stats->_maxStartLatency = OMR_MAX(stats->_maxStartLatency, startLatency);
+	stats->_spinWakeups += _taskSpinWakeups;
+	stats->_parkWakeups += _taskParkWakeups;
+}
+
 /**
  * Return a value indicating the priority at which GC threads should be run.
  */
@@ -83,6 +83,58 @@ protected:
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
 
+	/**
+	 * Per worker word which the main thread bumps to hand the worker a task (or tell it to die), see dispatcherParkWorkers.
+	 * Padded so that spinning workers do not false share.
+	 */
+	struct WorkerTaskGeneration {
+		volatile uintptr_t generation; /**< incremented by the main thread each time the worker is reserved or made dying */
+		volatile uintptr_t parked; /**< non-zero while the worker is parked (or about to park) and needs an explicit unpark */
+		uint8_t padding[128 - (2 * sizeof(uintptr_t))];
+	};
+
+	bool _parkWorkers; /**< cached dispatcherParkWorkers, fixed for the life of the dispatcher */
+	uintptr_t _parkSpinCount; /**< spin iterations before parking, 0 on uniprocessors */
+	WorkerTaskGeneration *_workerTaskGenerations; /**< table of _threadCountMaximum generation words (dispatcherParkWorkers only) */
+
+	volatile uintptr_t _taskAcceptedCount; /**< number of threads which have accepted the current task */
+	volatile uintptr_t _taskSpinWakeups; /**< number of workers which found the current task while spinning */
+	volatile uintptr_t _taskParkWakeups; /**< number of workers which had to be unparked for the current task */
+
+public:
+	/**
+	 * Task types which have their thread count chosen adaptively (see adaptiveGCThreadCount).
+	 */
+	enum AdaptiveTaskType {
+		adaptive_task_scavenge = 0,
+		adaptive_task_mark,
+		adaptive_task_sweep,
+		adaptive_task_compact,
+		adaptive_task_count,
+		adaptive_task_none = adaptive_task_count
+	};
+
+	/**
+	 * Rolling model of the parallel efficiency of one task type, and the most recent decision made from it.
+	 * The pause of a task run with n threads is modelled as workVolume / (n * workRate) + n * threadStartCost.
+	 */
+	struct AdaptiveThreadCountModel {
+		float workVolume; /**< running average of the work done by each dispatch of the task (task specific units) */
+		float workRate; /**< running average of the work done per thread per millisecond */
+		float threadStartCost; /**< running average of the milliseconds spent starting each additional thread, 0 until measured */
+		uintptr_t sampleCount; /**< the number of dispatches observed */
+		uintptr_t threadCount; /**< the thread count chosen for the most recent dispatch */
+		uintptr_t maximumThreadCount; /**< the thread count which was available for the most recent dispatch */
+		float decisionWorkVolume; /**< workVolume when the most recent thread count was chosen */
+		float decisionWorkRate; /**< workRate when the most recent thread count was chosen */
+		float decisionThreadStartCost; /**< threadStartCost when the most recent thread count was chosen */
+	};
+
+protected:
+	AdaptiveThreadCountModel _adaptiveThreadCountModels[adaptive_task_count]; /**< per task type models, see adaptiveGCThreadCount */
+	uint64_t _taskDispatchTime; /**< hi-res time at which run() was called for the current task */
+	volatile uint64_t _taskAllAcceptedTime; /**< hi-res time at which the last thread accepted the current task, 0 until then */
+
 public:
 
 	/*
@@ -91,6 +143,29 @@ public:
 private:
 protected:
 	virtual void workerEntryPoint(MM_EnvironmentBase *env);
+
+	/**
+	 * Main loop for worker threads when dispatcherParkWorkers is enabled: wait on the thread's own
+	 * task generation word rather than on _workerThreadMutex, so a dispatch wakes only the reserved threads.
+	 */
+	void workerEntryPointParked(MM_EnvironmentBase *env);
+
+	/**
+	 * Spin and then park until the calling worker's task generation moves past the observed value.
+	 * @param observedGeneration[in] the generation the worker last acted on
+	 * @return the new generation
+	 */
+	uintptr_t waitForTaskGeneration(MM_EnvironmentBase *env, uintptr_t observedGeneration);
+
+	/**
+	 * Bump a worker's task generation and unpark it if it is parked. Its status must already be set.
+	 */
+	void wakeUpWorker(uintptr_t workerID);
+
+	/**
+	 * Record the start latency of a completed task in the stats of the collector which ran it.
+	 */
+	void recordTaskDispatchStats(MM_EnvironmentBase *env, MM_Task *task);
 	virtual void mainEntryPoint(MM_EnvironmentBase *env);
 
 	bool initialize(MM_EnvironmentBase *env);
@@ -113,8 +188,28 @@ protected:
 	virtual uintptr_t recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount); 
 
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
+
+	/**
+	 * Associate a newly started worker thread with its NUMA node (see getWorkerNumaNode())
+	 * and, if physical NUMA is supported, bind the thread to that node's processors.
+	 */
+	virtual void setWorkerNumaAffinity(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
+
+	/**
+	 * Choose the thread count which minimizes the modelled pause of the task.
+	 * @param maximumThreadCount[in] the number of threads available to the task
+	 * @return the number of threads to dispatch, between 1 and maximumThreadCount
+	 */
+	uintptr_t getAdaptiveThreadCount(MM_EnvironmentBase *env, MM_Task *task, uintptr_t maximumThreadCount);
+
+	/**
+	 * Feed the work volume and timings of a completed task into the model of its task type.
+	 * @param threadCount[in] the number of threads the task ran with
+	 * @param endTime[in] hi-res time at which the task completed
+	 */
+	void updateAdaptiveThreadCountModel(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount, uint64_t endTime);
 	
 public:
 	virtual bool startUpThreads();
@@ -128,6 +223,27 @@ public:
 	MMINLINE virtual uintptr_t activeThreadCount() { return _activeThreadCount; }
 	virtual void setThreadCount(uintptr_t threadCount);
 
+	/**
+	 * Determine the NUMA node a worker thread is associated with when numaGCThreadAffinity is enabled.
+	 * Workers are distributed round-robin over the affinity leaders. The thread which requested the GC
+	 * is never rebound, so it has no node unless the dispatcher uses a separate main thread.
+	 * @param workerID[in] the worker ID of the thread
+	 * @return the affinity leader index (starting from 1), or 0 if the worker has no node
+	 */
+	uintptr_t getWorkerNumaNode(uintptr_t workerID);
+
+	/**
+	 * Map a task's VM state to the task type used by the adaptive thread count model.
+	 * @return the task type, or adaptive_task_none if tasks in this state are not modelled
+	 */
+	static uintptr_t getAdaptiveTaskType(uintptr_t vmStateID);
+
+	/**
+	 * Return the adaptive thread count model for tasks in the given VM state.
+	 * @return the model, or NULL if adaptiveGCThreadCount is disabled, the state is not modelled or no task has been dispatched yet
+	 */
+	AdaptiveThreadCountModel *getAdaptiveThreadCountModel(uintptr_t vmStateID);
+
 	MMINLINE omrsig_handler_fn getSignalHandler() {return _handler;}
 	MMINLINE void * getSignalHandlerArg() {return _handler_arg;}
 
@@ -158,8 +274,17 @@ public:
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
+		,_parkWorkers(false)
+		,_parkSpinCount(0)
+		,_workerTaskGenerations(NULL)
+		,_taskAcceptedCount(0)
+		,_taskSpinWakeups(0)
+		,_taskParkWakeups(0)
+		,_taskDispatchTime(0)
+		,_taskAllAcceptedTime(0)
 	{
 		_typeId = __FUNCTION__;
+		memset(_adaptiveThreadCountModels, 0, sizeof(_adaptiveThreadCountModels));
 	}
 
 	/*
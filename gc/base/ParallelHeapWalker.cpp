@@ -137,6 +137,39 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Exit(env->getLanguageVMThread(), heapChunkFactor, parallelChunkSize, objectsWalked);
 }
 
+/**
+ * Walk through the marked objects of the heap in parallel and apply the provided function.
+ */
+void
+MM_ParallelHeapWalker::markedObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t chunkSize)
+{
+	Assert_MM_true(0 == (chunkSize % J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT));
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		uint8_t *chunkBase = (uint8_t *)region->getLowAddress();
+		uint8_t *regionTop = (uint8_t *)region->getHighAddress();
+		while (chunkBase < regionTop) {
+			uint8_t *chunkTop = chunkBase + OMR_MIN(chunkSize, (uintptr_t)(regionTop - chunkBase));
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				/* objects starting in the chunk belong to it, even when they extend past its top */
+				MM_HeapMapIterator markedObjectIterator(extensions, _markMap, (uintptr_t *)chunkBase, (uintptr_t *)chunkTop, false);
+				omrobjectptr_t object = NULL;
+				while (NULL != (object = markedObjectIterator.nextObject())) {
+					function(omrVMThread, region, object, userData);
+				}
+			}
+			chunkBase = chunkTop;
+		}
+	}
+	regionManager->unlock();
+}
+
 /**
  * Walk through all live objects of the heap and apply the provided function.
  * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
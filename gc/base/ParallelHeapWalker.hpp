@@ -54,6 +54,14 @@ public:
 	 */
 	void allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
 
+	/**
+	 * Walk through the marked objects of the heap in parallel and apply the provided function.
+	 * Every region is split into chunks of chunkSize bytes which are handed out as work units, so the walk
+	 * never parses the heap and scales with the number of threads rather than with the number of regions.
+	 * Must be called by every thread of the current task, with a mark map describing all live objects.
+	 */
+	void markedObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t chunkSize);
+
 	/**
 	 * Walk through all live objects of the heap and apply the provided function.
 	 * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
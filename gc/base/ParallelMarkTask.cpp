@@ -29,7 +29,9 @@
 
 #include "ParallelMarkTask.hpp"
 
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MarkingScheme.hpp"
 #include "WorkStack.hpp"
 
@@ -40,6 +42,16 @@ MM_ParallelMarkTask::getVMStateID()
 	return OMRVMSTATE_GC_MARK;
 }
 
+/**
+ * The work of a mark is the number of bytes scanned by this task, as accumulated in cleanup().
+ * The global mark stats are not used since they also count work done by concurrent tracing.
+ */
+uintptr_t
+MM_ParallelMarkTask::getCompletedWorkVolume(MM_EnvironmentBase *env)
+{
+	return _bytesScanned;
+}
+
 void
 MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 {
@@ -67,6 +79,8 @@ MM_ParallelMarkTask::setup(MM_EnvironmentBase *env)
 void
 MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 {
+	/* the thread's mark stats were cleared when it joined the task (see MM_MarkingScheme::workerSetupForGC) */
+	MM_AtomicOperations::add(&_bytesScanned, env->_markStats._bytesScanned);
 	_markingScheme->workerCleanupAfterGC(env);
 
 	if (env->isMainThread()) {
@@ -48,9 +48,11 @@ private:
 	MM_MarkingScheme *_markingScheme;
 	const bool _initMarkMap;
 	MM_CycleState *_cycleState;  /**< Collection cycle state active for the task */
+	volatile uintptr_t _bytesScanned; /**< Bytes scanned by the threads which took part in this task (concurrent tracing excluded) */
 	
 public:
 	virtual uintptr_t getVMStateID();
+	virtual uintptr_t getCompletedWorkVolume(MM_EnvironmentBase *env);
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
@@ -74,6 +76,7 @@ public:
 		,_markingScheme(markingScheme)
 		,_initMarkMap(initMarkMap)
 		,_cycleState(cycleState)
+		,_bytesScanned(0)
 	{
 		_typeId = __FUNCTION__;
 	};
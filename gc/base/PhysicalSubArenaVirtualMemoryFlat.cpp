@@ -29,6 +29,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapPretouchTask.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionManager.hpp"
 #include "MemorySubSpace.hpp"
@@ -207,6 +208,7 @@ MM_PhysicalSubArenaVirtualMemoryFlat::expandNoCheck(MM_EnvironmentBase *env, uin
 	if(!_heap->commitMemory(lowExpandAddress, expandSize)) {
 		return 0;
 	}
+	MM_HeapPretouchTask::pretouch(env, lowExpandAddress, highExpandAddress);
 
 	if (_highAddress != highExpandAddress) {
 		/* the area has been expanded.  Update internal values */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(SLIDINGCOMPACTION_HPP_)
+#define SLIDINGCOMPACTION_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "objectdescription.h"
+
+#include "AtomicOperations.hpp"
+
+/* Spins a sliding sub area makes waiting for the sub areas below it before yielding the processor */
+#define SLIDING_COMPACTION_SPIN_COUNT 256
+
+/**
+ * The parts of a sliding compaction that only depend on the sub area table of a region: the prefix sum
+ * that gives each sub area its destination, and the wait for the sub areas whose objects lie where a sub
+ * area slides to.
+ *
+ * A sub area table is an array of SubArea entries ending with an entry whose state is SubArea::end_segment.
+ * A SubArea provides firstObject (the start of the sub area, and for the end_segment entry the top of the
+ * region), liveBytes, destination and state, and a state value SubArea::full for a sub area which has been
+ * moved. Objects of sub area i lie below the firstObject of sub area i+1.
+ * @ingroup GC_Base_Core
+ */
+class MM_SlidingCompaction
+{
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Give each sub area of a region the address its first live object slides to: the base of the region
+	 * plus the live bytes of all sub areas below it. The end_segment entry receives the end of the live
+	 * data of the region.
+	 *
+	 * @param subAreas[in/out] the sub area table of the region, with liveBytes measured
+	 * @param base[in] the lowest address of the region
+	 * @return the index of the end_segment entry
+	 */
+	template <typename SubArea>
+	static intptr_t
+	computeDestinations(SubArea *subAreas, uintptr_t base)
+	{
+		uintptr_t destination = base;
+		intptr_t i = 0;
+		for (i = 0; SubArea::end_segment != subAreas[i].state; i++) {
+			subAreas[i].destination = (omrobjectptr_t)destination;
+			destination += subAreas[i].liveBytes;
+		}
+		subAreas[i].destination = (omrobjectptr_t)destination;
+		return i;
+	}
+
+	/**
+	 * Find the sub areas that must be moved before sub area i can be. Objects only slide down, so they
+	 * are the sub areas below i that end above the destination of i, which are consecutive.
+	 *
+	 * @param subAreas[in] the sub area table of the region, with destinations computed
+	 * @param i[in] the sub area about to be moved
+	 * @return the lowest sub area to wait for; every sub area from it up to i - 1 must be moved first,
+	 * and i itself if there is none
+	 */
+	template <typename SubArea>
+	static MMINLINE intptr_t
+	getLowestOverlappedSubArea(SubArea *subAreas, intptr_t i)
+	{
+		intptr_t j = i;
+		while ((j > 0) && ((uintptr_t)subAreas[j].firstObject > (uintptr_t)subAreas[i].destination)) {
+			j -= 1;
+		}
+		return j;
+	}
+
+	/**
+	 * Wait until every sub area whose objects lie in the destination range of sub area i has been moved.
+	 * Sub areas are claimed in ascending order, so each one waited for is owned by a running thread.
+	 *
+	 * @param subAreas[in] the sub area table of the region, with destinations computed
+	 * @param i[in] the sub area about to be moved
+	 */
+	template <typename SubArea>
+	static void
+	waitForOverlappedSubAreas(SubArea *subAreas, intptr_t i)
+	{
+		for (intptr_t j = getLowestOverlappedSubArea(subAreas, i); j < i; j++) {
+			uintptr_t spinCount = 0;
+			while (SubArea::full != subAreas[j].state) {
+				if (spinCount < SLIDING_COMPACTION_SPIN_COUNT) {
+					MM_AtomicOperations::yieldCPU();
+					spinCount += 1;
+				} else {
+					omrthread_yield();
+				}
+			}
+		}
+		/* the objects moved by the sub areas waited for must be visible before they are overwritten */
+		MM_AtomicOperations::loadSync();
+	}
+};
+
+#endif /* SLIDINGCOMPACTION_HPP_ */
@@ -204,6 +204,9 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 #if defined(OMR_GC_OBJECT_ALLOCATION_NOTIFY)
 		env->objectAllocationNotify((omrobjectptr_t)result);
 #endif /* OMR_GC_OBJECT_ALLOCATION_NOTIFY */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+		env->getExtensions()->recordAllocationActivity();
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 		_stats._allocationBytes += allocDescription->getContiguousBytes();
 		_stats._allocationCount += 1;
 	}
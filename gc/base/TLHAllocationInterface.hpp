@@ -77,6 +77,20 @@ public:
 
 	virtual void flushCache(MM_EnvironmentBase *env);
 	virtual void restartCache(MM_EnvironmentBase *env);
+
+	/**
+	 * Report the sizing state of the thread's (zeroed) TLH.
+	 * @param refreshSize[out] size of the next TLH
+	 * @param refreshCount[out] number of refreshes since the last collection
+	 * @param refreshBytes[out] size of the TLHs taken since the last collection
+	 */
+	void
+	getTLHSizing(uintptr_t *refreshSize, uintptr_t *refreshCount, uintptr_t *refreshBytes)
+	{
+		*refreshSize = _tlhAllocationSupport.getRefreshSize();
+		*refreshCount = _tlhAllocationSupport._refreshCount;
+		*refreshBytes = _tlhAllocationSupport._refreshBytes;
+	}
 	
 	/* BEN TODO: Collapse the env->enable/disableInlineTLHAllocate with these enable/disableCachedAllocations */
 	virtual void enableCachedAllocations(MM_EnvironmentBase* env) { _cachedAllocationsEnabled = true; }
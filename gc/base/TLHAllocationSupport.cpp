@@ -113,6 +113,7 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	if(shouldFlush) {
 		_abandonedList = NULL;
 		_abandonedListSize = 0;
+		_batchList = NULL;
 		clear(env);
 	} else {
 		/* Clear current information accumulated */
@@ -142,7 +143,32 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		_tlh->refreshSize = adaptiveRefreshSize(env);
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+	_refreshCount = 0;
+	_refreshBytes = 0;
+}
+
+/**
+ * Fold the TLHs taken since the last restart into the allocation estimate of the thread, and size
+ * the next TLHs so that the estimate is covered by tlhAdaptiveRefreshTarget refreshes. Threads
+ * which stopped allocating see their estimate, and so their TLH size, decay at every collection.
+ * @return the refresh size for the next interval
+ */
+uintptr_t
+MM_TLHAllocationSupport::adaptiveRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	_allocationEstimate = ((_allocationEstimate * TLH_ADAPTIVE_HISTORY_WEIGHT) + ((uint64_t)_refreshBytes * (100 - TLH_ADAPTIVE_HISTORY_WEIGHT))) / 100;
+
+	uint64_t refreshSize = _allocationEstimate / OMR_MAX(extensions->tlhAdaptiveRefreshTarget, 1);
+	refreshSize = OMR_MAX(refreshSize, (uint64_t)extensions->tlhMinimumSize);
+	refreshSize = OMR_MIN(refreshSize, (uint64_t)extensions->tlhMaximumSize);
+	return MM_Math::roundToCeiling(sizeof(uintptr_t), (uintptr_t)refreshSize);
 }
 
 /**
@@ -154,6 +180,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	bool const compressed = extensions->compressObjectReferences();
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	extensions->recordAllocationActivity();
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 	/* Refresh the TLH only if the allocation request will fit in half the refresh size
 	 * or in the TLH minimum size.
 	 */
@@ -198,6 +228,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		clear(env);
 	}
 
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	/* Refresh latency is only reported to compare batched refreshes with fresh ones, so keep the clock off the default path */
+	bool timeRefresh = (1 < extensions->tlhRefreshBatchCount);
+	uint64_t refreshStartTime = timeRefresh ? omrtime_hires_clock() : 0;
 	bool didRefresh = false;
 	/* Try allocating a TLH */
 	if ((NULL != _abandonedList) && (sizeInBytesRequired <= tlhMinimumSize)) {
@@ -223,6 +257,31 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		stats->_tlhAllocatedReused += getSize();
 		stats->_tlhDiscardedBytes -= getSize();
 
+		didRefresh = true;
+	} else if ((NULL != _batchList) && (sizeInBytesRequired <= _batchList->getSize())) {
+		/* Take the next chunk of the last batched refresh, without going back to the memory pool */
+		MM_HeapLinkedFreeHeaderTLH *chunk = _batchList;
+		_batchList = (MM_HeapLinkedFreeHeaderTLH *)chunk->getNext(compressed);
+		setupTLH(env, (void *)chunk, (void *)chunk->afterEnd(), chunk->_memorySubSpace, chunk->_memoryPool);
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		if (_zeroTLH) {
+			if (0 != extensions->batchClearTLH) {
+				/* only the first chunk of a batch is cleared when it is carved */
+				void *base = getBase();
+				void *top = getTop();
+				OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+			}
+		}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
+		allocDescription->setTLHAllocation(true);
+		allocDescription->setNurseryAllocation(getMemorySubSpace()->getTypeFlags() == MEMORY_TYPE_NEW);
+		allocDescription->setMemoryPool(getMemoryPool());
+
+		stats->_tlhRefreshCountBatched += 1;
+		stats->_tlhAllocatedBatched += getSize();
+
 		didRefresh = true;
 	} else {
 		/* Try allocating a fresh TLH */
@@ -279,14 +338,26 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		 * Do not change stats here if TLH is flushed already
 		 */
 		if (0 < getSize()) {
+			if (timeRefresh) {
+				stats->recordTLHRefreshLatency(omrtime_hires_clock() - refreshStartTime);
+			}
 			reportRefreshCache(env);
 			stats->_tlhRequestedBytes += getRefreshSize();
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
-			/* Increase thread hungriness */
-			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
-				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+			_refreshCount += 1;
+			_refreshBytes += getSize();
+			if (extensions->tlhAdaptiveSizing) {
+				/* The thread allocates faster than estimated at the last restart */
+				if ((_refreshCount > extensions->tlhAdaptiveRefreshTarget) && (getRefreshSize() < tlhMaximumSize)) {
+					setRefreshSize(OMR_MIN(getRefreshSize() * 2, tlhMaximumSize));
+				}
+			} else {
+				/* Increase thread hungriness */
+				/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
+				if (getRefreshSize() < tlhMaximumSize) {
+					setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+				}
 			}
 		}
 	}
@@ -341,8 +412,19 @@ void *
 MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
 {
 	void *addrBase, *addrTop;
+	uintptr_t requestSize = getRefreshSize();
 
-	if(memoryPool->allocateTLH(env, allocDescription, getRefreshSize(), addrBase, addrTop)) {
+	/* Carve a new batch only once the previous one has been used up */
+	uintptr_t batchCount = env->getExtensions()->tlhRefreshBatchCount;
+	bool batched = (1 < batchCount) && (NULL == _batchList);
+	if (batched) {
+		requestSize *= batchCount;
+	}
+
+	if(memoryPool->allocateTLH(env, allocDescription, requestSize, addrBase, addrTop)) {
+		if (batched) {
+			addrTop = carveBatch(env, addrBase, addrTop, memorySubSpace, memoryPool);
+		}
 		setupTLH(env, addrBase, addrTop, memorySubSpace, memoryPool);
 		allocDescription->setMemorySubSpace(memorySubSpace);
 		allocDescription->setObjectFlags(memorySubSpace->getObjectFlags());
@@ -351,12 +433,62 @@ MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescrip
 	return NULL;
 }
 
+/**
+ * Split the memory returned by a batched TLH allocation into refresh sized chunks. The first chunk becomes
+ * the TLH and the others are kept in the batch list, from which later refreshes are served without locking
+ * the memory pool. The chunks are headed like free entries, so the heap stays walkable, and are dropped
+ * with the abandoned TLHs when the caches are flushed.
+ * @return the top of the first chunk
+ */
+void *
+MM_TLHAllocationSupport::carveBatch(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	bool const compressed = extensions->compressObjectReferences();
+	uintptr_t refreshSize = getRefreshSize();
+	uintptr_t tlhMinimumSize = extensions->tlhMinimumSize;
+	uint8_t *top = (uint8_t *)addrTop;
+
+	/* the memory pool may have returned less than requested */
+	if (((uintptr_t)top - (uintptr_t)addrBase) < (refreshSize + tlhMinimumSize)) {
+		return addrTop;
+	}
+
+	uint8_t *firstTop = (uint8_t *)addrBase + refreshSize;
+	uint8_t *chunkBase = firstTop;
+	MM_HeapLinkedFreeHeaderTLH *previous = NULL;
+	while (chunkBase < top) {
+		uintptr_t remainingSize = (uintptr_t)top - (uintptr_t)chunkBase;
+		/* a tail too small to be a TLH is given to the last chunk */
+		uintptr_t chunkSize = (remainingSize < (refreshSize + tlhMinimumSize)) ? remainingSize : refreshSize;
+		MM_HeapLinkedFreeHeaderTLH *chunk = (MM_HeapLinkedFreeHeaderTLH *)chunkBase;
+
+#if defined(OMR_VALGRIND_MEMCHECK)
+		valgrindMakeMemUndefined((uintptr_t)chunk, sizeof(MM_HeapLinkedFreeHeaderTLH));
+#endif /* defined(OMR_VALGRIND_MEMCHECK) */
+		chunk->setSize(chunkSize);
+		chunk->_memoryPool = memoryPool;
+		chunk->_memorySubSpace = memorySubSpace;
+		chunk->setNext(NULL, compressed);
+		if (NULL == previous) {
+			_batchList = chunk;
+		} else {
+			previous->setNext(chunk, compressed);
+		}
+		previous = chunk;
+		chunkBase += chunkSize;
+	}
+
+	return (void *)firstTop;
+}
+
 void
 MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 {
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
+	_batchList = NULL;
 	clear(env);
 }
 
@@ -50,6 +50,9 @@ struct OMR_VMThread;
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 
+/* Percentage of the previous allocation estimate kept when adaptive TLH sizing folds in a new interval */
+#define TLH_ADAPTIVE_HISTORY_WEIGHT 70
+
 class MM_HeapLinkedFreeHeaderTLH : public MM_HeapLinkedFreeHeader
 {
 public:
@@ -80,6 +83,11 @@ private:
 
 	MM_HeapLinkedFreeHeaderTLH *_abandonedList; /**< List of abandoned TLHs. Shaped like a free list. */
 	uintptr_t _abandonedListSize; /**< Number of entries in the abandoned list. */
+	MM_HeapLinkedFreeHeaderTLH *_batchList; /**< Chunks carved by the last batched fresh refresh, in address order. Shaped like a free list. */
+
+	uintptr_t _refreshCount; /**< Number of refreshes since the cache was last restarted. */
+	uintptr_t _refreshBytes; /**< Size of the TLHs taken since the cache was last restarted. */
+	uint64_t _allocationEstimate; /**< Smoothed size of the TLHs taken between two restarts, used by adaptive sizing. */
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
@@ -87,6 +95,7 @@ public:
 protected:
 private:
 	void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
+	void *carveBatch(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
 
 	void flushCache(MM_EnvironmentBase *env);
 
@@ -142,6 +151,7 @@ private:
 	void clear(MM_EnvironmentBase *env);
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
 	void restart(MM_EnvironmentBase *env);
+	uintptr_t adaptiveRefreshSize(MM_EnvironmentBase *env);
 	bool refresh(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
@@ -191,6 +201,10 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
+		_batchList(NULL),
+		_refreshCount(0),
+		_refreshBytes(0),
+		_allocationEstimate(0),
 		_zeroTLH(zeroTLH)
 	{};
 
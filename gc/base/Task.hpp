@@ -144,6 +144,13 @@ public:
 	 * @note All tasks must implement this method - the IDs are defined in @ref j9modron.h
 	 */
 	virtual uintptr_t getVMStateID(void) = 0;
+
+	/**
+	 * Return the amount of work done by the task, in task specific units (typically bytes), once all threads have completed it.
+	 * Used by the dispatcher to model the parallel efficiency of the task when adaptiveGCThreadCount is enabled.
+	 * @return the work done, or 0 if the task does not report its work
+	 */
+	virtual uintptr_t getCompletedWorkVolume(MM_EnvironmentBase *env) { return 0; }
 	
 	/**
 	 * Return true if threads are currently synchronized, false otherwise
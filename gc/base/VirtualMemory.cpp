@@ -211,6 +211,23 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
 	void* commitTop = (void*)MM_Math::roundToCeiling(_pageSize, (uintptr_t)address + size + _tailPadding);
 	uintptr_t commitSize;
 
+	if (OMR_ARE_ANY_BITS_SET(_mode, OMRPORT_VMEM_MEMORY_MODE_ADVISE_HUGEPAGE) && (commitBase < commitTop)) {
+		/*
+		 * A transparent huge page is only faulted in when its whole aligned range is committed and untouched,
+		 * so commit whole ones (within the reservation) rather than fault part of one in default pages first
+		 */
+		uintptr_t hugePageSize = OMR_MAX(_pageSize, _extensions->transparentHugePageSize);
+		uintptr_t reserveTop = (uintptr_t)_baseAddress + _reserveSize;
+		uintptr_t hugePageBase = MM_Math::roundToFloor(hugePageSize, (uintptr_t)commitBase);
+		uintptr_t hugePageTop = MM_Math::roundToCeiling(hugePageSize, (uintptr_t)commitTop);
+		if ((uintptr_t)_baseAddress < reserveTop) {
+			commitBase = (void*)OMR_MAX(hugePageBase, (uintptr_t)_baseAddress);
+			if (hugePageTop > (uintptr_t)commitTop) {
+				commitTop = (void*)OMR_MIN(hugePageTop, reserveTop);
+			}
+		}
+	}
+
 	if (commitBase <= commitTop) {
 		commitSize = (uintptr_t)commitTop - (uintptr_t)commitBase;
 	} else {
@@ -232,23 +249,21 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
 }
 
 /**
- * Decommit the address range from physical memory.
+ * Calculate the part of an address range which can be returned to the operating system.
  * @param address the start of the block to be decommitted
  * @param size the size of the block to be decommitted
  * @param lowValidAddress the end of the previous committed block below address, or NULL if address is the first committed block
  * @param highValidAddress the start of the next committed block above address, or NULL if address is the last committed block
- * @return true if successful, false otherwise.
+ * @param alignedBase[out] the page aligned start of the range to decommit
+ * @return the page aligned size of the range to decommit, or 0 if no page can be decommitted
  */
-bool
-MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+uintptr_t
+MM_VirtualMemory::calculateDecommitRange(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress, void** alignedBase)
 {
-	bool result = true;
 	void* decommitBase = address;
 	void* decommitTop = (void*)((uintptr_t)decommitBase + size + _tailPadding);
 	Assert_MM_true(0 != _pageSize);
 
-	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
-
 	if (NULL != lowValidAddress) {
 		/* Ensure that we do not decommit a valid page prior to address */
 		/* What about tail padding? Are we deleting someone's pad? */
@@ -266,18 +281,68 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 	}
 
 	/* port library takes page aligned addresses and sizes only */
-	decommitBase = (void*)MM_Math::roundToCeiling(_pageSize, (uintptr_t)decommitBase);
-	decommitTop = (void*)MM_Math::roundToFloor(_pageSize, (uintptr_t)decommitTop);
+	uintptr_t decommitAlignment = _pageSize;
+	if (OMR_ARE_ANY_BITS_SET(_mode, OMRPORT_VMEM_MEMORY_MODE_ADVISE_HUGEPAGE)) {
+		/* decommitting part of a transparent huge page would split it back into default pages */
+		decommitAlignment = OMR_MAX(_pageSize, _extensions->transparentHugePageSize);
+	}
+	decommitBase = (void*)MM_Math::roundToCeiling(decommitAlignment, (uintptr_t)decommitBase);
+	decommitTop = (void*)MM_Math::roundToFloor(decommitAlignment, (uintptr_t)decommitTop);
+
+	*alignedBase = decommitBase;
+	return (decommitBase < decommitTop) ? ((uintptr_t)decommitTop - (uintptr_t)decommitBase) : 0;
+}
+
+/**
+ * Decommit the address range from physical memory.
+ * @param address the start of the block to be decommitted
+ * @param size the size of the block to be decommitted
+ * @param lowValidAddress the end of the previous committed block below address, or NULL if address is the first committed block
+ * @param highValidAddress the start of the next committed block above address, or NULL if address is the last committed block
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	bool result = true;
+	void* decommitBase = NULL;
+	uintptr_t decommitSize = calculateDecommitRange(address, size, lowValidAddress, highValidAddress, &decommitBase);
 
-	if (decommitBase < decommitTop) {
-		/* There is still memory to decommit, calculate size */
-		uintptr_t decommitSize = ((uintptr_t)decommitTop) - ((uintptr_t)decommitBase);
+	if (0 != decommitSize) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
 		result = omrvmem_decommit_memory(decommitBase, decommitSize, &_identifier) == 0;
 	}
 
 	return result;
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+/**
+ * Release the physical memory behind a free address range. With gcOnIdleReleaseLazily the range is
+ * left committed and, where the operating system supports it, the pages are only reclaimed under
+ * memory pressure; otherwise the range is decommitted. The parameters are as for decommitMemory().
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_VirtualMemory::releaseMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	bool result = true;
+	void* releaseBase = NULL;
+	uintptr_t releaseSize = calculateDecommitRange(address, size, lowValidAddress, highValidAddress, &releaseBase);
+
+	if (0 != releaseSize) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		if (_extensions->gcOnIdleReleaseLazily) {
+			result = omrvmem_release_memory(releaseBase, releaseSize, &_identifier) == 0;
+		} else {
+			result = omrvmem_decommit_memory(releaseBase, releaseSize, &_identifier) == 0;
+		}
+	}
+
+	return result;
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 void
 MM_VirtualMemory::tearDown(MM_EnvironmentBase* env)
 {
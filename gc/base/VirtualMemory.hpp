@@ -70,6 +70,7 @@ public:
  */
 private:
 	bool freeMemory();
+	uintptr_t calculateDecommitRange(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress, void** alignedBase);
 
 protected:
 	/*
@@ -108,6 +109,9 @@ protected:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	virtual bool releaseMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	void roundDownTop(uintptr_t rounding);
 
 	/*
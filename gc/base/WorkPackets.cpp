@@ -87,23 +87,23 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 
 	heapSize = _extensions->heap->getMaximumMemorySize();
 
-	if (!_emptyPacketList.initialize(env)) {
+	if (!_emptyPacketList.initialize(env, _extensions->packetListLockFree)) {
 		return false;
 	}
-	if (!_fullPacketList.initialize(env)) {
+	if (!_fullPacketList.initialize(env, _extensions->packetListLockFree)) {
 		return false;
 	}
-	if (!_nonEmptyPacketList.initialize(env)) {
+	if (!_nonEmptyPacketList.initialize(env, _extensions->packetListLockFree)) {
 		return false;
 	}
-	if (!_relativelyFullPacketList.initialize(env)) {
+	if (!_relativelyFullPacketList.initialize(env, _extensions->packetListLockFree)) {
 		return false;
 	}
-	if (!_deferredPacketList.initialize(env)) {
+	if (!_deferredPacketList.initialize(env, _extensions->packetListLockFree)) {
 		return false;
 	}
 	
-	if (!_deferredFullPacketList.initialize(env)) {
+	if (!_deferredFullPacketList.initialize(env, _extensions->packetListLockFree)) {
 		return false;
 	}
 
@@ -261,29 +261,18 @@ MM_WorkPackets::reset(MM_EnvironmentBase *env)
 void
 MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 {	
-	MM_Packet *packet;
-	
-	while(NULL != (packet = getPacket(env, &_fullPacketList))) {
-		packet->resetData(env);
-		putPacket(env, packet);
-	}
-	while(NULL != (packet = getPacket(env, &_relativelyFullPacketList))) {
-		packet->resetData(env);
-		putPacket(env, packet);
-	}
-	while(NULL != (packet = getPacket(env, &_nonEmptyPacketList))) {
-		packet->resetData(env);
-		putPacket(env, packet);
-	}
-
-	while(NULL != (packet = getPacket(env, &_deferredPacketList))) {
-		packet->resetData(env); 
-		putPacket(env, packet);
-	}
-
-	while(NULL != (packet = getPacket(env, &_deferredFullPacketList))) {
-		packet->resetData(env);
-		putPacket(env, packet);
+	MM_PacketList *lists[] = {&_fullPacketList, &_relativelyFullPacketList, &_nonEmptyPacketList, &_deferredPacketList, &_deferredFullPacketList};
+	MM_Packet *packets[_packetBatchSize];
+
+	for (uintptr_t i = 0; i < sizeof(lists) / sizeof(lists[0]); i++) {
+		uintptr_t count = 0;
+		while (0 != (count = lists[i]->popBatch(env, packets, _packetBatchSize))) {
+			for (uintptr_t j = 0; j < count; j++) {
+				packets[j]->setOwner(env);
+				packets[j]->resetData(env);
+			}
+			putPackets(env, packets, count);
+		}
 	}
 
 	/* Do sanity check on ctrs */	
@@ -300,7 +289,8 @@ MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 void
 MM_WorkPackets::reuseDeferredPackets(MM_EnvironmentBase *env)
 {
-	MM_Packet *packet;
+	MM_Packet *packets[_packetBatchSize];
+	uintptr_t count = 0;
 
 	if(_deferredPacketList.isEmpty() && _deferredFullPacketList.isEmpty()) {
 		/* Both deferred lists are empty, so there is nothing to do */
@@ -309,15 +299,21 @@ MM_WorkPackets::reuseDeferredPackets(MM_EnvironmentBase *env)
 
 	/* Un-defer all partially full packets */
 	if(!_deferredPacketList.isEmpty()) {
-		while(NULL != (packet = getPacket(env, &_deferredPacketList))) {
-			putPacket(env, packet);
+		while(0 != (count = _deferredPacketList.popBatch(env, packets, _packetBatchSize))) {
+			for (uintptr_t i = 0; i < count; i++) {
+				packets[i]->setOwner(env);
+			}
+			putPackets(env, packets, count);
 		}
 	}
 	
 	/* Un-defer all totally full packets */
 	if(!_deferredFullPacketList.isEmpty()) {
-		while(NULL != (packet = getPacket(env, &_deferredFullPacketList))) {
-			putPacket(env, packet);
+		while(0 != (count = _deferredFullPacketList.popBatch(env, packets, _packetBatchSize))) {
+			for (uintptr_t i = 0; i < count; i++) {
+				packets[i]->setOwner(env);
+			}
+			putPackets(env, packets, count);
 		}
 	}
 }
@@ -332,7 +328,8 @@ MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
-				|| (!_overflowHandler->isEmpty()));
+				|| (!_overflowHandler->isEmpty())
+				|| ((NULL != _queuedInputPacketList) && !_queuedInputPacketList->isEmpty()));
 				
 	return res;
 }
@@ -601,7 +598,8 @@ MM_WorkPackets::getPacketByOverflowing(MM_EnvironmentBase *env)
 }
 
 /**
- * Get the least-full packet that has capacity of at least the given number of slots
+ * Get the least-full packet that has capacity of at least the given number of slots.
+ * Candidates are taken off the lists in batches, and the ones not selected are put back in a batch.
  * 
  * @param requiredSlots The required number of free slots
  * @return pointer to a packet, or NULL if none found
@@ -610,68 +608,66 @@ MM_Packet *
 MM_WorkPackets::getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots)
 {
 	MM_Packet *temps[_maxPacketSearch];
-	int i, j, selected;
+	uintptr_t count = 0;
+	intptr_t selected = -1;
 	intptr_t maxCapacity = requiredSlots - 1; 
-	intptr_t curCapacity;
-	int satisfactoryCapacity = OMR_MAX(_satisfactoryCapacity, requiredSlots);
+	intptr_t satisfactoryCapacity = OMR_MAX(_satisfactoryCapacity, requiredSlots);
+	MM_PacketList *list = &_nonEmptyPacketList;
 
 	/* Search for a satisfactory packet */
-	selected = -1;
-	for(j = 0, i = 0; i < _maxPacketSearch; i++) {
-
-		/* Get a packet from either the non empty list or the relatively 
-		 * full list. If this fails then leave the loop as there are no more 
-		 * packets available
-		 */
-		if(NULL == (temps[i] = getPacket(env, &_nonEmptyPacketList))) {
-			if(NULL == (temps[i] = getPacket(env, &_relativelyFullPacketList))) {
+	while (count < _maxPacketSearch) {
+		uintptr_t popped = list->popBatch(env, &temps[count], OMR_MIN((uintptr_t)_packetBatchSize, _maxPacketSearch - count));
+		if (0 == popped) {
+			/* Move on to the relatively full list once the non empty list is exhausted, unless we 
+			 * already have a non empty packet as we are not going to find a better packet there.
+			 */
+			if ((&_relativelyFullPacketList == list) || (maxCapacity >= _fullPacketThreshold)) {
 				break;
 			}
+			list = &_relativelyFullPacketList;
+			continue;
 		}
-		j += 1;
 
-		/* If this packet has the greatest capacity so far, then select it. 
-		 * If the capacity has reached the satisfactory level, then leave 
-		 * the loop. If we have alrady got a non empty packet and we are now 
-		 * on the relatively full list, then leave the loop as we are not 
-		 * going to find a better packet.
-		 */
-		curCapacity = temps[i]->freeSlots();
-		if(curCapacity > maxCapacity) {
-			maxCapacity = curCapacity;
-			selected = i;
-			if(satisfactoryCapacity <= maxCapacity) {
-				break; 
-			}
-		} else {
-			if((maxCapacity >= _fullPacketThreshold)   /* we have a non-empty packet already */
-			&& (curCapacity < _fullPacketThreshold)) {   /* we got to the full packet list */
-				break;
+		/* If a packet has the greatest capacity so far, then select it */
+		for (uintptr_t i = count; i < (count + popped); i++) {
+			temps[i]->setOwner(env);
+			intptr_t curCapacity = temps[i]->freeSlots();
+			if (curCapacity > maxCapacity) {
+				maxCapacity = curCapacity;
+				selected = i;
 			}
 		}
+		count += popped;
+
+		/* If the capacity has reached the satisfactory level, then leave the loop */
+		if (satisfactoryCapacity <= maxCapacity) {
+			break;
+		}
 	}
 
 	/* If we didn't get any packets then return */
-	if(0 == j) {
+	if (0 == count) {
 		return NULL;
 	}
 
 	/* Return the non selected packets. */
-	while(j > 0) {
-		j -= 1;
-		if(j != selected) {
-			putPacket(env, temps[j]);
-		}
+	if (-1 != selected) {
+		count -= 1;
+		MM_Packet *selectedPacket = temps[selected];
+		temps[selected] = temps[count];
+		temps[count] = selectedPacket;
+	}
+	if (0 != count) {
+		putPackets(env, temps, count);
 	}
 
 	/* Return the selected packet. If here is not a selected packet, 
 	 * then return NULL.
 	 */
-	if(-1 == selected) {
+	if (-1 == selected) {
 		return NULL;
-	} else {
-		return temps[selected];
 	}
+	return temps[count];
 }
 
 /**
@@ -739,6 +735,63 @@ MM_WorkPackets::putPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 	}
 }
 
+/**
+ * Put a batch of packets back to the correct lists, with a single push on each list
+ * 
+ * @param packets The packets to put back
+ * @param count The number of packets
+ */
+void
+MM_WorkPackets::putPackets(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count)
+{
+	MM_PacketList *lists[] = {&_emptyPacketList, &_fullPacketList, &_relativelyFullPacketList, &_nonEmptyPacketList};
+	MM_Packet *heads[] = {NULL, NULL, NULL, NULL};
+	MM_Packet *tails[] = {NULL, NULL, NULL, NULL};
+	uintptr_t counts[] = {0, 0, 0, 0};
+	bool mustNotifyWaitingThreads = false;
+
+	/* chain the packets of each list, in the order putPacket() would choose the list */
+	for (uintptr_t i = 0; i < count; i++) {
+		MM_Packet *packet = packets[i];
+		uintptr_t freeSlots = packet->freeSlots();
+		uintptr_t index = 0;
+
+		if (freeSlots == _slotsInPacket) {
+			index = 0;
+			packet->clearOwner();
+		} else {
+			if (freeSlots == 0) {
+				index = 1;
+			} else if (freeSlots < _fullPacketThreshold) {
+				index = 2;
+			} else {
+				index = 3;
+			}
+			packet->resetOwner();
+		}
+
+		packet->_next = heads[index];
+		if (NULL == heads[index]) {
+			tails[index] = packet;
+		}
+		heads[index] = packet;
+		counts[index] += 1;
+	}
+
+	for (uintptr_t index = 0; index < sizeof(lists) / sizeof(lists[0]); index++) {
+		if (0 != counts[index]) {
+			if (0 != index) {
+				mustNotifyWaitingThreads = mustNotifyWaitingThreads || lists[index]->isEmpty();
+			}
+			lists[index]->pushBatch(env, heads[index], tails[index], counts[index]);
+		}
+	}
+
+	if(mustNotifyWaitingThreads && (_inputListWaitCount > 0)) {
+		notifyWaitingThreads(env);
+	}
+}
+
 void
 MM_WorkPackets::notifyWaitingThreads(MM_EnvironmentBase *env)
 {
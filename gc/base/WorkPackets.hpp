@@ -64,7 +64,8 @@ protected:
 		_fullPacketThreshold = _slotsInPacket >> 4,
 		_satisfactoryCapacity = _slotsInPacket / 2,
 		_indexMask = 0xff,
-		_maxPacketSearch = 20
+		_maxPacketSearch = 20,
+		_packetBatchSize = 4
 	};
 
 	uintptr_t _packetsPerBlock;
@@ -79,6 +80,7 @@ protected:
 	MM_PacketList _nonEmptyPacketList;  /**< List for non empty packets */
 	MM_PacketList _deferredPacketList;  /**< List for deferred packets */
 	MM_PacketList _deferredFullPacketList;  /**< List for full deferred packets */
+	MM_PacketList *_queuedInputPacketList; /**< Packets which are input, but only reach the lists above when a subclass moves them (NULL if none) */
 	
 	OMRPortLibrary *_portLibrary;
 
@@ -115,6 +117,7 @@ public:
 	virtual MM_Packet *getInputPacket(MM_EnvironmentBase *env);
 	virtual MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
 	void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	void putPackets(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count);
 	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	
 	MM_Packet *getDeferredPacket(MM_EnvironmentBase *env);
@@ -232,6 +235,7 @@ public:
 		_nonEmptyPacketList(env),
 		_deferredPacketList(env),
 		_deferredFullPacketList(env),
+		_queuedInputPacketList(NULL),
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
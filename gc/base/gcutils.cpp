@@ -190,6 +190,8 @@ getContractReasonAsString(ContractReason reason)
 		return "heap reconfiguration";
 	case FORCED_NURSERY_CONTRACT:
 		return "forced nursery contract";
+	case FORECAST_GC_OVERHEAD_TOO_LOW:
+		return "forecast gc overhead below target";
 	default:
 		return "unknown";
 	}
@@ -217,6 +219,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case FORECAST_GC_OVERHEAD_TOO_HIGH:
+		return "forecast gc overhead above target";
 	default:
 		return "unknown";
 	}
@@ -26,6 +26,7 @@
 #include "AllocationContextSegregated.hpp"
 #include "EnvironmentBase.hpp"
 #include "RegionPoolSegregated.hpp"
+#include "SizeClassStatsSegregated.hpp"
 #include "SweepSchemeSegregated.hpp"
 
 #include "GlobalAllocationManagerSegregated.hpp"
@@ -168,4 +169,10 @@ MM_GlobalAllocationManagerSegregated::flushCachedFullRegions(MM_EnvironmentBase
 	}
 }
 
+void
+MM_GlobalAllocationManagerSegregated::getSizeClassStats(MM_EnvironmentBase *env, MM_SizeClassStatsSegregated *stats)
+{
+	*stats = *_regionPool->getSizeClassStats();
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
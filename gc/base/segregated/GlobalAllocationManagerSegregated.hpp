@@ -33,6 +33,7 @@ class MM_AllocationContextSegregated;
 class MM_EnvironmentBase;
 class MM_RegionPoolSegregated;
 class MM_SegregatedMarkingScheme;
+class MM_SizeClassStatsSegregated;
 class MM_SweepSchemeSegregated;
 
 class MM_GlobalAllocationManagerSegregated : public MM_GlobalAllocationManager
@@ -93,6 +94,13 @@ public:
 	 */
 	void flushCachedFullRegions(MM_EnvironmentBase *env);
 
+	/**
+	 * Fetch the per size class counters published at the end of the last sweep. The counters are only
+	 * maintained when the segregatedSizeClassStats option is enabled, and are zero otherwise.
+	 * @param stats[out] receives a copy of the counters
+	 */
+	void getSizeClassStats(MM_EnvironmentBase *env, MM_SizeClassStatsSegregated *stats);
+
 	MM_RegionPoolSegregated *getRegionPool() { return _regionPool; }
 
 };
@@ -51,6 +51,7 @@ private:
 	MM_HeapRegionManager *_regionManager;
 	OMR_SizeClasses *_segregatedSizeClasses;
 	uintptr_t _nextArrayletIndex; /**< next arraylet to use for allocation */
+	uintptr_t _lastSmallSizeClass; /**< the small size class this region was last allocated for, or 0 if it never was (survives freeing the region) */
 	
 	/*
 	 * Function members
@@ -65,6 +66,7 @@ public:
 		,_regionManager(NULL)
 		,_segregatedSizeClasses(env->getOmrVM()->_sizeClasses)
 		,_nextArrayletIndex(0)
+		,_lastSmallSizeClass(0)
 	{
 		_arrayletBackPointers = ((uintptr_t **)(this + 1));
 		_typeId = __FUNCTION__;
@@ -84,6 +86,8 @@ public:
 	MMINLINE MM_MemoryPoolAggregatedCellList *getMemoryPoolACL() { return (MM_MemoryPoolAggregatedCellList *)getMemoryPool(); }
 	void setSizeClass(uintptr_t sizeClass) {_sizeClass = sizeClass;}
 	uintptr_t getSizeClass() {return _sizeClass;}
+	void setLastSmallSizeClass(uintptr_t sizeClass) {_lastSmallSizeClass = sizeClass;}
+	uintptr_t getLastSmallSizeClass() {return _lastSmallSizeClass;}
 	uintptr_t getCellSize()
 	{
 		OMR_SizeClasses *sizeClasses = _segregatedSizeClasses;
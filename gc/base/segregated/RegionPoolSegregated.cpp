@@ -217,6 +217,8 @@ void
 MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 {
 	_currentTotalCountOfSweepRegions = 0;
+	_onDemandSweptRegionCount = 0;
+	_backgroundSweptRegionCount = 0;
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		_darkMatterCellCount[sizeClass] = 0;
 		_smallSweepRegions[sizeClass]->enqueue(_smallFullRegions[sizeClass]);
@@ -310,6 +312,18 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 	
 	if (region != NULL) {
 		incrementRegionsInUse(region->getRange()); /* we must add here because we will return remainder later */
+
+		if (region->isSmall()) {
+			uintptr_t lastSizeClass = region->getLastSmallSizeClass();
+			if (lastSizeClass != szClass) {
+				if ((0 != lastSizeClass) && env->getExtensions()->segregatedSizeClassStats) {
+					/* the region changes hands between size classes, a sign that one of them has to borrow from the others */
+					MM_AtomicOperations::add((volatile uintptr_t *)&_sizeClassStats.regionFlipsIn[szClass], 1);
+					MM_AtomicOperations::add((volatile uintptr_t *)&_sizeClassStats.regionFlipsOut[lastSizeClass], 1);
+				}
+				region->setLastSmallSizeClass(szClass);
+			}
+		}
 		
 		/* We must notify the allocation tracker that a fresh region has been allocated, it will know how to
 		 * account for bytes lost to internal fragmentation and will account for all the memory allocated
@@ -321,6 +335,13 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 	return region;
 }
 
+void
+MM_RegionPoolSegregated::publishSizeClassStats(MM_EnvironmentBase *env)
+{
+	_publishedSizeClassStats = _sizeClassStats;
+	_sizeClassStats.clear();
+}
+
 /* join the lists for each buckets per size class, per split index */
 void
 MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
@@ -412,6 +433,7 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 		_smallOccupancy[sizeClass] = (_smallOccupancy[sizeClass] * 0.9f) + (region->getMemoryPoolACL()->getMarkCount() / region->getNumCells() * 0.1f );
 		decrementCurrentCountOfSweepRegions(sizeClass, 1);
 		decrementCurrentTotalCountOfSweepRegions(1);
+		MM_AtomicOperations::add(&_onDemandSweptRegionCount, 1);
 		_smallFullRegions[sizeClass]->enqueue(region);
 	}
 	return region;
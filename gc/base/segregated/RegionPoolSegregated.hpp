@@ -30,6 +30,7 @@
 #include "HeapRegionManager.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "RegionPool.hpp"
+#include "SizeClassStatsSegregated.hpp"
 #include "SweepSchemeSegregated.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -136,6 +137,10 @@ private:
 	volatile uintptr_t _currentTotalCountOfSweepRegions;
 	
 	bool _isSweepingSmall; /**< if GC is sweeping small pages */
+	volatile uintptr_t _onDemandSweptRegionCount; /**< small regions swept by allocating threads since the last pause */
+	volatile uintptr_t _backgroundSweptRegionCount; /**< small regions swept by background helpers since the last pause */
+	MM_SizeClassStatsSegregated _sizeClassStats; /**< per size class counters accumulated since they were last published (segregatedSizeClassStats only) */
+	MM_SizeClassStatsSegregated _publishedSizeClassStats; /**< per size class counters as of the end of the last sweep */
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
 	uint8_t _skipAvailableRegionForAllocation[OMR_SIZECLASSES_NUM_SMALL+1]; /* per size class flag to indicate if there is any available regions left for allocation for that size class */
 
@@ -225,6 +230,30 @@ public:
 		MM_AtomicOperations::subtract(&_currentTotalCountOfSweepRegions, count);
 	}
 	
+	MMINLINE uintptr_t getOnDemandSweptRegionCount() const { return _onDemandSweptRegionCount; }
+	MMINLINE uintptr_t getBackgroundSweptRegionCount() const { return _backgroundSweptRegionCount; }
+
+	MMINLINE void addBackgroundSweptRegions(uintptr_t count)
+	{
+		MM_AtomicOperations::add(&_backgroundSweptRegionCount, count);
+	}
+
+	/**
+	 * Add per size class counters collected privately by an allocating or sweeping thread.
+	 * @param stats[in] the counters to add
+	 */
+	MMINLINE void mergeSizeClassStats(MM_SizeClassStatsSegregated *stats)
+	{
+		_sizeClassStats.mergeAtomic(stats);
+	}
+
+	/**
+	 * Make the counters accumulated since the last call visible through getSizeClassStats() and restart
+	 * them. Called by the main GC thread at the end of the sweep.
+	 */
+	void publishSizeClassStats(MM_EnvironmentBase *env);
+	MMINLINE MM_SizeClassStatsSegregated *getSizeClassStats() { return &_publishedSizeClassStats; }
+
 	MMINLINE void addDarkMatterCellsAfterSweepForSizeClass(uintptr_t sizeClass, uintptr_t cellCount) {
 		MM_AtomicOperations::add(&_darkMatterCellCount[sizeClass], cellCount);
 	}	
@@ -277,6 +306,8 @@ public:
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
 		, _isSweepingSmall(false)
+		, _onDemandSweptRegionCount(0)
+		, _backgroundSweptRegionCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -30,11 +30,14 @@
 #include "EnvironmentBase.hpp"
 #include "FrequentObjectsStats.hpp"
 #include "GCExtensionsBase.hpp"
+#include "GlobalAllocationManagerSegregated.hpp"
 #include "Heap.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "SizeClasses.hpp"
 #include "ObjectHeapIteratorSegregated.hpp"
+#include "RegionPoolSegregated.hpp"
+#include "SizeClassStatsSegregated.hpp"
 
 #include "SegregatedAllocationInterface.hpp"
 
@@ -251,7 +254,23 @@ MM_SegregatedAllocationInterface::allocateArrayletLeaf(MM_EnvironmentBase *env,
 void
 MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 {
+	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool const compressed = env->compressObjectReferences();
+
+	MM_GlobalAllocationManagerSegregated *gam = (MM_GlobalAllocationManagerSegregated *)extensions->globalAllocationManager;
+	if (extensions->segregatedSizeClassStats && (NULL != gam)) {
+		/* Cells are counted in bulk: whatever was pre-allocated and is no longer in the cache was handed out,
+		 * whether by the GC or by inlined allocation code.
+		 */
+		MM_SizeClassStatsSegregated stats;
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			uintptr_t allocatedBytes = (uintptr_t)_allocationCacheStats.bytesPreAllocatedSinceFlush[sizeClass] - getAllocatableSize(sizeClass);
+			stats.allocatedCells[sizeClass] = allocatedBytes / _sizeClasses->getCellSize(sizeClass);
+		}
+		gam->getRegionPool()->mergeSizeClassStats(&stats);
+	}
+	memset(&(_allocationCacheStats.bytesPreAllocatedSinceFlush), 0, sizeof(_allocationCacheStats.bytesPreAllocatedSinceFlush));
+
 	/* make the current caches walkable */
 	for (uintptr_t sizeClass = 0; sizeClass < OMR_SIZECLASSES_NUM_SMALL+1; sizeClass++) {
 		if (_allocationCache[sizeClass].current < _allocationCache[sizeClass].top) {
@@ -262,7 +281,7 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 		}
 	}
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
-	env->getExtensions()->allocationStats.merge(&_stats);
+	extensions->allocationStats.merge(&_stats);
 	_stats.clear();
 }
 
@@ -322,6 +341,7 @@ MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintpt
 	_allocationCache[sizeClass].current = cellLink;
 	_allocationCacheBases[sizeClass] = cellLink;
 	_allocationCache[sizeClass].top = (uintptr_t *)((uintptr_t)cellLink + cacheSize);
+	_allocationCacheStats.bytesPreAllocatedSinceFlush[sizeClass] += cacheSize;
 	
 	if (_cachedAllocationsEnabled) {
 		/* Update the allocation stats. */
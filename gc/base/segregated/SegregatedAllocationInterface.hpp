@@ -39,6 +39,7 @@ typedef struct SegregatedAllocationCacheStats {
 	uint64_t replenishesTotal[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The amount of times the cache has been replenished since the cache has existed (per size class). */
 	uint64_t bytesPreAllocatedSinceRestart[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The count of cells pre-allocated since the cache was last flushed. */
 	uint64_t replenishesSinceRestart[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The amount of times the cache has been replenished since the cache was last flushed. */
+	uint64_t bytesPreAllocatedSinceFlush[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The count of bytes pre-allocated since the cache was last made walkable, used for the per size class allocation counts. */
 } SegregatedAllocationCacheStats;
 
 class MM_SegregatedAllocationInterface : public MM_ObjectAllocationInterface 
@@ -20,6 +20,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "omrutil.h"
+
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
@@ -30,6 +32,7 @@
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelDispatcher.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SegregatedSweepTask.hpp"
@@ -48,6 +51,23 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+extern "C" {
+
+/**
+ * Background sweep helper thread procedure
+ *
+ * @parm info Address of the MM_SegregatedGC which created the thread
+ */
+static int J9THREAD_PROC
+segregated_sweep_helper_thread_proc(void *info)
+{
+	((MM_SegregatedGC *)info)->sweepHelperEntryPoint();
+
+	return 0;
+}
+
+} /* extern "C" */
+
 /**
  * Initialization
  */
@@ -94,6 +114,11 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	if (0 != omrthread_monitor_init_with_name(&_sweepHelpersMonitor, 0, "MM_SegregatedGC::sweepHelpers")) {
+		return false;
+	}
+
 	return true;
 }
 
@@ -112,6 +137,11 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+	if (NULL != _sweepHelpersMonitor) {
+		omrthread_monitor_destroy(_sweepHelpersMonitor);
+		_sweepHelpersMonitor = NULL;
+	}
 }
 
 bool
@@ -129,12 +159,153 @@ MM_SegregatedGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *sub
 bool
 MM_SegregatedGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
+	/* The background sweep helpers are attached by the first pause (see resumeSweepHelpers()): the collector
+	 * is started before the default memory space, and attaching a thread needs its allocation manager.
+	 */
 	return true;
 }
 
 void
 MM_SegregatedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	shutdownSweepHelpers(extensions);
+}
+
+/**
+ * Create the background sweep helper threads. They run at minimum priority, so that they only use
+ * processor time left over by the application; allocating threads sweep whatever the helpers did not reach.
+ * This is called at the end of a pause, with the VM thread list locked by exclusive access, so the
+ * helpers are not waited for: each one attaches itself to the VM once the pause is over.
+ */
+void
+MM_SegregatedGC::initializeSweepHelpers(MM_GCExtensionsBase *extensions)
+{
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	while (_sweepHelpersStarted < extensions->segregatedConcurrentSweepHelperThreads) {
+		omrthread_t thread = NULL;
+		intptr_t threadForkResult = createThreadWithCategory(&thread,
+							OMR_OS_STACK_SIZE,
+							J9THREAD_PRIORITY_MIN,
+							0,
+							segregated_sweep_helper_thread_proc,
+							(void *)this,
+							J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+		if (0 != threadForkResult) {
+			break;
+		}
+		_sweepHelpersStarted += 1;
+	}
+	omrthread_monitor_exit(_sweepHelpersMonitor);
+}
+
+/**
+ * Ask all the background sweep helpers to terminate, and wait for them to do so.
+ */
+void
+MM_SegregatedGC::shutdownSweepHelpers(MM_GCExtensionsBase *extensions)
+{
+	if (0 < _sweepHelpersStarted) {
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		_sweepHelpersRequest = SWEEP_HELPER_SHUTDOWN;
+		omrthread_monitor_notify_all(_sweepHelpersMonitor);
+		while (_sweepHelpersShutdownCount < _sweepHelpersStarted) {
+			omrthread_monitor_wait(_sweepHelpersMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersMonitor);
+	}
+}
+
+/**
+ * Wake the background sweep helpers up at the end of a pause that left small regions unswept,
+ * attaching them first if this is the first pause.
+ */
+void
+MM_SegregatedGC::resumeSweepHelpers(MM_EnvironmentBase *env)
+{
+	if (!_sweepHelpersInitialized) {
+		_sweepHelpersInitialized = true;
+		/* helpers that fail to start are not fatal: allocating threads sweep whatever is left */
+		initializeSweepHelpers(_extensions);
+	}
+
+	if (0 < _sweepHelpersStarted) {
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		if (SWEEP_HELPER_WAIT == _sweepHelpersRequest) {
+			_sweepHelpersRequest = SWEEP_HELPER_SWEEP;
+			omrthread_monitor_notify_all(_sweepHelpersMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersMonitor);
+	}
+}
+
+MM_SegregatedGC::SweepHelperRequest
+MM_SegregatedGC::getSweepHelperRequest(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	SweepHelperRequest result = _sweepHelpersRequest;
+	omrthread_monitor_exit(_sweepHelpersMonitor);
+	return result;
+}
+
+void
+MM_SegregatedGC::switchSweepHelperRequest(SweepHelperRequest from, SweepHelperRequest to)
+{
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	if (from == _sweepHelpersRequest) {
+		_sweepHelpersRequest = to;
+	}
+	omrthread_monitor_exit(_sweepHelpersMonitor);
+}
+
+void
+MM_SegregatedGC::sweepHelperEntryPoint()
+{
+	OMR_VMThread *omrThread = MM_EnvironmentBase::attachVMThread(_extensions->getOmrVM(), "Segregated Sweep Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	if (NULL == omrThread) {
+		/* count the helper as terminated so that shutdownSweepHelpers() does not wait for it */
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		_sweepHelpersShutdownCount += 1;
+		omrthread_monitor_notify_all(_sweepHelpersMonitor);
+		omrthread_exit(_sweepHelpersMonitor);
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	SweepHelperRequest request = SWEEP_HELPER_WAIT;
+
+	/* Thread not a mutator so identify its type */
+	env->initializeGCThread();
+	env->setThreadType(CON_SWEEP_HELPER_THREAD);
+
+	while (SWEEP_HELPER_SHUTDOWN != request) {
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		while (SWEEP_HELPER_WAIT == (request = _sweepHelpersRequest)) {
+			omrthread_monitor_wait(_sweepHelpersMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersMonitor);
+
+		if (SWEEP_HELPER_SWEEP == request) {
+			/* Holding VM access keeps the next collection from starting while a region is being swept */
+			env->acquireVMAccess();
+			bool sweepComplete = false;
+			while (!sweepComplete && !env->isExclusiveAccessRequestWaiting() && (SWEEP_HELPER_SWEEP == getSweepHelperRequest(env))) {
+				sweepComplete = (0 == _sweepScheme->concurrentSweepSmall(env));
+			}
+			if (sweepComplete) {
+				/* Switch to waiting before giving VM access up: the next pause can only resume the helpers after this */
+				switchSweepHelperRequest(SWEEP_HELPER_SWEEP, SWEEP_HELPER_WAIT);
+			}
+			env->releaseVMAccess();
+			/* If a collection is waiting, this blocks until it completes; the pause leaves new regions to sweep */
+		}
+		request = getSweepHelperRequest(env);
+	}
+
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	_sweepHelpersShutdownCount += 1;
+	omrthread_monitor_notify_all(_sweepHelpersMonitor);
+	omrthread_exit(_sweepHelpersMonitor);
 }
 
 void *
@@ -179,6 +350,11 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	_extensions->globalGCStats.clear();
 	_extensions->globalGCStats.gcCount++;
 
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool();
+	if (_extensions->segregatedConcurrentSweep) {
+		reportConcurrentSweepStats(env, memoryPool);
+	}
+
 	/*
 	 * Marking
 	 */
@@ -210,6 +386,10 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
+	if (_extensions->markingClassHistogram) {
+		_markingScheme->takeClassHistogram(env, &_extensions->globalGCStats.classHistogram);
+	}
+
 	/* Do any post mark checks */
 	/* OMRTODO we need to implement this function for segregated marking scheme */
 //	_markingScheme->mainCleanupAfterGC(env);
@@ -222,8 +402,12 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
-	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
+	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool);
 	_dispatcher->run(env, &sweepTask);
+	if (_extensions->segregatedSizeClassStats) {
+		/* with segregatedConcurrentSweep, this includes the small regions swept after the previous pause */
+		memoryPool->getRegionPool()->publishSizeClassStats(env);
+	}
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
 	/* We now have accurate free space statistics so recalculate any expand/contract amount */
@@ -244,6 +428,11 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 		((MM_SegregatedAllocationInterface *)(walkEnv->_objectAllocationInterface))->restartCache(walkEnv);
 	}
 
+	if (_extensions->segregatedConcurrentSweep) {
+		/* small regions were left unswept: hand them to the background helpers */
+		resumeSweepHelpers(env);
+	}
+
 	return true;
 }
 
@@ -412,6 +601,26 @@ MM_SegregatedGC::reportSweepEnd(MM_EnvironmentBase *env)
 		J9HOOK_MM_PRIVATE_SWEEP_END);
 }
 
+/**
+ * Record how the small regions left unswept by the previous pause were reclaimed, before this pause
+ * queues the regions it leaves unswept.
+ */
+void
+MM_SegregatedGC::reportConcurrentSweepStats(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	MM_RegionPoolSegregated *regionPool = memoryPool->getRegionPool();
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+
+	sweepStats->concurrentSweepOnDemandRegions = regionPool->getOnDemandSweptRegionCount();
+	sweepStats->concurrentSweepBackgroundRegions = regionPool->getBackgroundSweptRegionCount();
+	sweepStats->concurrentSweepUnsweptRegions = regionPool->getCurrentTotalCountOfSweepRegions();
+
+	Trc_MM_SegregatedGC_concurrentSweepStats(env->getLanguageVMThread(),
+		sweepStats->concurrentSweepOnDemandRegions,
+		sweepStats->concurrentSweepBackgroundRegions,
+		sweepStats->concurrentSweepUnsweptRegions);
+}
+
 void
 MM_SegregatedGC::reportGCStart(MM_EnvironmentBase *env)
 {
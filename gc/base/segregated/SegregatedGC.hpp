@@ -49,6 +49,20 @@ protected:
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 private:
+	/**
+	 * Requests made to the background sweep helpers (segregatedConcurrentSweep).
+	 */
+	typedef enum {
+		SWEEP_HELPER_WAIT = 0, /**< nothing to sweep, wait to be resumed at the end of the next pause */
+		SWEEP_HELPER_SWEEP, /**< sweep the small regions left unswept by the last pause */
+		SWEEP_HELPER_SHUTDOWN /**< terminate */
+	} SweepHelperRequest;
+
+	omrthread_monitor_t _sweepHelpersMonitor; /**< protects the request and counts below, and is waited on by idle helpers */
+	SweepHelperRequest _sweepHelpersRequest;
+	bool _sweepHelpersInitialized; /**< true once the first pause has created the background sweep helpers */
+	uintptr_t _sweepHelpersStarted; /**< number of background sweep helper threads created */
+	uintptr_t _sweepHelpersShutdownCount; /**< number of background sweep helpers that have terminated */
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
 	uintptr_t _scanBytes;
@@ -72,6 +86,14 @@ protected:
 	void reportMarkEnd(MM_EnvironmentBase *env);
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
+	void reportConcurrentSweepStats(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
+
+private:
+	void initializeSweepHelpers(MM_GCExtensionsBase *extensions);
+	void shutdownSweepHelpers(MM_GCExtensionsBase *extensions);
+	void resumeSweepHelpers(MM_EnvironmentBase *env);
+	SweepHelperRequest getSweepHelperRequest(MM_EnvironmentBase *env);
+	void switchSweepHelperRequest(SweepHelperRequest from, SweepHelperRequest to);
 
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
@@ -79,6 +101,13 @@ public:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
 
+	/**
+	 * Main loop of a background sweep helper thread, which attaches itself to the VM.
+	 * Helpers sweep the small regions left unswept by a pause while holding VM access, and give VM access up
+	 * whenever exclusive access is requested, so that they never sweep concurrently with a collection.
+	 */
+	void sweepHelperEntryPoint();
+
 	virtual bool collectorStartup(MM_GCExtensionsBase* extensions);
 	virtual void collectorShutdown(MM_GCExtensionsBase* extensions);
 
@@ -119,6 +148,11 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _sweepHelpersMonitor(NULL)
+		, _sweepHelpersRequest(SWEEP_HELPER_WAIT)
+		, _sweepHelpersInitialized(false)
+		, _sweepHelpersStarted(0)
+		, _sweepHelpersShutdownCount(0)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
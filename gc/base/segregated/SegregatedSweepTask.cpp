@@ -21,6 +21,8 @@
  *******************************************************************************/
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
 #include "SweepSchemeSegregated.hpp"
 
 #include "SegregatedSweepTask.hpp"
@@ -45,5 +47,11 @@ MM_SegregatedSweepTask::cleanup(MM_EnvironmentBase *envBase)
 
 }
 
+uintptr_t
+MM_SegregatedSweepTask::getCompletedWorkVolume(MM_EnvironmentBase *env)
+{
+	return env->getExtensions()->heap->getActiveMemorySize();
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
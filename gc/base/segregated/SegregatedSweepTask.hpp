@@ -42,6 +42,7 @@ private:
 public:
 	/* OMRTODO come up with a better number here.. */
 	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_SWEEP; };
+	virtual uintptr_t getCompletedWorkVolume(MM_EnvironmentBase *env);
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
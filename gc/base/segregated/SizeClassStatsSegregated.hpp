@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SIZECLASSSTATSSEGREGATED_HPP_)
+#define SIZECLASSSTATSSEGREGATED_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "sizeclasses.h"
+
+#include "AtomicOperations.hpp"
+#include "Base.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * Per size class allocation and fragmentation counters of the segregated heap.
+ *
+ * Allocating threads and sweeping GC threads count into a private instance and merge it into the
+ * region pool once per cache flush or sweep batch; the region pool publishes a snapshot at the end
+ * of every sweep. Only the small size classes are populated.
+ * @ingroup GC_Base
+ */
+class MM_SizeClassStatsSegregated : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+public:
+	uintptr_t allocatedCells[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< cells handed out by allocation caches since the previous sweep */
+	uintptr_t liveCells[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< cells marked in the swept regions */
+	uintptr_t fullRegions[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< swept regions with no free cell */
+	uintptr_t partiallyFreeRegions[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< swept regions with both live and free cells */
+	uintptr_t freedRegions[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< swept regions with no live cell, returned to the free lists */
+	uintptr_t regionFlipsIn[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< free regions taken for this size class that last served another one */
+	uintptr_t regionFlipsOut[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< free regions that last served this size class and were taken for another one */
+
+	/*
+	 * Function members
+	 */
+public:
+	void
+	clear()
+	{
+		for (uintptr_t sizeClass = 0; sizeClass <= OMR_SIZECLASSES_NUM_SMALL; sizeClass++) {
+			allocatedCells[sizeClass] = 0;
+			liveCells[sizeClass] = 0;
+			fullRegions[sizeClass] = 0;
+			partiallyFreeRegions[sizeClass] = 0;
+			freedRegions[sizeClass] = 0;
+			regionFlipsIn[sizeClass] = 0;
+			regionFlipsOut[sizeClass] = 0;
+		}
+	}
+
+	/**
+	 * Add the counters of a private instance into the receiver, which may be updated concurrently.
+	 * @param stats[in] the counters to add
+	 */
+	void
+	mergeAtomic(MM_SizeClassStatsSegregated *stats)
+	{
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			addAtomic(&allocatedCells[sizeClass], stats->allocatedCells[sizeClass]);
+			addAtomic(&liveCells[sizeClass], stats->liveCells[sizeClass]);
+			addAtomic(&fullRegions[sizeClass], stats->fullRegions[sizeClass]);
+			addAtomic(&partiallyFreeRegions[sizeClass], stats->partiallyFreeRegions[sizeClass]);
+			addAtomic(&freedRegions[sizeClass], stats->freedRegions[sizeClass]);
+			addAtomic(&regionFlipsIn[sizeClass], stats->regionFlipsIn[sizeClass]);
+			addAtomic(&regionFlipsOut[sizeClass], stats->regionFlipsOut[sizeClass]);
+		}
+	}
+
+	MM_SizeClassStatsSegregated()
+		: MM_Base()
+	{
+		clear();
+	}
+
+private:
+	/* most counters of a private instance are zero, so skip their atomic updates */
+	MMINLINE static void
+	addAtomic(uintptr_t *counter, uintptr_t value)
+	{
+		if (0 != value) {
+			MM_AtomicOperations::add((volatile uintptr_t *)counter, value);
+		}
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SIZECLASSSTATSSEGREGATED_HPP_ */
@@ -34,6 +34,7 @@
 #include "MemoryPoolAggregatedCellList.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "RegionPoolSegregated.hpp"
+#include "SizeClassStatsSegregated.hpp"
 #include "Task.hpp"
 
 #include "SweepSchemeSegregated.hpp"
@@ -112,6 +113,21 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 	incrementalSweepLarge(env);
 	
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	if (_extensions->segregatedConcurrentSweep && !isFixHeapForWalk) {
+		/* Small regions stay on the sweep lists. They are swept after the pause by allocating threads
+		 * (see MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass()) and by the background
+		 * helpers (see concurrentSweepSmall()). Leave the region pool in the sweeping state so that
+		 * allocation keeps searching all the defragment buckets, as regions are made available out of order.
+		 */
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			regionPool->setSweepSmallPages(true);
+			regionPool->resetSkipAvailableRegionForAllocation();
+			postSweep(env);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+		return;
+	}
+
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		regionPool->setSweepSmallPages(true);
 		regionPool->resetSkipAvailableRegionForAllocation();
@@ -483,6 +499,99 @@ MM_SweepSchemeSegregated::incrementalSweepArraylet(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_SweepSchemeSegregated::sweepSmallRegionWorkList(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t splitIndex, uintptr_t yieldSlackTime)
+{
+	bool shouldUpdateOccupancy = _extensions->nonDeterministicSweep;
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	uintptr_t numCells = _extensions->defaultSizeClasses->getNumCells(sizeClass);
+	MM_HeapRegionQueue *fullList = env->getRegionLocalFull();
+	MM_HeapRegionDescriptorSegregated *currentRegion;
+	/* counted privately and merged once per batch */
+	uintptr_t liveCells = 0;
+	uintptr_t fullRegions = 0;
+	uintptr_t partiallyFreeRegions = 0;
+	uintptr_t freedRegions = 0;
+
+	while ((currentRegion = env->getRegionWorkList()->dequeue()) != NULL) {
+		sweepRegion(env, currentRegion);
+		if (currentRegion->getMemoryPoolACL()->getFreeCount() < numCells) {
+			uintptr_t markCount = currentRegion->getMemoryPoolACL()->getMarkCount();
+			uintptr_t occupancy = (markCount * 100) / numCells;
+			/* Maintain average occupancy needed for nondeterministic sweep heuristic */
+			if (shouldUpdateOccupancy) {
+				regionPool->updateOccupancy(sizeClass, occupancy);
+			}
+			liveCells += markCount;
+			if (markCount == numCells) {
+				/* Return full regions to full list */
+				fullList->enqueue(currentRegion);
+				fullRegions += 1;
+			} else {
+				regionPool->enqueueAvailable(currentRegion, sizeClass, occupancy, splitIndex);
+				partiallyFreeRegions += 1;
+			}
+		} else {
+			currentRegion->emptyRegionReturned(env);
+			currentRegion->setFree(1);
+			env->getRegionLocalFree()->enqueue(currentRegion);
+			freedRegions += 1;
+		}
+
+		if (updateSweepSmallRegionCount()) {
+			yieldFromSweep(env, yieldSlackTime);
+		}
+	}
+	regionPool->addSingleFree(env, env->getRegionLocalFree());
+	regionPool->getSmallFullRegions(sizeClass)->enqueue(fullList);
+
+	if (_extensions->segregatedSizeClassStats) {
+		MM_SizeClassStatsSegregated stats;
+		stats.liveCells[sizeClass] = liveCells;
+		stats.fullRegions[sizeClass] = fullRegions;
+		stats.partiallyFreeRegions[sizeClass] = partiallyFreeRegions;
+		stats.freedRegions[sizeClass] = freedRegions;
+		regionPool->mergeSizeClassStats(&stats);
+	}
+}
+
+uintptr_t
+MM_SweepSchemeSegregated::concurrentSweepSmall(MM_EnvironmentBase *env)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	uintptr_t splitIndex = env->getEnvironmentId() % regionPool->getSplitAvailableListSplitCount();
+	uintptr_t sweptRegions = 0;
+
+	/* Pick the size class with the largest fraction of its regions left to sweep, as the interleaved
+	 * sweep in the pause does, so that no size class is left entirely to the allocating threads.
+	 */
+	uintptr_t selectedSizeClass = 0;
+	float selectedYetToComplete = 0.0f;
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		uintptr_t currentCount = regionPool->getCurrentCountOfSweepRegions(sizeClass);
+		if (0 != currentCount) {
+			float yetToComplete = (float)currentCount / OMR_MAX(regionPool->getInitialCountOfSweepRegions(sizeClass), currentCount);
+			if (yetToComplete > selectedYetToComplete) {
+				selectedSizeClass = sizeClass;
+				selectedYetToComplete = yetToComplete;
+			}
+		}
+	}
+
+	if (0 != selectedSizeClass) {
+		uintptr_t numCells = _extensions->defaultSizeClasses->getNumCells(selectedSizeClass);
+		sweptRegions = regionPool->getSmallSweepRegions(selectedSizeClass)->dequeue(env->getRegionWorkList(), calcSweepSmallRegionsPerIteration(numCells));
+		if (0 < sweptRegions) {
+			regionPool->decrementCurrentCountOfSweepRegions(selectedSizeClass, sweptRegions);
+			regionPool->decrementCurrentTotalCountOfSweepRegions(sweptRegions);
+			sweepSmallRegionWorkList(env, selectedSizeClass, splitIndex, 0);
+			regionPool->addBackgroundSweptRegions(sweptRegions);
+		}
+	}
+
+	return sweptRegions;
+}
+
 uintptr_t
 MM_SweepSchemeSegregated::resetSweepSmallRegionCount(MM_EnvironmentBase *env, uintptr_t yieldSmallRegionCount)
 {
@@ -499,7 +608,6 @@ void
 MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 {
 	MM_GCExtensionsBase *ext = env->getExtensions();
-	bool shouldUpdateOccupancy = ext->nonDeterministicSweep;
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
 	uintptr_t splitIndex = env->getWorkerID() % (regionPool->getSplitAvailableListSplitCount());
 
@@ -524,7 +632,6 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 				}
 				
 				MM_HeapRegionQueue *sweepList = regionPool->getSmallSweepRegions(sizeClass);
-				MM_HeapRegionDescriptorSegregated *currentRegion;
 				uintptr_t numCells = sizeClasses->getNumCells(sizeClass);
 				uintptr_t sweepSmallRegionsPerIteration = calcSweepSmallRegionsPerIteration(numCells);
 				uintptr_t yieldSlackTime = resetSweepSmallRegionCount(env, sweepSmallRegionsPerIteration);
@@ -532,36 +639,7 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 				if ((actualSweepRegions = sweepList->dequeue(env->getRegionWorkList(), sweepSmallRegionsPerIteration)) > 0) {
 					regionPool->decrementCurrentCountOfSweepRegions(sizeClass, actualSweepRegions);
 					regionPool->decrementCurrentTotalCountOfSweepRegions(actualSweepRegions);
-					uintptr_t freedRegions = 0, processedRegions = 0;
-					MM_HeapRegionQueue *fullList = env->getRegionLocalFull();
-					while ((currentRegion = env->getRegionWorkList()->dequeue()) != NULL) {
-						sweepRegion(env, currentRegion);
-						if (currentRegion->getMemoryPoolACL()->getFreeCount() < numCells) {
-							uintptr_t occupancy = (currentRegion->getMemoryPoolACL()->getMarkCount() * 100) / numCells;
-							/* Maintain average occupancy needed for nondeterministic sweep heuristic */
-							if (shouldUpdateOccupancy) {
-								regionPool->updateOccupancy(sizeClass, occupancy);
-							}
-							if (currentRegion->getMemoryPoolACL()->getMarkCount() == numCells) {
-								/* Return full regions to full list */
-								fullList->enqueue(currentRegion);
-							} else {
-								regionPool->enqueueAvailable(currentRegion, sizeClass, occupancy, splitIndex);
-							}
-						} else {
-							currentRegion->emptyRegionReturned(env);
-							currentRegion->setFree(1);
-							env->getRegionLocalFree()->enqueue(currentRegion);
-							freedRegions++;
-						}
-						processedRegions++;
-						
-						if (updateSweepSmallRegionCount()) {
-							yieldFromSweep(env, yieldSlackTime);
-						}
-					}
-					regionPool->addSingleFree(env, env->getRegionLocalFree());				
-					regionPool->getSmallFullRegions(sizeClass)->enqueue(fullList);
+					sweepSmallRegionWorkList(env, sizeClass, splitIndex, yieldSlackTime);
 					yieldFromSweep(env, yieldSlackTime);
 				}
 			} /* end of while(currentTotalCountOfSweepRegions); */
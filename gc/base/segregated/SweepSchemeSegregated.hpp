@@ -67,6 +67,13 @@ public:
 	void sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool, bool isFixHeapForWalk);
 	virtual void sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 
+	/**
+	 * Sweep one batch of the small regions left unswept by a pause (segregatedConcurrentSweep), outside of the pause.
+	 * The caller must hold VM access so that the sweep can not overlap the marking of the next cycle.
+	 * @return the number of regions swept, 0 once no small region is left to sweep
+	 */
+	uintptr_t concurrentSweepSmall(MM_EnvironmentBase *env);
+
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
 	void setClearMarkMapAfterSweep(bool clearMarkMapAfterSweep) { _clearMarkMapAfterSweep = clearMarkMapAfterSweep; }
 protected:
@@ -99,6 +106,11 @@ private:
 	void sweepLargeRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void addBytesFreedAfterSweep(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void incrementalSweepSmall(MM_EnvironmentBase *env);
+	/**
+	 * Sweep the regions of a size class queued on the thread's region work list, and return each of them to the
+	 * full list, an available list or the free list.
+	 */
+	void sweepSmallRegionWorkList(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t splitIndex, uintptr_t yieldSlackTime);
 	void incrementalSweepLarge(MM_EnvironmentBase *env);
 	void incrementalCoalesceFreeRegions(MM_EnvironmentBase *env);
 
@@ -54,6 +54,7 @@
 #include "ParallelDispatcher.hpp"
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
+#include "SlidingCompaction.hpp"
 #include "SlotObject.hpp"
 #include "SublistPool.hpp"
 #include "SublistPuddle.hpp"
@@ -109,6 +110,71 @@ countBits(uintptr_t x)
     return count;
 }
 
+/* Upper bound of the compactPrefetchDistance option, the size of the lookahead ring below */
+#define COMPACT_MAX_PREFETCH_DISTANCE 32
+
+MMINLINE void
+prefetchObject(omrobjectptr_t objectPtr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch((void *)objectPtr, 0 /* read */, 3 /* keep in all cache levels */);
+#endif /* defined(__GNUC__) || defined(__clang__) */
+}
+
+/**
+ * Iterate the marked objects of a range, issuing prefetches for the objects a fixed number of
+ * objects ahead of the one returned. Moving an object touches its header and body for the first
+ * time in the compaction, so on large heaps the move loop otherwise stalls on every object.
+ */
+class MM_CompactPrefetchingObjectIterator
+{
+private:
+	MM_HeapMapIterator _markedObjectIterator;
+	omrobjectptr_t _lookahead[COMPACT_MAX_PREFETCH_DISTANCE];
+	uintptr_t _distance;
+	uintptr_t _next;
+	bool _exhausted;
+
+	MMINLINE omrobjectptr_t
+	fetchObject()
+	{
+		omrobjectptr_t objectPtr = NULL;
+		if (!_exhausted) {
+			objectPtr = _markedObjectIterator.nextObject();
+			if (NULL == objectPtr) {
+				_exhausted = true;
+			} else {
+				prefetchObject(objectPtr);
+			}
+		}
+		return objectPtr;
+	}
+
+public:
+	MMINLINE omrobjectptr_t
+	nextObject()
+	{
+		if (0 == _distance) {
+			return _markedObjectIterator.nextObject();
+		}
+		omrobjectptr_t objectPtr = _lookahead[_next];
+		_lookahead[_next] = fetchObject();
+		_next = (_next + 1) % _distance;
+		return objectPtr;
+	}
+
+	MM_CompactPrefetchingObjectIterator(MM_GCExtensionsBase *extensions, MM_MarkMap *markMap, omrobjectptr_t start, omrobjectptr_t finish, uintptr_t distance)
+		: _markedObjectIterator(extensions, markMap, (uintptr_t *)start, (uintptr_t *)finish)
+		, _distance(OMR_MIN(distance, COMPACT_MAX_PREFETCH_DISTANCE))
+		, _next(0)
+		, _exhausted(false)
+	{
+		for (uintptr_t i = 0; i < _distance; i++) {
+			_lookahead[i] = fetchObject();
+		}
+	}
+};
+
 /************************************************************
  *
  * 32-bit layout
@@ -536,6 +602,7 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	uintptr_t byteCount = 0;
 	uintptr_t skippedObjectCount = 0;
 	uintptr_t fixupObjectsCount = 0;
+	uintptr_t liveBytes = 0;
 	bool singleThreaded = false;
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
@@ -544,6 +611,13 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		 * done at a synchronize point?
 		 */
 		mainSetupForGC(env);
+#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+		/* objects may grow when they move, which destinations computed before the move cannot account for */
+		_slidingCompaction = false;
+#else /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+		_slidingCompaction = _extensions->parallelSlidingCompaction;
+#endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+		env->_compactStats._sliding = _slidingCompaction;
 #if defined(DEBUG)
 		_delegate.verifyHeap(env, _markMap);
 #endif /* DEBUG */
@@ -564,6 +638,13 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		singleThreaded = true;
 	}
 
+	/* A sliding compaction leaves no hole between sub areas, so it never needs a single sub area per
+	 * segment, and a lone thread simply moves every sub area itself.
+	 */
+	if (_slidingCompaction) {
+		singleThreaded = false;
+	}
+
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
 	workerSetupForGC(env, singleThreaded);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
@@ -573,7 +654,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	 */
 	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
-		moveObjects(env, objectCount, byteCount, skippedObjectCount);
+		if (_slidingCompaction) {
+			slideObjects(env, objectCount, byteCount);
+		} else {
+			moveObjects(env, objectCount, byteCount, skippedObjectCount);
+		}
 		env->_compactStats._moveEndTime = omrtime_hires_clock();
 
 		if (!singleThreaded) {
@@ -583,7 +668,7 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 
 		env->_compactStats._fixupStartTime = omrtime_hires_clock();
 
-		fixupObjects(env, fixupObjectsCount);
+		fixupObjects(env, fixupObjectsCount, liveBytes);
 
 
 		env->_compactStats._fixupEndTime = omrtime_hires_clock();
@@ -615,7 +700,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	if (rebuildMarkBits) {
-		rebuildMarkbits(env);
+		if (_slidingCompaction) {
+			rebuildMarkbitsSliding(env);
+		} else {
+			rebuildMarkbits(env);
+		}
 		MM_AtomicOperations::sync();
 	}
 
@@ -624,6 +713,7 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	env->_compactStats._movedObjects = objectCount;
 	env->_compactStats._movedBytes = byteCount;
 	env->_compactStats._fixupObjects = fixupObjectsCount;
+	env->_compactStats._liveBytes = liveBytes;
 }
 
 void
@@ -1338,7 +1428,197 @@ MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 }
 
 void
-MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount)
+MM_CompactScheme::slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	MM_HeapRegionDescriptorStandard *region = NULL;
+
+	/* Measure the live bytes of every sub area */
+	GC_HeapRegionIteratorStandard measureIterator(regionManager);
+	SubAreaEntry *subAreaTable = _subAreaTable;
+	while (NULL != (region = measureIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::measuring)) {
+				measureSubArea(env, subAreaTable, i);
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		computeSlidingDestinations(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* Move the sub areas. They are claimed in ascending order, and a sub area only waits for sub areas
+	 * below it in the same region, so every wait is for a sub area already claimed by a running thread.
+	 */
+	GC_HeapRegionIteratorStandard slideIterator(regionManager);
+	subAreaTable = _subAreaTable;
+	while (NULL != (region = slideIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::sliding)) {
+				slideSubArea(env, subAreaTable, i, objectCount, byteCount);
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		completeSlidingSubAreaTable(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_CompactScheme::measureSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i)
+{
+	omrobjectptr_t finish = pageStart(pageIndex(subAreaTable[i + 1].firstObject));
+	MM_CompactPrefetchingObjectIterator markedObjectIterator(_extensions, _markMap, subAreaTable[i].firstObject, finish, _extensions->compactPrefetchDistance);
+	uintptr_t liveBytes = 0;
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+	subAreaTable[i].liveBytes = liveBytes;
+}
+
+void
+MM_CompactScheme::computeSlidingDestinations(MM_EnvironmentStandard *env)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		Assert_MM_true(region->getLowAddress() == subAreaTable[0].firstObject);
+		intptr_t i = MM_SlidingCompaction::computeDestinations(subAreaTable, (uintptr_t)region->getLowAddress());
+		/* the end_segment entry holds the end of the live data of the region */
+		Assert_MM_true(subAreaTable[i].destination <= region->getHighAddress());
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::slideSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	omrobjectptr_t destination = subAreaTable[i].destination;
+
+	MM_SlidingCompaction::waitForOverlappedSubAreas(subAreaTable, i);
+
+	omrobjectptr_t finish = pageStart(pageIndex(subAreaTable[i + 1].firstObject));
+	MM_CompactPrefetchingObjectIterator markedObjectIterator(_extensions, _markMap, subAreaTable[i].firstObject, finish, _extensions->compactPrefetchDistance);
+	intptr_t page = -1; /* invalid value */
+	intptr_t counter = 0; /* obj on page, first is zero */
+	CompactTableEntry entry;
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		saveForwardingPtr(entry, objectPtr, destination, page, counter);
+		if (destination != objectPtr) {
+			objectCount += 1;
+			byteCount += objectSize;
+			memmove(destination, objectPtr, objectSize);
+		}
+		destination = (omrobjectptr_t)((uintptr_t)destination + objectSize);
+	}
+
+	if (page != -1) {
+		_compactTable[page] = entry;
+	}
+	Assert_MM_true(destination == subAreaTable[i + 1].destination);
+
+	/* the moved objects and forwarding entries must be visible before waiting sub areas proceed */
+	MM_AtomicOperations::storeSync();
+	subAreaTable[i].state = SubAreaEntry::full;
+}
+
+void
+MM_CompactScheme::completeSlidingSubAreaTable(MM_EnvironmentStandard *env)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			subAreaTable[i].firstObject = subAreaTable[i].destination;
+			subAreaTable[i].freeChunk = NULL;
+		}
+		/* Everything above the live data of the region is free, and belongs to the last sub area */
+		omrobjectptr_t liveEnd = subAreaTable[i].destination;
+		if (liveEnd < subAreaTable[i].firstObject) {
+			setFreeChunkSize(liveEnd, (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)liveEnd);
+			subAreaTable[i - 1].freeChunk = liveEnd;
+		}
+		subAreaTable += (i+1);
+	}
+	MM_AtomicOperations::sync();
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsSliding(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	MM_HeapRegionDescriptorStandard *region = NULL;
+
+	/* Sliding sub areas do not start on page boundaries, so all of them are cleared before any bit is
+	 * set, and bits are set atomically as neighbouring sub areas share heap map slots.
+	 */
+	GC_HeapRegionIteratorStandard clearIterator(regionManager);
+	SubAreaEntry *subAreaTable = _subAreaTable;
+	while (NULL != (region = clearIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
+				_markMap->setBitsInRange(env, pageStart(pageIndex(subAreaTable[i].firstObject)), pageStart(pageIndex(subAreaTable[i + 1].firstObject)), true);
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	GC_HeapRegionIteratorStandard setIterator(regionManager);
+	subAreaTable = _subAreaTable;
+	while (NULL != (region = setIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::setting_mark_bits)) {
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					_markMap->atomicSetBit(objectPtr);
+				}
+			}
+		}
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount, uintptr_t& liveBytes)
 {
 	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
 	GC_HeapRegionIteratorStandard regionIterator(regionManager);
@@ -1352,7 +1632,7 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
-        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount, liveBytes);
 			}
         }
         /* Number of regions in regionTable, including
@@ -1369,7 +1649,7 @@ MM_CompactScheme::fixupObjectSlot(GC_SlotObject* slotObject)
 }
 
 void
-MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount)
+MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount, uintptr_t& liveBytes)
 {
 	/* if start address is NULL, means we don't need to fix this subarea */
 	if (NULL == firstObject) {
@@ -1384,6 +1664,7 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 		omrobjectptr_t objectPtr = NULL;
 		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
 			objectCount++;
+			liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
 			fixupObject.fixupObject(env, objectPtr);
 		}
 	} else {
@@ -1392,6 +1673,7 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 		omrobjectptr_t objectPtr;
 		while (NULL != (objectPtr = objectIterator.nextObject())) {
 			objectCount++;
+			liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
 			fixupObject.fixupObject(env, objectPtr);
 		}
 	}
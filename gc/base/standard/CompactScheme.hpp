@@ -93,6 +93,8 @@ private:
 		omrobjectptr_t freeChunk;
         volatile uintptr_t state;
         volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+        uintptr_t liveBytes; /**< sliding compaction: bytes of marked objects in the subarea */
+        omrobjectptr_t destination; /**< sliding compaction: where the first marked object of the subarea slides to */
         
     	/* legal values for currentAction */
     	enum {
@@ -101,7 +103,10 @@ private:
     		evacuating,
     		fixing_up,
     		rebuilding_mark_bits,
-    		fixing_heap_for_walk
+    		fixing_heap_for_walk,
+    		measuring,
+    		sliding,
+    		setting_mark_bits
     	};
     	
     	/* legal values for state
@@ -138,6 +143,7 @@ protected:
     SubAreaEntry *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
     omrobjectptr_t _compactFrom;
     omrobjectptr_t _compactTo;
+    bool _slidingCompaction; /**< true if the current compaction slides every region towards its base rather than evacuating subareas */
     MM_CompactDelegate _delegate;
 
 public:
@@ -205,6 +211,34 @@ protected:
 
     void moveObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &skippedObjectCount);
 
+    /**
+     * Slide the marked objects of every region towards the base of the region, preserving their order.
+     *
+     * The live bytes of each subarea are measured in parallel, a prefix sum over them gives each subarea
+     * its destination, and subareas are then moved in parallel as soon as no unmoved object remains
+     * where they slide to. On return the subarea table describes the compacted heap.
+     *
+     * @param env[in] the current thread
+     * @param[in/out] objectCount the number of objects moved (accumulated)
+     * @param[in/out] byteCount the number of bytes moved (accumulated)
+     */
+    void slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount);
+    void measureSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i);
+    void computeSlidingDestinations(MM_EnvironmentStandard *env);
+
+    /**
+     * Move the objects of the specified subArea to its destination and record their forwarding addresses.
+     * Waits until the subareas whose objects lie in the destination range have been moved.
+     */
+    void slideSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount);
+
+    /**
+     * Rewrite the subarea table so that each subarea describes where its objects were moved to, and
+     * format the space left at the top of each region as free.
+     */
+    void completeSlidingSubAreaTable(MM_EnvironmentStandard *env);
+    void rebuildMarkbitsSliding(MM_EnvironmentStandard *env);
+
     /**
      * Fix up all references to moved objects in the specified subArea
      *
@@ -213,9 +247,10 @@ protected:
      * @param[in] finish The last object in the subArea
      * @param markedOnly[in] Should only marked objects be walked
      * @param[in/out] objectCount the number of objects fixed up (accumulated)
+     * @param[in/out] liveBytes the size of the objects fixed up (accumulated)
      */
-    void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount);
-	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
+    void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount, uintptr_t& liveBytes);
+	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount, uintptr_t& liveBytes);
 
     void rebuildFreelist(MM_EnvironmentStandard *env);
 
@@ -334,6 +369,7 @@ public:
         , _markMap(markingScheme->getMarkMap())
         , _subAreaTableSize(0)
     	, _subAreaTable(NULL)
+    	, _slidingCompaction(false)
     	, _delegate()
     {
     	_typeId = __FUNCTION__;
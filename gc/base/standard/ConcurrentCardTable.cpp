@@ -482,6 +482,19 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 			(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_CACHE_REFRESHED, tlhRefreshed, OMR_GET_CALLSITE(), (void *)this);
 		}
 	
+		/* Summarize dirty cards so card cleaning can skip the clean parts of the card table */
+		if (_extensions->concurrentCardCleaningSummary) {
+			uintptr_t cardsPerSlot = CARD_SUMMARY_CARDS_PER_BIT * J9BITS_BITS_IN_SLOT;
+			uintptr_t maximumCards = calculateCardTableSize(env, heap->getMaximumPhysicalRange()) / sizeof(Card);
+			uintptr_t summarySize = (MM_Math::roundToCeiling(cardsPerSlot, maximumCards) / cardsPerSlot) * sizeof(uintptr_t);
+			_dirtyCardSummary = (uintptr_t *)env->getForge()->allocate(summarySize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _dirtyCardSummary) {
+				return false;
+			}
+			memset(_dirtyCardSummary, 0, summarySize);
+			_summaryScanKernels = MM_HeapMapScanKernels::selectKernels(env);
+		}
+
 		/* Set default card cleaning masks used by getNextDirtycard */
 		_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK;
 		_finalCardCleanMask = FINAL_CARD_CLEAN_MASK;
@@ -525,6 +538,10 @@ MM_ConcurrentCardTable::tearDown(MM_EnvironmentBase *env)
 		env->getForge()->free(_cleaningRanges);
 		_cleaningRanges = NULL;
 	}
+	if (NULL != _dirtyCardSummary) {
+		env->getForge()->free(_dirtyCardSummary);
+		_dirtyCardSummary = NULL;
+	}
 	MM_CardTable::tearDown(env);
 }
 
@@ -597,6 +614,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 		/* If card not already dirty then dirty it */
 		if (*baseCard != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
+			summarizeDirtyCard(baseCard);
 		}
 		baseCard += 1;
 	}
@@ -784,6 +802,7 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 	uintptr_t cardsCleaned = 0;
 	uintptr_t maxPushes;
 	uintptr_t gcCount = _extensions->globalGCStats.gcCount;
+	uintptr_t cardsScannedAtStart = env->_cardCleaningStats._cardsScanned;
 
 	/* Remember which phase of card cleaning active when we start */
 	CardCleanPhase currentCleaningPhase = _cardCleanPhase;
@@ -900,6 +919,11 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 	 * counts will be accurate enough for use currently made of them.
 	 */
  	incConcurrentCleanedCards(cardsCleaned, currentCleaningPhase);
+	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
+	uintptr_t cardsScanned = env->_cardCleaningStats._cardsScanned - cardsScannedAtStart;
+	if (0 != cardsScanned) {
+		_cardTableStats.incConcurrentScannedCards(cardsScanned);
+	}
 
 	/* If we ran out of cards to clean ...*/
 	if (NULL == nextDirtyCard) {
@@ -954,6 +978,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 		if (env->isExclusiveAccessRequestWaiting()) {
 			/* Re-dirty the card as we did not finish cleaning it ... */
 			*card = (Card)CARD_DIRTY;
+			summarizeDirtyCard(card);
 			/* ...and get out now */
 			return false;
 		}
@@ -1000,6 +1025,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	 */
 	if (rememberedObjectsFound && (env->getExtensions()->isRememberedSetInOverflowState())) {
 		*card = (Card)CARD_DIRTY;
+		summarizeDirtyCard(card);
 	}
 
 	return true;
@@ -1048,6 +1074,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	uintptr_t objects;
 	uintptr_t cards = 0;
 	bool phase2 = false;
+	uintptr_t cardsScannedAtStart = env->_cardCleaningStats._cardsScanned;
 
 	/* Set upper limit of refs we push before returning to one packets worth */
 	uintptr_t maxPushes = _markingScheme->getWorkPackets()->getSlotsInPacket();
@@ -1074,6 +1101,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 		/* Clean the card before we trace into it */
 		finalCleanCard(nextDirtyCard);
 		cards += 1;
+		env->_cardCleaningStats._cardsCleaned += 1;
 
 		/* Calculate address of first slot heap for the card to be cleaned... */
 		uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,nextDirtyCard);
@@ -1100,6 +1128,10 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	 * First update number of dirty cards cleaned
 	 */
 	incFinalCleanedCards(cards, phase2);
+	uintptr_t cardsScanned = env->_cardCleaningStats._cardsScanned - cardsScannedAtStart;
+	if (0 != cardsScanned) {
+		_cardTableStats.incFinalScannedCards(cardsScanned);
+	}
 
 	/* ..tell caller how many bytes we traced */
 	*bytesTraced = traceCount;
@@ -1271,6 +1303,46 @@ MM_ConcurrentCardTable::isCardTableEmpty(MM_EnvironmentBase *env)
 	return empty;
 }
 
+/**
+ * Is dirty card summary complete
+ *
+ * Check that the summary bit of every card which is not clean is set. A card
+ * dirtied other than through MM_CardTable would never be cleaned, as card
+ * cleaning skips the groups of cards whose summary bit is clear.
+ * Must only be called while no thread can dirty cards.
+ *
+ * @return TRUE if the card table is not summarized or no dirty card is missing from the summary; FALSE otherwise
+ */
+bool
+MM_ConcurrentCardTable::isDirtyCardSummaryComplete(MM_EnvironmentBase *env)
+{
+	uintptr_t *summary = getDirtyCardSummary();
+	if (NULL == summary) {
+		return true;
+	}
+
+	Card *cardTableStart = getCardTableStart();
+	MM_HeapRegionDescriptor *region = NULL;
+	GC_HeapRegionIterator regionIterator(_extensions->heap->getHeapRegionManager());
+	while(NULL != (region = regionIterator.nextRegion())) {
+		if (region->getSubSpace()->isConcurrentCollectable()) {
+			Card *currentCard = heapAddrToCardAddr(env, region->getLowAddress());
+			Card *endCard = heapAddrToCardAddr(env, region->getHighAddress());
+
+			for (; currentCard < endCard; currentCard++) {
+				if ((Card)CARD_CLEAN != *currentCard) {
+					uintptr_t group = (uintptr_t)(currentCard - cardTableStart) / CARD_SUMMARY_CARDS_PER_BIT;
+					if (0 == (summary[group / J9BITS_BITS_IN_SLOT] & ((uintptr_t)1 << (group % J9BITS_BITS_IN_SLOT)))) {
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
 /**
  * Is TLH mark bits empty?
  * Check that all bits in the TLH mark bits map are OFF. All bits should be OFF
@@ -1561,6 +1633,9 @@ MM_ConcurrentCardTable::determineCleaningRanges(MM_EnvironmentBase *env)
 			/* ... and initialize to byte after last active range */
 			_lastCleaningRange = nextRange;
 
+			/* Retire the chunks claimed from the previous ranges */
+			MM_AtomicOperations::add(&_cleaningRangesEpoch, 1);
+
 			initDone = true;
 
 		}
@@ -1583,16 +1658,85 @@ MM_ConcurrentCardTable::resetCleaningRanges(MM_EnvironmentBase *env)
 		range->nextCard = range->baseCard;
 	}
 
+	/* Retire the chunks claimed from the ranges before they were reset */
+	MM_AtomicOperations::add(&_cleaningRangesEpoch, 1);
+
 	MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_currentCleaningRange,
 															(uintptr_t)_currentCleaningRange,
 															(uintptr_t)_cleaningRanges);
 }
 
+/**
+ * Find the first card of a range which may be dirty.
+ *
+ * With a dirty card summary the clean groups of cards are skipped by scanning the
+ * summary, long runs of clean groups with the heap map scan kernels; without one
+ * the clean cards are skipped a uintptr_t at a time. This is based on the premise
+ * that the card table will be mostly empty.
+ *
+ * @param card - first card of the range
+ * @param topCard - card following the range
+ *
+ * @return the first card of the range which may be dirty, or topCard if all cards of the range are clean
+ */
+Card *
+MM_ConcurrentCardTable::findPossiblyDirtyCard(MM_EnvironmentBase *env, Card *card, Card *topCard)
+{
+	uintptr_t *summary = getDirtyCardSummary();
+	if (NULL != summary) {
+		Card *cardTableStart = getCardTableStart();
+		uintptr_t group = (uintptr_t)(card - cardTableStart) / CARD_SUMMARY_CARDS_PER_BIT;
+		uintptr_t topGroup = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_BIT, (uintptr_t)(topCard - cardTableStart)) / CARD_SUMMARY_CARDS_PER_BIT;
+		uintptr_t *slot = summary + (group / J9BITS_BITS_IN_SLOT);
+		uintptr_t *topSlot = summary + (MM_Math::roundToCeiling(J9BITS_BITS_IN_SLOT, topGroup) / J9BITS_BITS_IN_SLOT);
+		uintptr_t bits = *slot & (ALL_BITS_SET << (group % J9BITS_BITS_IN_SLOT));
+
+		while (0 == bits) {
+			slot = _summaryScanKernels->findNonEmptySlot(slot + 1, topSlot);
+			if (slot >= topSlot) {
+				return topCard;
+			}
+			bits = *slot;
+		}
+
+		group = ((uintptr_t)(slot - summary) * J9BITS_BITS_IN_SLOT) + MM_Bits::leadingZeroes(bits);
+		Card *groupCard = cardTableStart + (group * CARD_SUMMARY_CARDS_PER_BIT);
+		return OMR_MIN(OMR_MAX(groupCard, card), topCard);
+	}
+
+	/* Only scan a uintptr_t at a time up to and including the last complete slot's worth of cards */
+	Card *firstCard = card;
+	uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)topCard);
+	while (card < topCard) {
+		if ((0 == ((uintptr_t)card % sizeof(uintptr_t))) && ((uintptr_t *)card < lastSlot)) {
+			if (SLOT_ALL_CLEAN == *(uintptr_t *)card) {
+				card += sizeof(uintptr_t);
+				continue;
+			}
+		}
+		if ((Card)CARD_CLEAN != *card) {
+			break;
+		}
+		card += 1;
+	}
+	card = OMR_MIN(card, topCard);
+	env->_cardCleaningStats._cardsScanned += (uintptr_t)(card - firstCard);
+
+	return card;
+}
+
 /**
  * Get the next dirty card in card table.
  *
  * Find the next dirty card (as defined by cardmask) in the card table.
  *
+ * Threads cleaning cards in parallel partition the cleaning ranges: a thread claims a chunk
+ * of cards, up to the end of the summary group holding the next possibly dirty card, by
+ * advancing the cursor of the current range, and then hands out the dirty cards of its
+ * chunk without synchronizing with other threads. Chunks left unfinished are resumed on the
+ * thread's next call unless the cleaning ranges have been reset in the meantime; their cards
+ * are still dirty so they are cleaned by final card cleaning in the worst case.
+ *
  * @param cardMask - mask to apply to cards to identify those cards the caller
  * 					 is interested in
  *
@@ -1603,19 +1747,41 @@ MM_ConcurrentCardTable::resetCleaningRanges(MM_EnvironmentBase *env)
 Card*
 MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean)
 {
-	/* Get a local copy of next current range being cleaned */
-	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
+	while (true) {
+		/* Hand out the dirty cards of the chunk this thread claimed, if it belongs to the current cleaning pass */
+		if (env->_cardCleaningChunkEpoch == _cleaningRangesEpoch) {
+			Card *firstCard = env->_cardCleaningChunkNext;
+			Card *chunkTop = env->_cardCleaningChunkTop;
+			Card *card = firstCard;
+			while ((card < chunkTop) && (0 == (*card & cardMask))) {
+				card += 1;
+			}
+			env->_cardCleaningStats._cardsScanned += (uintptr_t)(card - firstCard);
 
-	/* Have we finished already ? */
-	if (currentRange >= _lastCleaningRange ) {
-		/* Yes..we are already done */
-		return NULL;
-	}
+			if (card < chunkTop) {
+				env->_cardCleaningChunkNext = card;
+				if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
+					return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
+				}
+				env->_cardCleaningStats._cardsScanned += 1;
+				env->_cardCleaningChunkNext = card + 1;
+				return card;
+			}
+			env->_cardCleaningChunkNext = chunkTop;
+		}
 
-	/* Get a local copy of next card to check */
-	Card *firstCard = (Card *)currentRange->nextCard;
+		/* Get a local copy of next current range being cleaned */
+		CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
 
-	while (NULL != firstCard) {
+		/* Have we finished already ? */
+		if (currentRange >= _lastCleaningRange) {
+			/* All ranges processed, no more dirty cards */
+			return NULL;
+		}
+
+		/* Read the pass before the cursor; a chunk claimed across a reset is retired rather than kept */
+		uintptr_t epoch = _cleaningRangesEpoch;
+		Card *firstCard = (Card *)currentRange->nextCard;
 
 		/* The last card we will process is either last card in current range or
 		 * the last card to be cleaned in this phase of card cleaning.
@@ -1623,107 +1789,38 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 		/* CMVC 132231 - cache _lastCardInPhase since it's volatile and min reads its arguments twice */
 		Card *lastCardInPhase = _lastCardInPhase;
 		Card *lastCardToClean = OMR_MIN(lastCardInPhase, currentRange->topCard);
-		Card *nextDirtyCard, *currentCard;
-
-		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
-
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
 
-				if (currentCard >= lastCardToClean) {
-					break;
-				}
+		if (firstCard >= lastCardToClean) {
+			if (firstCard < currentRange->topCard) {
+				/* We have reached the last card to be processed in this phase of card cleaning */
+				return NULL;
 			}
+			/* Range complete so switch to next cleaning range. If we fail another thread beat us to it */
+			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_currentCleaningRange, (uintptr_t)currentRange, (uintptr_t)(currentRange + 1));
+			continue;
+		}
 
-			/* Have we found a card of interest yet ? */
-			if (0 == (*currentCard & cardMask)) {
-				/* No..so get next card. */
-				continue;
-			}
-
-			/* Yes..so check to see if another thread got to next dirty card before us ? */
-			if (firstCard != (Card *)currentRange->nextCard) {
-				/* Yes..so re-sync with race winner and start scan again */
-				break;
-			} else {
-				/* No .. so attempt to grab this card*/
-				nextDirtyCard = currentCard;
-				currentCard += 1;
-				if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
-					return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
-				}
-
-				/* Update next card to clean for next caller of getNextDirtyCard. If we fail
-				 * then someone beat us to it so re-sync with race winner and start again
-				 */
-				if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
-											  							  (uintptr_t)firstCard,
-											  							  (uintptr_t)currentCard)) {
-					break;
-				}
-				
-				return nextDirtyCard;
-			}
-		} /* of currentCard < lastCardToClean */
+		if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
+			return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
+		}
 
-		/* We get here if we break out of FOR loop when another thread beat us to next
-		 * dirty card or we reach then end of the card table.
-		 *
-		 * Did we reach end of card table segment ?
-		 */
-		if (currentCard < lastCardToClean) {
-			/* No..so someone must have beat us to next dirty card. In which case we need
-			 * to restart scan. First though make sure no thread is waiting for exclusive access.
-			 */
-			if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
-				return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
-			}
+		/* Skip the cards known to be clean and claim them along with the rest of the group of the next possibly dirty card */
+		Card *chunkBase = findPossiblyDirtyCard(env, firstCard, lastCardToClean);
+		Card *chunkTop = lastCardToClean;
+		if (chunkBase < lastCardToClean) {
+			uintptr_t nextGroup = ((uintptr_t)(chunkBase - getCardTableStart()) / CARD_SUMMARY_CARDS_PER_BIT) + 1;
+			chunkTop = OMR_MIN(getCardTableStart() + (nextGroup * CARD_SUMMARY_CARDS_PER_BIT), lastCardToClean);
+		}
 
-			firstCard = (Card *)currentRange->nextCard;
-		} else if (currentCard >= currentRange->topCard) {
-			assume0(currentCard == currentRange->topCard);
-			/* Range complete so set nextCard of cleaning range to top card to show cleaning range finsished */
-			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard, (uintptr_t)currentRange->nextCard, (uintptr_t)currentRange->topCard);
-			
-			/* Switch to next cleaning range */
-			CleaningRange *nextRange =  currentRange + 1;
-			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_currentCleaningRange, (uintptr_t)currentRange, (uintptr_t)nextRange);
-
-			currentRange = (CleaningRange *)_currentCleaningRange;
-			firstCard = currentRange < _lastCleaningRange ? (Card *)currentRange->nextCard : (Card *)NULL;
-		} else {
-			/* We have reached the last card to be processed in this phase
-			 * of card cleaning. We must update _next card to clean so when we start to clean
-			 * cards in next phase we start at last card in this phase. If we fail then
-			 * another thread beat us to it
-			 */
-			if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
-										  							  (uintptr_t)firstCard,
-										  							  (uintptr_t)currentCard)) {
-			}
-			return NULL;
+		/* If we fail then another thread claimed these cards first so re-sync with the race winner */
+		if (firstCard == (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
+																	  (uintptr_t)firstCard,
+																	  (uintptr_t)chunkTop)) {
+			env->_cardCleaningChunkNext = chunkBase;
+			env->_cardCleaningChunkTop = chunkTop;
+			env->_cardCleaningChunkEpoch = epoch;
 		}
 	}
-
-	/* All ranges processed, no more dirty cards */
-	return NULL;
 }
 
 /**
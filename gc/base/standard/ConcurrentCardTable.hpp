@@ -31,6 +31,7 @@
 #include "Debug.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HeapMapScanKernels.hpp"
 #include "MemoryManager.hpp"
 
 /**
@@ -174,6 +175,9 @@ protected:
 	Card *_firstCardInPhase;
 	Card * volatile _lastCardInPhase;
 	Card *_firstCardInPhase2;
+
+	volatile uintptr_t _cleaningRangesEpoch; /**< incremented whenever the cleaning ranges are reset, to retire the chunks claimed by threads in the previous pass */
+	const MM_HeapMapScanKernels *_summaryScanKernels; /**< kernels used to skip runs of clean groups in the dirty card summary */
 public:
 	
 	/*
@@ -193,6 +197,7 @@ private:
 	
 	void determineCleaningRanges(MM_EnvironmentBase *env);
 	void resetCleaningRanges(MM_EnvironmentBase *env);
+	Card *findPossiblyDirtyCard(MM_EnvironmentBase *env, Card *card, Card *topCard);
 	bool isCardInActiveTLH(MM_EnvironmentBase *env, Card *card);
 	
 	void reportCardCleanPass2Start(MM_EnvironmentBase *env);
@@ -465,6 +470,7 @@ public:
 #if defined(DEBUG)
 	bool isTLHMarkBitsEmpty(MM_EnvironmentBase *env);
 	bool isCardTableEmpty(MM_EnvironmentBase *env);
+	bool isDirtyCardSummaryComplete(MM_EnvironmentBase *env);
 #endif /* DEBUG */
 	
 	/**
@@ -490,7 +496,9 @@ public:
 		_lastCard(NULL),
 		_firstCardInPhase(NULL),
 		_lastCardInPhase(NULL),
-		_firstCardInPhase2(NULL)
+		_firstCardInPhase2(NULL),
+		_cleaningRangesEpoch(1),
+		_summaryScanKernels(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -71,6 +71,9 @@
 #include "MemorySubSpaceSemiSpace.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetCardIterator.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #include "SpinLimiter.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPuddle.hpp"
@@ -272,7 +275,8 @@ MM_ConcurrentGC::reportConcurrentHalted(MM_EnvironmentBase *env)
 		_stats.getConcurrentWorkStackOverflowCount(),
 		(uintptr_t)cardTable->isCardCleaningComplete(),
 		_concurrentDelegate.reportConcurrentScanningMode(env),
-		(uintptr_t)_markingScheme->getWorkPackets()->tracingExhausted()
+		(uintptr_t)_markingScheme->getWorkPackets()->tracingExhausted(),
+		cardTable->getCardTableStats()->getConcurrentScannedCards()
 	);
 }
 
@@ -318,7 +322,9 @@ MM_ConcurrentGC::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase *env, u
 		cardTable->getCardTableStats()->getCardCleaningPhase1Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase2Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase3Kickoff(),
-		_stats.getConcurrentWorkStackOverflowCount()
+		_stats.getConcurrentWorkStackOverflowCount(),
+		cardTable->getCardTableStats()->getFinalScannedCards(),
+		cardTable->getCardTableStats()->getConcurrentScannedCards()
 	);
 }
 
@@ -376,7 +382,10 @@ MM_ConcurrentGC::reportConcurrentCollectionStart(MM_EnvironmentBase *env)
 			_stats.getConcurrentWorkStackOverflowCount(),
 			_stats.getThreadsToScanCount(),
 			_stats.getThreadsScannedCount(),
-			_stats.getCardCleaningReason()
+			_stats.getCardCleaningReason(),
+			_stats.getCardCleanCount(),
+			_stats.getConHelperCardCleanCount(),
+			_stats.getPacingFallbackCount()
 		);
 	}
 }
@@ -1091,6 +1100,15 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 			request = getConHelperRequest(env);
 		}
 
+		/* Mutators rarely run out of tax to pay when the helpers are paced, so start card cleaning early here as they would */
+		if ((CONCURRENT_HELPER_MARK == request)
+				&& isHelperPacingActive()
+				&& (CONCURRENT_TRACE_ONLY == _stats.getExecutionMode())
+				&& _stats.isRootTracingComplete()
+				&& _markingScheme->getWorkPackets()->tracingExhausted()) {
+			kickoffCardCleaning(env, TRACING_COMPLETED);
+		}
+
 		spinLimiter.reset();
 
 		/* clean cards */
@@ -1729,12 +1747,13 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 	/* Calculate how much work we need to get through */
 	traceTarget = _pass2Started ? _traceTargetPass1 + _traceTargetPass2 : _traceTargetPass1;
 
-	/* Provided we are not into buffer zone already and we have not already done more work
-	 * than we predicted calculate required trace rate for this allocate request to keep us on
-	 * track.
-	 */
-	if ((remainingFree > 0) && (workCompleteSoFar < traceTarget)) {
-
+	if (isHelperPacingActive()) {
+		sizeToTrace = calculatePacedTraceSize(env, allocationSize, remainingFree, workCompleteSoFar, traceTarget);
+	} else if ((remainingFree > 0) && (workCompleteSoFar < traceTarget)) {
+		/* Provided we are not into buffer zone already and we have not already done more work
+		 * than we predicted calculate required trace rate for this allocate request to keep us on
+		 * track.
+		 */
 		thisTraceRate = (float)((traceTarget - workCompleteSoFar) / (float)(remainingFree));
 
 		if ( thisTraceRate > _allocToTraceRate) {
@@ -1781,6 +1800,48 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 	return sizeToTrace;
 }
 
+/**
+ * Calculate allocation tax when the concurrent helpers do the concurrent work.
+ * The helpers are expected to complete the trace target by the time the free space available at kickoff
+ * is allocated, so the work due at any point of the cycle is proportional to the free space allocated
+ * since kickoff. Mutators only pay tax when the helpers fall more than a tuning interval of work
+ * behind that schedule, and then only enough to catch up.
+ *
+ * @param allocationSize the size of the allocation
+ * @param remainingFree the "taxable" free space left, less the kickoff threshold buffer
+ * @param workCompleteSoFar the tracing and card cleaning done in the cycle so far
+ * @param traceTarget the tracing and card cleaning expected to be done in the cycle
+ * @return the allocation tax
+ */
+uintptr_t
+MM_ConcurrentGC::calculatePacedTraceSize(MM_EnvironmentBase *env, uintptr_t allocationSize, uintptr_t remainingFree, uintptr_t workCompleteSoFar, uintptr_t traceTarget)
+{
+	uintptr_t sizeToTrace = 0;
+
+	if (0 == remainingFree) {
+		/* We are in the buffer zone, so the helpers have not kept up; trace at the max rate as without pacing */
+		sizeToTrace = (uintptr_t)(allocationSize * getAllocToTraceRateMax());
+		_stats.incPacingFallbackCount();
+	} else {
+		uintptr_t kickoffFree = _stats.getRemainingFree();
+		kickoffFree = (kickoffFree > _kickoffThresholdBuffer) ? kickoffFree - _kickoffThresholdBuffer : 0;
+		if (kickoffFree > remainingFree) {
+			uintptr_t workDue = (uintptr_t)((float)traceTarget * ((float)(kickoffFree - remainingFree) / (float)kickoffFree));
+			uintptr_t workSlack = (uintptr_t)((float)_tuningUpdateInterval * getAllocToTraceRateNormal());
+			if (workDue > (workCompleteSoFar + workSlack)) {
+				sizeToTrace = workDue - (workCompleteSoFar + workSlack);
+				uintptr_t maxSizeToTrace = (uintptr_t)(allocationSize * getAllocToTraceRateMax());
+				if (sizeToTrace > maxSizeToTrace) {
+					sizeToTrace = maxSizeToTrace;
+				}
+				_stats.incPacingFallbackCount();
+			}
+		}
+	}
+
+	return sizeToTrace;
+}
+
 /**
  * Determine if its time to do periodical tuning.
  * Has the free space reduced by the _tuningUpdateInterval from the last time
@@ -2103,7 +2164,10 @@ MM_ConcurrentGC::concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subs
 		case CONCURRENT_TRACE_ONLY:
 		case CONCURRENT_CLEAN_TRACE:
 			sizeToTrace = calculateTraceSize(env, allocDescription);
-			if (sizeToTrace > 0) {
+			/* With helper pacing a mutator with no tax to pay still tunes, starts card cleaning, scans its stack and resumes the helpers,
+			 * but does not start the concurrent scanning
+			 */
+			if ((sizeToTrace > 0) || isHelperPacingActive()) {
 				sizeTraced = doConcurrentTrace(env, allocDescription, sizeToTrace, subspace, threadAtSafePoint);
 			}
 
@@ -2549,9 +2613,10 @@ MM_ConcurrentGC::doConcurrentTrace(MM_EnvironmentBase *env,
 		kickoffCardCleaning(env, CARD_CLEANING_THRESHOLD_REACHED);
 	}
 
+	/* A paced mutator with no tax to pay leaves the concurrent scanning to a mutator that falls back to paying tax */
 	uintptr_t bytesTraced = 0;
 	bool completedConcurrentScanning = false;
-	if (_concurrentDelegate.startConcurrentScanning(env, &bytesTraced, &completedConcurrentScanning)) {
+	if ((0 < sizeToTrace) && _concurrentDelegate.startConcurrentScanning(env, &bytesTraced, &completedConcurrentScanning)) {
 		if (completedConcurrentScanning) {
 			resumeConHelperThreads(env);
 		}
@@ -3035,7 +3100,7 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 			_dispatcher->run(env, &clearNewMarkBitsTask);
 
 			/* If remembered set if not empty then re-scan any objects in the remembered set */
-			if (!(_extensions->rememberedSet.isEmpty())) {
+			if (!(_extensions->rememberedSet.isEmpty()) || (NULL != _extensions->rememberedSetCardTable)) {
 				MM_ConcurrentScanRememberedSetTask scanRememberedSetTask(env, _dispatcher, this, env->_cycleState);
 				_dispatcher->run(env, &scanRememberedSetTask);
 			}
@@ -3051,6 +3116,10 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 
 			bool overflow = false; /* assume the worst case*/
 			uintptr_t overflowCount;
+#if defined(DEBUG)
+			/* card cleaning skips the cards of clear summary bits, so every dirty card must be summarized */
+			Assert_MM_true(((MM_ConcurrentCardTable *)_cardTable)->isDirtyCardSummaryComplete(env));
+#endif
 
 			do {
 				/* remember count when we start */
@@ -3504,6 +3573,52 @@ MM_ConcurrentGC::finalCleanCards(MM_EnvironmentBase *env)
 }
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
+/**
+ * Rescan a remembered object if it has been marked, unless its card is dirty in which case
+ * we leave it for later processing by finalCleanCards()
+ *
+ * @param maxPushes number of pushed references after which the work stack is drained
+ * @param bytesTraced[in/out] incremented by the number of bytes traced
+ * @return true if the object was marked and not in a dirty card
+ */
+MMINLINE bool
+MM_ConcurrentGC::scanRememberedObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t maxPushes, uintptr_t *bytesTraced)
+{
+	if((objectPtr >= _heapBase)
+		&& (objectPtr <  _heapAlloc)
+		&& _markingScheme->isMarkedOutline(objectPtr)
+		&& !_cardTable->isObjectInDirtyCardNoCheck(env,objectPtr)) {
+			if (_extensions->dirtCardDuringRSScan) {
+				_cardTable->dirtyCard(env, objectPtr);
+			} else {
+				/* VMDESIGN 2048 -- due to barrier elision optimizations, the JIT may not have dirtied
+				 * cards for some objects in the remembered set. Therefore we may discover references
+				 * to both nursery and tenure objects while scanning remembered objects.
+				 */
+
+				*bytesTraced += _markingScheme->scanObject(env,objectPtr, SCAN_REASON_REMEMBERED_SET_SCAN);
+
+				/* Have we pushed enough new references? */
+				if(env->_workStack.getPushCount() >= maxPushes) {
+					/* To reduce the chances of mark stack overflow, we do some marking
+					 * of what we have just pushed.
+					 *
+					 * WARNING. If we HALTED concurrent then we will process any remaining
+					 * workpackets at this point. This will make RS processing appear more
+					 * expensive than it really is.
+					 */
+					omrobjectptr_t pushedObjectPtr = NULL;
+					while(NULL != (pushedObjectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
+						*bytesTraced += _markingScheme->scanObject(env, pushedObjectPtr, SCAN_REASON_PACKET);
+					}
+					env->_workStack.clearPushCount();
+				}
+			}
+			return true;
+	}
+	return false;
+}
+
 /**
  * Scan remembered set looking for any MARKED objects which are not in dirty cards.
  * A marked object which is not in a dirty card needs rescanning now for any references
@@ -3525,46 +3640,27 @@ MM_ConcurrentGC::scanRememberedSet(MM_EnvironmentBase *env)
 	env->_workStack.reset(env, _markingScheme->getWorkPackets());
 	env->_workStack.clearPushCount();
 
-	GC_SublistIterator rememberedSetIterator(&_extensions->rememberedSet);
-	while((puddle = rememberedSetIterator.nextList()) != NULL) {
-		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-			GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
-			while((slotPtr = (omrobjectptr_t*)rememberedSetSlotIterator.nextSlot()) != NULL) {
-				objectPtr = *slotPtr;
-				/* For all objects in remembered set that have been marked scan the object
-				 * unless its card is dirty in which case we leave it for later processing
-				 * by finalCleanCards()
-				 */
-				if((objectPtr >= _heapBase)
-					&& (objectPtr <  _heapAlloc)
-					&& _markingScheme->isMarkedOutline(objectPtr)
-					&& !_cardTable->isObjectInDirtyCardNoCheck(env,objectPtr)) {
+	if (NULL != _extensions->rememberedSetCardTable) {
+		for (uintptr_t low = (uintptr_t)_heapBase; low < (uintptr_t)_heapAlloc; low += RSCARDTABLE_WORK_UNIT_SIZE) {
+			if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				MM_RememberedSetCardIterator objectIterator(_extensions->rememberedSetCardTable, (void *)low, (void *)OMR_MIN(low + RSCARDTABLE_WORK_UNIT_SIZE, (uintptr_t)_heapAlloc));
+				while(NULL != (objectPtr = objectIterator.nextObject())) {
+					if (scanRememberedObject(env, objectPtr, maxPushes, &bytesTraced)) {
 						RSObjects += 1;
-						if (_extensions->dirtCardDuringRSScan) {
-							_cardTable->dirtyCard(env, objectPtr);
-						} else {
-							/* VMDESIGN 2048 -- due to barrier elision optimizations, the JIT may not have dirtied
-							 * cards for some objects in the remembered set. Therefore we may discover references
-							 * to both nursery and tenure objects while scanning remembered objects.
-							 */
-
-							bytesTraced += _markingScheme->scanObject(env,objectPtr, SCAN_REASON_REMEMBERED_SET_SCAN);
-
-							/* Have we pushed enough new references? */
-							if(env->_workStack.getPushCount() >= maxPushes) {
-								/* To reduce the chances of mark stack overflow, we do some marking
-								 * of what we have just pushed.
-								 *
-								 * WARNING. If we HALTED concurrent then we will process any remaining
-								 * workpackets at this point. This will make RS processing appear more
-								 * expensive than it really is.
-								 */
-								while(NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
-									bytesTraced += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_PACKET);
-								}
-								env->_workStack.clearPushCount();
-							}
-						}
+					}
+				}
+			}
+		}
+	} else {
+		GC_SublistIterator rememberedSetIterator(&_extensions->rememberedSet);
+		while((puddle = rememberedSetIterator.nextList()) != NULL) {
+			if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+				while((slotPtr = (omrobjectptr_t*)rememberedSetSlotIterator.nextSlot()) != NULL) {
+					/* For all objects in remembered set that have been marked scan the object */
+					if (scanRememberedObject(env, *slotPtr, maxPushes, &bytesTraced)) {
+						RSObjects += 1;
+					}
 				}
 			}
 		}
@@ -378,6 +378,13 @@ protected:
 	void resumeConHelperThreads(MM_EnvironmentBase *env);
 	uintptr_t calculateInitSize(MM_EnvironmentBase *env, uintptr_t allocationSize);
 	uintptr_t calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+	uintptr_t calculatePacedTraceSize(MM_EnvironmentBase *env, uintptr_t allocationSize, uintptr_t remainingFree, uintptr_t workCompleteSoFar, uintptr_t traceTarget);
+
+	/**
+	 * @return true if the concurrent helper threads do the tracing and card cleaning, and mutators only pay tax when they fall behind
+	 */
+	MMINLINE bool isHelperPacingActive() { return _extensions->concurrentHelperPacing && (0 < _conHelpersStarted); }
+
 	void concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,  MM_AllocateDescription *allocDescription);
 	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
 	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
@@ -439,6 +446,7 @@ public:
 	void clearNewMarkBits(MM_EnvironmentBase *env);
 	void completeTracing(MM_EnvironmentBase *env);
 #if defined(OMR_GC_MODRON_SCAVENGER)
+	MMINLINE bool scanRememberedObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t maxPushes, uintptr_t *bytesTraced);
 	void scanRememberedSet(MM_EnvironmentBase *env);
 	void oldToOldReferenceCreated(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(COPYSCANCACHEDEQUE_HPP_)
+#define COPYSCANCACHEDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "ModronAssertions.h"
+
+/* Bytes used to keep the owner-written and thief-written indices (and adjacent deques) on separate cache lines */
+#define COPYSCANCACHEDEQUE_PADDING 128
+
+class MM_CopyScanCacheStandard;
+class MM_EnvironmentBase;
+
+/**
+ * A bounded Chase-Lev work-stealing deque of scan caches, owned by a single GC thread.
+ *
+ * The owning thread pushes and pops at the bottom without any locking; other GC threads
+ * steal from the top with a single compare-and-swap. A push onto a full deque fails and the
+ * caller is expected to fall back to the shared scan list.
+ *
+ * Indices grow monotonically and are reset (via reset()) only when the deque is known to be
+ * empty and no other thread is accessing it, i.e. between scavenges.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CopyScanCacheDeque : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uintptr_t _top; /**< index of the oldest entry, advanced by thieves (and by the owner when taking the last entry) */
+	uint8_t _topPadding[COPYSCANCACHEDEQUE_PADDING]; /**< keep the owner and thieves from false sharing */
+	volatile uintptr_t _bottom; /**< index one past the newest entry, only modified by the owner */
+	MM_CopyScanCacheStandard * volatile *_entries; /**< circular buffer of _capacity entries */
+	uintptr_t _capacity; /**< number of entries in _entries (a power of two) */
+	uintptr_t _stealSeed; /**< state of the owner's victim selection generator */
+	uint8_t _bottomPadding[COPYSCANCACHEDEQUE_PADDING]; /**< keep adjacent deques from false sharing */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity, uintptr_t seed);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Reset the indices of an empty deque so that they never wrap.
+	 * Must only be called while no other thread can access the deque.
+	 */
+	MMINLINE void
+	reset()
+	{
+		Assert_MM_true(isEmpty());
+		_top = 0;
+		_bottom = 0;
+	}
+
+	/**
+	 * Approximate number of entries in the deque. Exact only when called by the owner
+	 * while no thief is active.
+	 */
+	MMINLINE uintptr_t
+	getApproximateEntryCount()
+	{
+		intptr_t size = (intptr_t)(_bottom - _top);
+		return (0 < size) ? (uintptr_t)size : 0;
+	}
+
+	MMINLINE bool
+	isEmpty()
+	{
+		return 0 == getApproximateEntryCount();
+	}
+
+	/**
+	 * Push a cache at the bottom of the deque. Only the owner may call this.
+	 * @param cache[in] the cache to push
+	 * @return true on success, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_CopyScanCacheStandard *cache)
+	{
+		uintptr_t bottom = _bottom;
+		if ((bottom - _top) >= _capacity) {
+			return false;
+		}
+		_entries[bottom & (_capacity - 1)] = cache;
+		/* the entry must be visible before thieves can observe the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed cache. Only the owner may call this.
+	 * @return a cache, or NULL if the deque is empty (or the last entry was stolen)
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	pop()
+	{
+		uintptr_t bottom = _bottom;
+		if (bottom == _top) {
+			return NULL;
+		}
+
+		bottom -= 1;
+		_bottom = bottom;
+		/* publish the reservation before reading top, so a racing thief and the owner agree on the last entry */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+
+		MM_CopyScanCacheStandard *cache = NULL;
+		intptr_t size = (intptr_t)(bottom - top);
+		if (0 < size) {
+			/* more than one entry left, no race possible */
+			cache = _entries[bottom & (_capacity - 1)];
+		} else if (0 == size) {
+			/* last entry: race against thieves for it; either way the deque ends up empty */
+			cache = _entries[bottom & (_capacity - 1)];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				cache = NULL;
+			}
+			_bottom = top + 1;
+		} else {
+			/* a thief took the last entry before the reservation; restore bottom to match top */
+			_bottom = top;
+		}
+		return cache;
+	}
+
+	/**
+	 * Steal the oldest cache. May be called by any thread.
+	 * @return a cache, or NULL if the deque is empty or the steal lost a race
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	steal()
+	{
+		uintptr_t top = _top;
+		/* top must be read before bottom */
+		MM_AtomicOperations::readBarrier();
+		uintptr_t bottom = _bottom;
+
+		MM_CopyScanCacheStandard *cache = NULL;
+		if (0 < (intptr_t)(bottom - top)) {
+			/* pairs with the write barrier in push(): the entry is read only after the bottom that published it */
+			MM_AtomicOperations::readBarrier();
+			cache = _entries[top & (_capacity - 1)];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				cache = NULL;
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * Pick the next steal victim for the owner of this deque.
+	 * @param range[in] number of candidate victims
+	 * @return a pseudo-random index in [0, range)
+	 */
+	MMINLINE uintptr_t
+	nextStealVictim(uintptr_t range)
+	{
+		/* xorshift; only ever touched by the owner */
+		uintptr_t seed = _stealSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		_stealSeed = seed;
+		return seed % range;
+	}
+
+	/**
+	 * Create a CopyScanCacheDeque object.
+	 */
+	MM_CopyScanCacheDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _entries(NULL)
+		, _capacity(0)
+		, _stealSeed(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* COPYSCANCACHEDEQUE_HPP_ */
@@ -44,6 +44,11 @@ MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *ca
 	_sublistCount = extensions->cacheListSplit;
 	Assert_MM_true(0 < _sublistCount);
 
+	if (extensions->numaGCThreadAffinity) {
+		/* give each node its own group of sublists (see MM_Configuration::initializeGCParameters) */
+		_sublistsPerNode = extensions->_numaManager.getSublistsPerNode(_sublistCount);
+	}
+
 	_sublists = (struct CopyScanCacheSublist *)extensions->getForge()->allocate(sizeof(struct CopyScanCacheSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
 		result = false;
@@ -320,11 +325,10 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
-	uintptr_t index = getSublistIndex(env);
 	MM_CopyScanCacheStandard *cache = NULL;
 
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
+		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[getSublistIndex(env, i)];
 
 		if (NULL != list->_cacheHead) {
 			env->_scavengerStats._acquireListLockCount += 1;
@@ -344,8 +348,6 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 				break;
 			}
 		}
-
-		index = (index + 1) % _sublistCount;
 	}
 
 	return cache;
@@ -36,6 +36,7 @@
 #include "EnvironmentStandard.hpp" 
 #include "LightweightNonReentrantLock.hpp"
 #include "ModronAssertions.h"
+#include "NUMAManager.hpp"
 
 class MM_Collector;
 class MM_CopyScanCacheStandard;
@@ -75,6 +76,7 @@ private:
 	
 	struct CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _sublistsPerNode; /**< the number of sublists reserved for each NUMA node, or 0 if the sublists are not grouped by node */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -101,7 +103,22 @@ private:
 	 */
 	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		return getSublistIndex(env, 0);
+	}
+
+	/**
+	 * Determine which sublist the specified environment should visit on the given probe
+	 * (see MM_NUMAManager::getSublistIndex()).
+	 *
+	 * @param env the current environment
+	 * @param probe the number of sublists already visited (0 for the thread's home sublist)
+	 *
+	 * @return an index into the _sublists array
+	 */
+	MMINLINE uintptr_t
+	getSublistIndex(MM_EnvironmentBase *env, uintptr_t probe)
+	{
+		return MM_NUMAManager::getSublistIndex(env->_numaNode, env->getEnvironmentId(), probe, _sublistsPerNode, _sublistCount);
 	}
 	
 	/**
@@ -202,6 +219,7 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _sublistsPerNode(0)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
@@ -36,6 +36,9 @@
 #include "ObjectModel.hpp"
 #include "OMRVMInterface.hpp"
 #include "ParallelDispatcher.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetCardIterator.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #include "SlotObject.hpp"
 #include "SublistIterator.hpp"
 #include "SublistSlotIterator.hpp"
@@ -139,8 +142,23 @@ MM_HeapWalker::rememberedObjectSlotsDo(MM_EnvironmentBase *env, MM_HeapWalkerSlo
 	omrobjectptr_t* slotPtr = NULL;
 	MM_SublistPuddle *puddle = NULL;
 	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL != extensions->rememberedSetCardTable) {
+		uintptr_t heapTop = (uintptr_t)extensions->heap->getHeapTop();
+		for (uintptr_t low = (uintptr_t)extensions->heap->getHeapBase(); low < heapTop; low += RSCARDTABLE_WORK_UNIT_SIZE) {
+			if (!parallel || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				MM_RememberedSetCardIterator objectIterator(extensions->rememberedSetCardTable, (void *)low, (void *)OMR_MIN(low + RSCARDTABLE_WORK_UNIT_SIZE, heapTop));
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					heapWalkerObjectSlotDo(omrVMThread, NULL, objectPtr, &slotObjectDoUserData);
+				}
+			}
+		}
+		return;
+	}
 
-	GC_SublistIterator remSetIterator(&(env->getExtensions()->rememberedSet));
+	GC_SublistIterator remSetIterator(&(extensions->rememberedSet));
 	while ((puddle = remSetIterator.nextList()) != NULL) {
 		if (!parallel || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 			GC_SublistSlotIterator remSetSlotIterator(puddle);
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+
+#include "HotFieldTable.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+MM_HotFieldTable *
+MM_HotFieldTable::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HotFieldTable *table = (MM_HotFieldTable *)env->getForge()->allocate(sizeof(MM_HotFieldTable), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != table) {
+		new(table) MM_HotFieldTable();
+		if (!table->initialize(env)) {
+			table->kill(env);
+			table = NULL;
+		}
+	}
+	return table;
+}
+
+void
+MM_HotFieldTable::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HotFieldTable::initialize(MM_EnvironmentBase *env)
+{
+	_entries = (Entry *)env->getForge()->allocate(sizeof(Entry) * HOTFIELDTABLE_CLASSES, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _entries) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < HOTFIELDTABLE_CLASSES; i++) {
+		Entry *entry = &_entries[i];
+		entry->classKey = 0;
+		entry->samples = 0;
+		for (uintptr_t offset = 0; offset < HOTFIELDTABLE_TRACKED_OFFSETS; offset++) {
+			entry->counts[offset] = 0;
+		}
+		for (uintptr_t hot = 0; hot < HOTFIELDTABLE_HOT_FIELDS; hot++) {
+			entry->hotFields[hot] = U_8_MAX;
+		}
+	}
+	return true;
+}
+
+void
+MM_HotFieldTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _entries) {
+		env->getForge()->free(_entries);
+		_entries = NULL;
+	}
+}
+
+MM_HotFieldTable::Entry *
+MM_HotFieldTable::findOrAddEntry(uintptr_t classKey)
+{
+	uintptr_t index = hash(classKey);
+	for (uintptr_t probe = 0; probe < HOTFIELDTABLE_MAX_PROBES; probe++) {
+		Entry *entry = &_entries[(index + probe) & (HOTFIELDTABLE_CLASSES - 1)];
+		uintptr_t entryKey = entry->classKey;
+		if (0 == entryKey) {
+			entryKey = MM_AtomicOperations::lockCompareExchange(&entry->classKey, 0, classKey);
+			if (0 == entryKey) {
+				MM_AtomicOperations::add(&_classCount, 1);
+				return entry;
+			}
+		}
+		if (classKey == entryKey) {
+			return entry;
+		}
+	}
+	/* the neighbourhood of the class is full; it is not sampled */
+	return NULL;
+}
+
+void
+MM_HotFieldTable::chooseHotFields(MM_EnvironmentBase *env)
+{
+	uintptr_t hotClassCount = 0;
+	for (uintptr_t i = 0; i < HOTFIELDTABLE_CLASSES; i++) {
+		Entry *entry = &_entries[i];
+		if (0 == entry->classKey) {
+			continue;
+		}
+		if (HOTFIELDTABLE_MIN_SAMPLES <= entry->samples) {
+			uint32_t threshold = (uint32_t)(((uint64_t)entry->samples * HOTFIELDTABLE_HOT_PERCENT) / 100);
+			uint32_t hotCounts[HOTFIELDTABLE_HOT_FIELDS];
+			for (uintptr_t hot = 0; hot < HOTFIELDTABLE_HOT_FIELDS; hot++) {
+				entry->hotFields[hot] = U_8_MAX;
+				hotCounts[hot] = 0;
+			}
+			/* insertion sort of the few hottest fields which pass the threshold */
+			for (uintptr_t offset = 0; offset < HOTFIELDTABLE_TRACKED_OFFSETS; offset++) {
+				/* a field is counted at most once per sample, but racing GC threads may have lost sample increments */
+				uint32_t count = OMR_MIN(entry->counts[offset], entry->samples);
+				entry->counts[offset] = count;
+				if (threshold <= count) {
+					uintptr_t hot = HOTFIELDTABLE_HOT_FIELDS;
+					while ((0 < hot) && (hotCounts[hot - 1] < count)) {
+						if (hot < HOTFIELDTABLE_HOT_FIELDS) {
+							hotCounts[hot] = hotCounts[hot - 1];
+							entry->hotFields[hot] = entry->hotFields[hot - 1];
+						}
+						hot -= 1;
+					}
+					if (hot < HOTFIELDTABLE_HOT_FIELDS) {
+						hotCounts[hot] = count;
+						entry->hotFields[hot] = (uint8_t)offset;
+					}
+				}
+			}
+			/* age the samples, so that fields which cool down stop being hot */
+			entry->samples /= 2;
+			for (uintptr_t offset = 0; offset < HOTFIELDTABLE_TRACKED_OFFSETS; offset++) {
+				entry->counts[offset] /= 2;
+			}
+		}
+		if (U_8_MAX != entry->hotFields[0]) {
+			hotClassCount += 1;
+		}
+	}
+	_hotClassCount = hotClassCount;
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
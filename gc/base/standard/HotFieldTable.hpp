@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(HOTFIELDTABLE_HPP_)
+#define HOTFIELDTABLE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* Number of classes the table can describe (a power of two) */
+#define HOTFIELDTABLE_CLASSES 1024
+/* Number of slots probed for a class before it is given up on */
+#define HOTFIELDTABLE_MAX_PROBES 8
+/* Fields are tracked by offset, in slots from the object start; fields past this offset are never hot */
+#define HOTFIELDTABLE_TRACKED_OFFSETS 32
+/* Number of hot fields kept per class, as many as the scavenger depth copies */
+#define HOTFIELDTABLE_HOT_FIELDS 3
+/* Samples of a class needed before its hot fields are chosen */
+#define HOTFIELDTABLE_MIN_SAMPLES 16
+/* A field is hot if it referred to a live new object in at least this percentage of the samples of its class */
+#define HOTFIELDTABLE_HOT_PERCENT 50
+
+class MM_EnvironmentBase;
+
+/**
+ * Hot fields of object classes, discovered by sampling the objects scanned by the scavenger.
+ *
+ * For every sampled object, the scavenger counts which fields refer to objects that are being evacuated.
+ * Once a class has enough samples, the fields which referred to a live new object in most of them are
+ * its hot fields, and the scavenger copies the objects they refer to next to their parent, as it does for
+ * hot fields supplied by the object model. Counts are halved every time hot fields are chosen, so they
+ * follow changes of the object graph.
+ *
+ * Classes are added with a compare-and-swap and counted without atomics by all GC threads, so concurrent
+ * increments of an entry may be lost. As a lost sample increment makes a field count exceed the samples of its
+ * class, field counts are clamped to the samples when hot fields are chosen, which keeps every ratio at or
+ * below 100%. Hot fields are only chosen between scavenges, so they are read without synchronization.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_HotFieldTable : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct Entry {
+		volatile uintptr_t classKey; /**< key of the described class, or 0 if the entry is free */
+		uint32_t samples; /**< objects of the class sampled */
+		uint32_t counts[HOTFIELDTABLE_TRACKED_OFFSETS]; /**< samples in which the field at each offset referred to a new object (may exceed samples until clamped) */
+		uint8_t hotFields[HOTFIELDTABLE_HOT_FIELDS]; /**< offsets of the hot fields, hottest first, U_8_MAX in unused entries */
+	};
+
+	Entry *_entries;
+	volatile uintptr_t _classCount; /**< entries in use */
+	uintptr_t _hotClassCount; /**< classes with at least one hot field */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE static uintptr_t
+	hash(uintptr_t classKey)
+	{
+		/* class keys are often pointers or sizes, so mix the low bits with the high ones */
+		uintptr_t value = classKey ^ (classKey >> 17) ^ (classKey >> 7);
+		return value & (HOTFIELDTABLE_CLASSES - 1);
+	}
+
+	MMINLINE Entry *
+	findEntry(uintptr_t classKey)
+	{
+		uintptr_t index = hash(classKey);
+		for (uintptr_t probe = 0; probe < HOTFIELDTABLE_MAX_PROBES; probe++) {
+			Entry *entry = &_entries[(index + probe) & (HOTFIELDTABLE_CLASSES - 1)];
+			uintptr_t entryKey = entry->classKey;
+			if (classKey == entryKey) {
+				return entry;
+			}
+			if (0 == entryKey) {
+				break;
+			}
+		}
+		return NULL;
+	}
+
+	Entry *findOrAddEntry(uintptr_t classKey);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_HotFieldTable *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start sampling an object. May be called concurrently.
+	 * @param classKey[in] the class key of the object, as given by the object model
+	 * @return the counts of the class (to be passed to countField()), or NULL if the object should not be sampled
+	 */
+	MMINLINE uint32_t *
+	sampleObject(uintptr_t classKey)
+	{
+		uint32_t *counts = NULL;
+		if (0 != classKey) {
+			Entry *entry = findOrAddEntry(classKey);
+			if (NULL != entry) {
+				entry->samples += 1;
+				counts = entry->counts;
+			}
+		}
+		return counts;
+	}
+
+	/**
+	 * Count a field of a sampled object which refers to a new object.
+	 * @param counts[in] counts returned by sampleObject()
+	 * @param offset[in] offset of the field, in slots from the object start
+	 */
+	MMINLINE static void
+	countField(uint32_t *counts, uintptr_t offset)
+	{
+		if (offset < HOTFIELDTABLE_TRACKED_OFFSETS) {
+			counts[offset] += 1;
+		}
+	}
+
+	/**
+	 * @param classKey[in] the class key of an object, as given by the object model
+	 * @return the HOTFIELDTABLE_HOT_FIELDS offsets of the hot fields of the class, hottest first and U_8_MAX in
+	 * unused entries, or NULL if the class has none
+	 */
+	MMINLINE const uint8_t *
+	getHotFields(uintptr_t classKey)
+	{
+		const uint8_t *hotFields = NULL;
+		if (0 != classKey) {
+			Entry *entry = findEntry(classKey);
+			if ((NULL != entry) && (U_8_MAX != entry->hotFields[0])) {
+				hotFields = entry->hotFields;
+			}
+		}
+		return hotFields;
+	}
+
+	/**
+	 * Choose the hot fields of every class from its samples, and age the samples. Must not run concurrently
+	 * with sampling or copying.
+	 */
+	void chooseHotFields(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getClassCount() { return _classCount; }
+	MMINLINE uintptr_t getHotClassCount() { return _hotClassCount; }
+
+	/**
+	 * Create a HotFieldTable object.
+	 */
+	MM_HotFieldTable()
+		: MM_BaseVirtual()
+		, _entries(NULL)
+		, _classCount(0)
+		, _hotClassCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* HOTFIELDTABLE_HPP_ */
@@ -39,6 +39,15 @@ MM_ParallelCompactTask::getVMStateID()
 	return OMRVMSTATE_GC_COMPACT;
 }
 
+/**
+ * The work of a compaction is the number of bytes moved, as merged from all threads.
+ */
+uintptr_t
+MM_ParallelCompactTask::getCompletedWorkVolume(MM_EnvironmentBase *env)
+{
+	return MM_GCExtensionsBase::getExtensions(env->getOmrVM())->globalGCStats.compactStats._movedBytes;
+}
+
 void
 MM_ParallelCompactTask::run(MM_EnvironmentBase *env)
 {
@@ -43,6 +43,7 @@
 #include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
+#include "IdleGCDetector.hpp"
 #include "MarkingScheme.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -63,6 +64,9 @@
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetCardTable.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#if defined(OMR_GC_MODRON_SCAVENGER)
 #include "Scavenger.hpp"
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #include "WorkPackets.hpp"
@@ -314,6 +318,15 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (_extensions->gcOnIdle && (0 != _extensions->gcOnIdleDelay)) {
+		_idleGCDetector = MM_IdleGCDetector::newInstance(env);
+		if (NULL == _idleGCDetector) {
+			goto error_no_memory;
+		}
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -378,6 +391,13 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
 	}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != _idleGCDetector) {
+		_idleGCDetector->kill(env);
+		_idleGCDetector = NULL;
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 }
 
 uintptr_t
@@ -523,6 +543,25 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 		}
 	}
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCardTable) {
+		/* Drop the remembered objects that died, or index them again if compaction moved them */
+		MM_MemorySubSpace *tenureSubSpace = _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+#if defined(OMR_GC_MODRON_COMPACTION)
+		if (compactedThisCycle) {
+			if (!_fixHeapForWalkCompleted) {
+				getCompactScheme(env)->fixHeapForWalk(env);
+				_fixHeapForWalkCompleted = true;
+			}
+			_extensions->rememberedSetCardTable->rebuild(env, tenureSubSpace);
+		} else
+#endif /* OMR_GC_MODRON_COMPACTION */
+		{
+			_extensions->rememberedSetCardTable->removeUnmarkedObjects(env, tenureSubSpace, _markingScheme->getMarkMap());
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	_delegate.mainThreadGarbageCollectFinished(env, compactedThisCycle);
 
 #if defined(OMR_GC_MODRON_COMPACTION)
@@ -957,6 +996,10 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
+	if (_extensions->markingClassHistogram) {
+		_markingScheme->takeClassHistogram(env, &_extensions->globalGCStats.classHistogram);
+	}
+
 	/* Do any post mark checks */
 	postMark(env);
 	_markingScheme->mainCleanupAfterGC(env);
@@ -1055,6 +1098,13 @@ MM_ParallelGlobalGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	}
 
 	GC_OMRVMInterface::flushCachesForGC(env);
+
+	if (_extensions->heapSizingForecast) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_Heap *heap = _extensions->heap;
+		uintptr_t usedBytes = heap->getActiveMemorySize(MEMORY_TYPE_OLD) - heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD);
+		heap->getSizingForecast()->recordCollectionStart(omrtime_hires_clock(), usedBytes);
+	}
 	
 	_markingScheme->getMarkMap()->setMarkMapValid(false);
 	
@@ -1114,6 +1164,12 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 	_extensions->lastGlobalGCFreeBytesLOA = _extensions->heap->getApproximateActiveFreeLOAMemorySize(MEMORY_TYPE_OLD); 
 #endif /* defined (OMR_GC_LARGE_OBJECT_AREA) */
+	if (_extensions->heapSizingForecast) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_Heap *heap = _extensions->heap;
+		uintptr_t usedBytes = heap->getActiveMemorySize(MEMORY_TYPE_OLD) - _extensions->getLastGlobalGCFreeBytes();
+		heap->getSizingForecast()->recordCollectionEnd(omrtime_hires_clock(), usedBytes);
+	}
 
 
 #if defined(OMR_ENV_DATA64) && defined(OMR_GC_FULL_POINTERS)
@@ -1311,6 +1367,15 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	}
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCardTable) {
+		result = _extensions->rememberedSetCardTable->heapAddRange(env, subspace, size, lowAddress, highAddress);
+		if (0 == result) {
+			goto rememberedSetCardTable_failed_heapAddRange;
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	result = _delegate.heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
 		goto parallelGlobalGC_failed_heapAddRange;
@@ -1319,6 +1384,12 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	return true;
 
 parallelGlobalGC_failed_heapAddRange:
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCardTable) {
+		_extensions->rememberedSetCardTable->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
+	}
+rememberedSetCardTable_failed_heapAddRange:
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_OBJECT_MAP)
 	_extensions->getObjectMap()->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
 objectMap_failed_heapAddRange:
@@ -1339,6 +1410,11 @@ MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace
 {
 	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 	result = result && _sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCardTable) {
+		result = result && _extensions->rememberedSetCardTable->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 	result = result && _delegate.heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
@@ -1362,12 +1438,23 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != _idleGCDetector) {
+		return _idleGCDetector->startup(extensions);
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	return true;
 }
 
 void
 MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	/* an idle collection may be running, so stop the detector before anything it uses */
+	if (NULL != _idleGCDetector) {
+		_idleGCDetector->shutdown(extensions);
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (extensions->scavengerEnabled && (NULL != extensions->scavenger)) {
 		extensions->scavenger->collectorShutdown(extensions);
@@ -49,6 +49,7 @@ void healReferenceSlots(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *regi
 
 class MM_CollectionStatisticsStandard;
 class MM_CompactScheme;
+class MM_IdleGCDetector;
 class MM_ParallelDispatcher;
 class MM_MarkingScheme;
 class MM_MemorySubSpace;
@@ -71,6 +72,9 @@ private:
 	MM_CompactScheme *_compactScheme;
 	bool _compactThisCycle;		/**< keep a decision should compact run this cycle */
 #endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	MM_IdleGCDetector *_idleGCDetector; /**< starts idle collections in the background, NULL unless gcOnIdleDelay is set */
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 protected:
 	MM_MarkingScheme *_markingScheme;
@@ -338,6 +342,9 @@ public:
 		, _compactScheme(NULL)
 		, _compactThisCycle(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+		, _idleGCDetector(NULL)
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _heapWalker(NULL)
@@ -27,6 +27,7 @@
 #include "ModronAssertions.h"
 
 #include "EnvironmentStandard.hpp"
+#include "GCExtensionsBase.hpp"
 #include "Scavenger.hpp"
 
 #include "ParallelScavengeTask.hpp"
@@ -66,6 +67,16 @@ MM_ParallelScavengeTask::cleanup(MM_EnvironmentBase *env)
 	}
 }
 
+/**
+ * The work of a scavenge is the number of bytes copied, as merged from all threads.
+ */
+uintptr_t
+MM_ParallelScavengeTask::getCompletedWorkVolume(MM_EnvironmentBase *env)
+{
+	MM_ScavengerStats *scavengerStats = &env->getExtensions()->incrementScavengerStats;
+	return scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes;
+}
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 void
 MM_ParallelScavengeTask::synchronizeGCThreads(MM_EnvironmentBase *envBase, const char *id)
@@ -53,6 +53,7 @@ protected:
 
 public:
 	virtual UDATA getVMStateID() { return OMRVMSTATE_GC_SCAVENGE; };
+	virtual uintptr_t getCompletedWorkVolume(MM_EnvironmentBase *env);
 
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
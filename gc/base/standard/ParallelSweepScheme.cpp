@@ -85,6 +85,15 @@ MM_ParallelSweepTask::setup(MM_EnvironmentBase *env)
 	env->_freeEntrySizeClassStats.resetCounts();
 }
 
+/**
+ * Sweep visits the mark map of the whole active heap, so its work is the active heap size.
+ */
+uintptr_t
+MM_ParallelSweepTask::getCompletedWorkVolume(MM_EnvironmentBase *env)
+{
+	return env->getExtensions()->heap->getActiveMemorySize();
+}
+
 /**
  * Gather sweep statistics into the global statistics counter at the end of the sweep task.
  */
@@ -341,14 +350,8 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		/* Skip the rest of the run of empty map slots in bulk */
+		markMapCurrent = _currentMarkMap->getScanKernels()->findNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -63,6 +63,7 @@ protected:
 
 public:
 	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_SWEEP; };
+	virtual uintptr_t getCompletedWorkVolume(MM_EnvironmentBase *env);
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
@@ -35,6 +35,7 @@
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
+#include "HeapPretouchTask.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapWalker.hpp"
 #include "MemorySubSpace.hpp"
@@ -1251,6 +1252,7 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 			/* Memory couldn't be commited (for whatever reason) - can't expand */
 			return 0;
 		}
+		MM_HeapPretouchTask::pretouch(env, newLowAddress, (void *)((uintptr_t)newLowAddress + splitExpandSize));
 		/* The survivor space will have its free list rebuilt - don't bother adding memory */
 		if(debug) {
 			omrtty_printf("\tRemove: allocate(%p %p)\n", freeRangeToTransferBase, (void *)_lowSemiSpaceRegion->getHighAddress());
@@ -1325,6 +1327,7 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 			/* Memory couldn't be commited (for whatever reason) - can't expand */
 			return 0;
 		}
+		MM_HeapPretouchTask::pretouch(env, newLowAddress, (void *)((uintptr_t)newLowAddress + splitExpandSize));
 		/* Adjust the high and low segment ranges (high gains at its base, low gives
 		 * way at top and gains at base)
 		 */
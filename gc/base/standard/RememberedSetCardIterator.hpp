@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(REMEMBEREDSETCARDITERATOR_HPP_)
+#define REMEMBEREDSETCARDITERATOR_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "Bits.hpp"
+#include "RememberedSetCardTable.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/**
+ * Iterate the remembered objects of a card remembered set within a heap range, in address order.
+ *
+ * Only the object map slots of dirty cards are read. Objects indexed concurrently may or may not
+ * be returned. The most recently returned object can be removed from the index; a card is cleaned
+ * once the iterator leaves it with no remembered object left. Removal must not race with another
+ * thread indexing objects in the same range.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RememberedSetCardIterator
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_MarkMap *_objectMap; /**< the index of remembered objects */
+	Card *_card; /**< card being iterated */
+	Card *_cardTop; /**< card following the iterated range */
+	uint8_t *_cardHeapBase; /**< heap address of _card */
+	uintptr_t _slotInCard; /**< index, within _card, of the object map slot being iterated */
+	uintptr_t _bits; /**< bits of the current object map slot not returned yet */
+	uintptr_t _lastBit; /**< mask of the most recently returned bit in the current slot */
+	bool _removedInCard; /**< an object of _card has been removed */
+	uintptr_t _dirtyCards; /**< number of dirty cards visited */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE uintptr_t *
+	getSlotPtr(uintptr_t slotInCard)
+	{
+		return _objectMap->getSlotPtrForAddress((omrobjectptr_t)(_cardHeapBase + (slotInCard * J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT)));
+	}
+
+	/**
+	 * Leave the current card, cleaning it if all of its objects were removed.
+	 */
+	MMINLINE void
+	finishCard()
+	{
+		if (_removedInCard) {
+			bool empty = true;
+			for (uintptr_t slot = 0; slot < RSCARDTABLE_MAP_SLOTS_PER_CARD; slot++) {
+				if (0 != *getSlotPtr(slot)) {
+					empty = false;
+					break;
+				}
+			}
+			if (empty) {
+				*_card = CARD_CLEAN;
+			}
+			_removedInCard = false;
+		}
+		_card += 1;
+		_cardHeapBase += CARD_SIZE;
+	}
+
+	/**
+	 * Advance to the next dirty card in the range.
+	 * @return false if there are no more dirty cards
+	 */
+	MMINLINE bool
+	nextDirtyCard()
+	{
+		while (_card < _cardTop) {
+			/* cards are mostly clean, so skip them a word at a time */
+			if ((0 == ((uintptr_t)_card & (sizeof(uintptr_t) - 1))) && ((_card + sizeof(uintptr_t)) <= _cardTop)) {
+				if (0 == *(uintptr_t *)_card) {
+					_card += sizeof(uintptr_t);
+					_cardHeapBase += sizeof(uintptr_t) * CARD_SIZE;
+					continue;
+				}
+			}
+			if (CARD_CLEAN != *_card) {
+				_dirtyCards += 1;
+				_slotInCard = 0;
+				_bits = *getSlotPtr(0);
+				return true;
+			}
+			_card += 1;
+			_cardHeapBase += CARD_SIZE;
+		}
+		return false;
+	}
+
+protected:
+public:
+	/**
+	 * @return the next remembered object in the range, or NULL
+	 */
+	MMINLINE omrobjectptr_t
+	nextObject()
+	{
+		while (_card < _cardTop) {
+			if (0 != _bits) {
+				uintptr_t bitIndex = MM_Bits::leadingZeroes(_bits);
+				_lastBit = (uintptr_t)1 << bitIndex;
+				_bits &= ~_lastBit;
+				return (omrobjectptr_t)(_cardHeapBase + (_slotInCard * J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT) + (bitIndex * J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT));
+			}
+			_slotInCard += 1;
+			if (_slotInCard < RSCARDTABLE_MAP_SLOTS_PER_CARD) {
+				_bits = *getSlotPtr(_slotInCard);
+			} else {
+				finishCard();
+				nextDirtyCard();
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * Remove the object most recently returned by nextObject() from the index.
+	 */
+	MMINLINE void
+	removeObject()
+	{
+		uintptr_t *slot = getSlotPtr(_slotInCard);
+		*slot &= ~_lastBit;
+		_removedInCard = true;
+	}
+
+	/**
+	 * @return number of dirty cards visited so far
+	 */
+	MMINLINE uintptr_t getDirtyCardCount() { return _dirtyCards; }
+
+	/**
+	 * Create an iterator over [lowAddress, highAddress), both card aligned.
+	 */
+	MM_RememberedSetCardIterator(MM_RememberedSetCardTable *cardTable, void *lowAddress, void *highAddress)
+		: _objectMap(cardTable->getObjectMap())
+		, _card(cardTable->getCardTableVirtualStart() + (((uintptr_t)lowAddress) >> CARD_SIZE_SHIFT))
+		, _cardTop(cardTable->getCardTableVirtualStart() + (((uintptr_t)highAddress) >> CARD_SIZE_SHIFT))
+		, _cardHeapBase((uint8_t *)lowAddress)
+		, _slotInCard(0)
+		, _bits(0)
+		, _lastBit(0)
+		, _removedInCard(false)
+		, _dirtyCards(0)
+	{
+		nextDirtyCard();
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* REMEMBEREDSETCARDITERATOR_HPP_ */
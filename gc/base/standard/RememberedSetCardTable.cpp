@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "RememberedSetCardTable.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "MemorySubSpace.hpp"
+#include "MemorySubSpaceRegionIteratorStandard.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "RememberedSetCardIterator.hpp"
+
+MM_RememberedSetCardTable *
+MM_RememberedSetCardTable::newInstance(MM_EnvironmentBase *env, MM_Heap *heap)
+{
+	MM_RememberedSetCardTable *cardTable = (MM_RememberedSetCardTable *)env->getForge()->allocate(sizeof(MM_RememberedSetCardTable), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != cardTable) {
+		new(cardTable) MM_RememberedSetCardTable();
+		if (!cardTable->initialize(env, heap)) {
+			cardTable->kill(env);
+			return NULL;
+		}
+	}
+	return cardTable;
+}
+
+bool
+MM_RememberedSetCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
+{
+	bool result = MM_CardTable::initialize(env, heap);
+	if (result) {
+		_objectMap = MM_MarkMap::newInstance(env, heap->getMaximumPhysicalRange());
+		result = (NULL != _objectMap);
+	}
+	return result;
+}
+
+void
+MM_RememberedSetCardTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _objectMap) {
+		_objectMap->kill(env);
+		_objectMap = NULL;
+	}
+	MM_CardTable::tearDown(env);
+}
+
+/**
+ * Commit the cards and object map which describe a range added to the heap.
+ * @param size The amount of memory added to the heap
+ * @param lowAddress The base address of the memory added to the heap
+ * @param highAddress The top address (non-inclusive) of the memory added to the heap
+ * @return true if the metadata was committed
+ */
+bool
+MM_RememberedSetCardTable::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	_heapAlloc = env->getExtensions()->heap->getHeapTop();
+
+	bool result = commitCardTableMemory(env, heapAddrToCardAddr(env, lowAddress), heapAddrToCardAddr(env, highAddress));
+	if (result) {
+		result = _objectMap->heapAddRange(env, size, lowAddress, highAddress);
+		if (result) {
+			clearObjectsInRange(env, lowAddress, highAddress);
+		}
+	}
+	return result;
+}
+
+/**
+ * Decommit the cards and object map which describe a range removed from the heap.
+ * @param size The amount of memory removed from the heap
+ * @param lowAddress The base address of the memory removed from the heap
+ * @param highAddress The top address (non-inclusive) of the memory removed from the heap
+ * @param lowValidAddress The first valid address previous to the lowest in the heap range being removed
+ * @param highValidAddress The first valid address following the highest in the heap range being removed
+ * @return true if the metadata was decommitted
+ */
+bool
+MM_RememberedSetCardTable::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	bool result = true;
+	/* nothing was committed if the heap failed to expand for the first time */
+	if (NULL != _heapAlloc) {
+		clearObjectsInRange(env, lowAddress, highAddress);
+
+		Card *lowValidCard = (NULL == lowValidAddress) ? NULL : heapAddrToCardAddr(env, lowValidAddress);
+		Card *highValidCard = (NULL == highValidAddress) ? NULL : heapAddrToCardAddr(env, highValidAddress);
+		result = decommitCardTableMemory(env, heapAddrToCardAddr(env, lowAddress), heapAddrToCardAddr(env, highAddress), lowValidCard, highValidCard);
+		if (result) {
+			result = _objectMap->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+		}
+		_heapAlloc = env->getExtensions()->heap->getHeapTop();
+	}
+	return result;
+}
+
+void
+MM_RememberedSetCardTable::clearObjectsInRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	_objectMap->setBitsInRange(env, lowAddress, highAddress, true);
+	clearCardsInRange(env, lowAddress, highAddress);
+}
+
+void
+MM_RememberedSetCardTable::removeUnmarkedObjects(MM_EnvironmentBase *env, MM_MemorySubSpace *tenureSubSpace, MM_MarkMap *markMap)
+{
+	GC_MemorySubSpaceRegionIteratorStandard regionIterator(tenureSubSpace);
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		MM_RememberedSetCardIterator objectIterator(this, region->getLowAddress(), region->getHighAddress());
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = objectIterator.nextObject())) {
+			if (!markMap->isBitSet(objectPtr)) {
+				objectIterator.removeObject();
+			}
+		}
+	}
+}
+
+void
+MM_RememberedSetCardTable::rebuild(MM_EnvironmentBase *env, MM_MemorySubSpace *tenureSubSpace)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	GC_MemorySubSpaceRegionIteratorStandard regionIterator(tenureSubSpace);
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		clearObjectsInRange(env, region->getLowAddress(), region->getHighAddress());
+		GC_ObjectHeapIteratorAddressOrderedList objectIterator(extensions, region, false);
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = objectIterator.nextObject())) {
+			if (extensions->objectModel.isRemembered(objectPtr)) {
+				rememberObject(env, objectPtr);
+			}
+		}
+	}
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(REMEMBEREDSETCARDTABLE_HPP_)
+#define REMEMBEREDSETCARDTABLE_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "CardTable.hpp"
+#include "MarkMap.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* Number of remembered object map slots which describe the heap covered by one card */
+#define RSCARDTABLE_MAP_SLOTS_PER_CARD (CARD_SIZE / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT)
+/* Bytes of heap handed out as one unit of work when the remembered set is processed in parallel */
+#define RSCARDTABLE_WORK_UNIT_SIZE ((uintptr_t)2 * 1024 * 1024)
+
+class MM_EnvironmentBase;
+class MM_Heap;
+class MM_MemorySubSpace;
+
+/**
+ * Card based scavenger remembered set.
+ *
+ * Every remembered old object has its start bit set in an object map, and the card covering the
+ * object is dirtied. Cards are only a summary of the object map, so processing the remembered
+ * set touches just the map slots of dirty cards and never has to parse the heap. Unlike the
+ * remembered set lists, the map has a fixed size and cannot overflow.
+ *
+ * Objects are added by the write barrier and by the scavenger (through addToRememberedSetFragment),
+ * always after their header remembered state was set, so an object is indexed at most once.
+ * Objects are removed by the scavenger while pruning, and the map is reconciled with the
+ * mark map (or rebuilt, if objects moved) at the end of every global collection.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RememberedSetCardTable : public MM_CardTable
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_MarkMap *_objectMap; /**< one bit per remembered object */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	void clearObjectsInRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_RememberedSetCardTable *newInstance(MM_EnvironmentBase *env, MM_Heap *heap);
+
+	bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
+	bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	MMINLINE MM_MarkMap *getObjectMap() { return _objectMap; }
+
+	/**
+	 * Index an object whose header remembered state has just been set. May be called concurrently.
+	 * @param objectPtr[in] an old object
+	 */
+	MMINLINE void
+	rememberObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		if (_objectMap->atomicSetBit(objectPtr)) {
+			/* the bit is set before the card is dirtied, so a dirty card always describes its objects */
+			Card *card = getCardTableVirtualStart() + (((uintptr_t)objectPtr) >> CARD_SIZE_SHIFT);
+			if (CARD_DIRTY != *card) {
+				*card = CARD_DIRTY;
+			}
+		}
+	}
+
+	/**
+	 * Drop indexed objects which were not marked by the global collection that just completed.
+	 * Cards left without remembered objects are cleaned.
+	 * @param tenureSubSpace[in] the subspace holding the remembered objects
+	 * @param markMap[in] the mark map of the completed global collection
+	 */
+	void removeUnmarkedObjects(MM_EnvironmentBase *env, MM_MemorySubSpace *tenureSubSpace, MM_MarkMap *markMap);
+
+	/**
+	 * Re-index the remembered objects from their header remembered state, after they were moved.
+	 * The heap must be walkable.
+	 * @param tenureSubSpace[in] the subspace holding the remembered objects
+	 */
+	void rebuild(MM_EnvironmentBase *env, MM_MemorySubSpace *tenureSubSpace);
+
+	/**
+	 * Create a RememberedSetCardTable object.
+	 */
+	MM_RememberedSetCardTable()
+		: MM_CardTable()
+		, _objectMap(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* REMEMBEREDSETCARDTABLE_HPP_ */
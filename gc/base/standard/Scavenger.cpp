@@ -30,6 +30,7 @@
 #endif
 
 #include <math.h>
+#include <new>
 
 #include "omrcfg.h"
 #include "omrcomp.h"
@@ -51,6 +52,7 @@
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentScavengeTask.hpp"
 #include "ConfigurationStandard.hpp"
+#include "CopyScanCacheDeque.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "EnvironmentStandard.hpp"
@@ -61,6 +63,7 @@
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "HotFieldTable.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -76,6 +79,8 @@
 #include "ParallelDispatcher.hpp"
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
+#include "RememberedSetCardIterator.hpp"
+#include "RememberedSetCardTable.hpp"
 #include "RSOverflow.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
@@ -232,6 +237,41 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* Work-stealing deques are only used by STW scan loops, where every producer of scan work is a GC thread.
+	 * Concurrent Scavenger has mutator threads producing scan work, so it keeps using the shared scan list only.
+	 */
+	if (_extensions->scavengerWorkStealing && !IS_CONCURRENT_ENABLED) {
+		_scanCacheDequeCount = _extensions->gcThreadCount;
+		_scanCacheDeques = (MM_CopyScanCacheDeque *)env->getForge()->allocate(sizeof(MM_CopyScanCacheDeque) * _scanCacheDequeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _scanCacheDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			new (&_scanCacheDeques[i]) MM_CopyScanCacheDeque();
+		}
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			if (!_scanCacheDeques[i].initialize(env, _extensions->scavengerScanCacheDequeSize, i + 1)) {
+				return false;
+			}
+		}
+	}
+
+	/* Concurrent Scavenger scans and prunes the remembered set concurrently with mutators, so it keeps using the remembered set lists */
+	if (_extensions->scavengerRememberedSetCards && !IS_CONCURRENT_ENABLED) {
+		_extensions->rememberedSetCardTable = MM_RememberedSetCardTable::newInstance(env, _extensions->heap);
+		if (NULL == _extensions->rememberedSetCardTable) {
+			return false;
+		}
+	}
+
+	/* discovered hot fields are only used by hot field depth copying */
+	if (_extensions->scavengerHotFieldDiscovery && (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == _extensions->scavengerScanOrdering)) {
+		_hotFieldTable = MM_HotFieldTable::newInstance(env);
+		if (NULL == _hotFieldTable) {
+			return false;
+		}
+	}
+
 	if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_Scavenger::scanCacheMonitor")) {
 		return false;
 	}
@@ -307,6 +347,24 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _scanCacheDeques) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			_scanCacheDeques[i].tearDown(env);
+		}
+		env->getForge()->free(_scanCacheDeques);
+		_scanCacheDeques = NULL;
+	}
+
+	if (NULL != _extensions->rememberedSetCardTable) {
+		_extensions->rememberedSetCardTable->kill(env);
+		_extensions->rememberedSetCardTable = NULL;
+	}
+
+	if (NULL != _hotFieldTable) {
+		_hotFieldTable->kill(env);
+		_hotFieldTable = NULL;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -378,6 +436,11 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	/* Reinitialize the copy scan caches */
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
+	if (NULL != _scanCacheDeques) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			_scanCacheDeques[i].reset();
+		}
+	}
 	_extensions->copyScanRatio.reset(env, true);
 
 	/* Cache heap ranges for fast "valid object" checks (this can change in an expanding heap situation, so we refetch every cycle) */
@@ -494,6 +557,12 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
+	if (NULL != _scanCacheDeques) {
+		/* whichever workers took part in the task, every cache pushed on a deque has been scanned */
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			Assert_MM_true(_scanCacheDeques[i].isEmpty());
+		}
+	}
 }
 
 void
@@ -740,6 +809,15 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_syncStallTime += scavStats->_syncStallTime;
 	finalGCStats->_workStallCount += scavStats->_workStallCount;
 	finalGCStats->_completeStallCount += scavStats->_completeStallCount;
+	finalGCStats->_scanCacheStealAttempts += scavStats->_scanCacheStealAttempts;
+	finalGCStats->_scanCacheStealSuccesses += scavStats->_scanCacheStealSuccesses;
+	finalGCStats->_scanCacheIdleTime += scavStats->_scanCacheIdleTime;
+	finalGCStats->_rememberedSetDirtyCards += scavStats->_rememberedSetDirtyCards;
+	finalGCStats->_rememberedSetObjectsScanned += scavStats->_rememberedSetObjectsScanned;
+	finalGCStats->_rememberedSetScanTime += scavStats->_rememberedSetScanTime;
+	finalGCStats->_hotFieldSamples += scavStats->_hotFieldSamples;
+	finalGCStats->_hotFieldLookups += scavStats->_hotFieldLookups;
+	finalGCStats->_hotFieldHits += scavStats->_hotFieldHits;
 	_extensions->scavengerStats._syncStallCount += scavStats->_syncStallCount;
 }
 
@@ -925,7 +1003,7 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 		cacheSize = OMR_MIN(cacheSizeBasedOnWaitingCount, cacheSize);
 	}
 
-	env->approxScanCacheCount = _scavengeCacheScanList.getApproximateEntryCount();
+	env->approxScanCacheCount = getApproximateScanCacheCount();
 	if (env->approxScanCacheCount < threadCount) {
 		uintptr_t cacheSizeBasedOnScanCacheCount = calculateCopyScanCacheSizeForQueueLength(maxCacheSize, threadCount, env->approxScanCacheCount);
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
@@ -1692,12 +1770,40 @@ MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader
 					copyHotField(env, destinationObjectPtr, hotFieldOffset3);
 				}
 			}
-		} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
-			copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+		} else {
+			const uint8_t *hotFields = NULL;
+			if ((NULL != _hotFieldTable) && !_extensions->objectModel.isIndexable(forwardedHeader)) {
+				env->_scavengerStats._hotFieldLookups += 1;
+				hotFields = _hotFieldTable->getHotFields(_extensions->objectModel.getHotFieldClassKey(forwardedHeader));
+			}
+			if (NULL != hotFields) {
+				env->_scavengerStats._hotFieldHits += 1;
+				for (uintptr_t hot = 0; (hot < HOTFIELDTABLE_HOT_FIELDS) && (U_8_MAX != hotFields[hot]); hot++) {
+					copyHotField(env, destinationObjectPtr, hotFields[hot]);
+				}
+			} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
+				copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+			}
 		}
 	}
 }
 
+MMINLINE uint32_t *
+MM_Scavenger::startHotFieldSample(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	uint32_t *hotFieldCounts = NULL;
+	if (0 == env->_hotFieldSampleCountdown) {
+		env->_hotFieldSampleCountdown = _extensions->scavengerHotFieldSampleInterval;
+		hotFieldCounts = _hotFieldTable->sampleObject(_extensions->objectModel.getHotFieldClassKey(objectPtr));
+		if (NULL != hotFieldCounts) {
+			env->_scavengerStats._hotFieldSamples += 1;
+		}
+	} else {
+		env->_hotFieldSampleCountdown -= 1;
+	}
+	return hotFieldCounts;
+}
+
 MMINLINE void
 MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset) {
 	GC_SlotObject hotFieldObject(_omrVM, (fomrobject_t*)(destinationObjectPtr + offset));
@@ -1795,7 +1901,7 @@ MM_Scavenger::updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanne
 	env->_scavengerStats._slotsCopied += slotsCopied;
 	uint64_t updateResult = _extensions->copyScanRatio.update(env, &(env->_scavengerStats._slotsScanned), &(env->_scavengerStats._slotsCopied), _waitingCount, &(env->_scavengerStats._copyScanUpdates));
 	if (0 != updateResult) {
-		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, _scavengeCacheScanList.getApproximateEntryCount());
+		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, getApproximateScanCacheCount());
 	}
 }
 
@@ -1809,9 +1915,9 @@ MM_Scavenger::flushCopyScanCounts(MM_EnvironmentBase* env, bool majorFlush)
 	}
 
 	if (majorFlush) {
-		_extensions->copyScanRatio.flush(env, _cachedEntryCount, _scavengeCacheScanList.getApproximateEntryCount());
+		_extensions->copyScanRatio.flush(env, _cachedEntryCount, getApproximateScanCacheCount());
 	} else if (0 != updateResult) {
-		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, _scavengeCacheScanList.getApproximateEntryCount());
+		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, getApproximateScanCacheCount());
 	}
 }
 
@@ -1860,8 +1966,18 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	bool shouldRemember = false;
 	GC_SlotObject *slotObject = NULL;
 
+	uint32_t *hotFieldCounts = NULL;
+	if ((NULL != _hotFieldTable) && !objectScanner->isIndexableObject()) {
+		hotFieldCounts = startHotFieldSample(env, objectPtr);
+	}
+
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
 	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+		if ((NULL != hotFieldCounts) && isObjectInEvacuateMemory(slotObject->readReferenceFromSlot())) {
+			/* offsets are in the units copyHotField() adds to an object pointer */
+			uintptr_t offset = ((uintptr_t)slotObject->readAddressFromSlot() - (uintptr_t)objectPtr) / sizeof(*objectPtr);
+			MM_HotFieldTable::countField(hotFieldCounts, offset);
+		}
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		shouldRemember |= isSlotObjectInNewSpace;
 		if (NULL != *copyCache) {
@@ -2161,17 +2277,21 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	env->_scavengerStats._acquireScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
-#if defined(OMR_SCAVENGER_TRACE) || defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
-#endif /* OMR_SCAVENGER_TRACE || J9MODRON_TGC_PARALLEL_STATISTICS */
+	/* with work stealing, time spent without scan work is accounted from the first failed attempt to get a cache */
+	uint64_t idleStartTime = 0;
 
  	while (!doneFlag && !shouldAbortScanLoop(env)) {
- 		while (_cachedEntryCount > 0) {
+ 		while (isScanCacheWorkAvailable(env)) {
  			cache = getNextScanCacheFromList(env);
 
 			if (NULL != cache) {
+				if (0 != idleStartTime) {
+					env->_scavengerStats._scanCacheIdleTime += omrtime_hires_clock() - idleStartTime;
+				}
+
  				/* Check if there are threads waiting that should be notified because of pending entries */
- 				if((_cachedEntryCount > 0) && _waitingCount) {
+ 				if(_waitingCount && isScanCacheWorkAvailable(env)) {
 					if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
 						if(0 != _waitingCount) {
 							omrthread_monitor_notify(_scanCacheMonitor);
@@ -2188,11 +2308,15 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 			}
 		}
 
+		if ((NULL != _scanCacheDeques) && (0 == idleStartTime)) {
+			idleStartTime = omrtime_hires_clock();
+		}
+
 		omrthread_monitor_enter(_scanCacheMonitor);
 		_waitingCount += 1;
 
 		if(doneIndex == _doneIndex) {
-			if((env->_currentTask->getThreadCount() == _waitingCount) && (0 == _cachedEntryCount)) {
+			if((env->_currentTask->getThreadCount() == _waitingCount) && !isScanCacheWorkAvailable(env)) {
 				flushBuffersForGetNextScanCache(env, true);
 
 				if (shouldDoFinalNotify(env)) {
@@ -2201,7 +2325,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					omrthread_monitor_notify_all(_scanCacheMonitor);
 				}
 			} else {
-				while((0 == _cachedEntryCount) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
+				while(!isScanCacheWorkAvailable(env) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
 					flushBuffersForGetNextScanCache(env);
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 					uint64_t waitEndTime, waitStartTime;
@@ -2229,6 +2353,10 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 		omrthread_monitor_exit(_scanCacheMonitor);
 	}
 
+	if (0 != idleStartTime) {
+		env->_scavengerStats._scanCacheIdleTime += omrtime_hires_clock() - idleStartTime;
+	}
+
 	return cache;
 }
 
@@ -2504,6 +2632,11 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 	Assert_MM_true(!isObjectInNewSpace(objectPtr));
 	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 
+	if (NULL != _extensions->rememberedSetCardTable) {
+		_extensions->rememberedSetCardTable->rememberObject(env, objectPtr);
+		return;
+	}
+
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
 		/* There wasn't enough room in the current fragment - allocate a new one */
 		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
@@ -2712,6 +2845,8 @@ MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 {
 	if(isRememberedSetInOverflowState()) {
 		pruneRememberedSetOverflow(env);
+	} else if (NULL != _extensions->rememberedSetCardTable) {
+		pruneRememberedSetCards(env);
 	} else {
 		pruneRememberedSetList(env);
 	}
@@ -2866,6 +3001,52 @@ MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 }
 
+void
+MM_Scavenger::pruneRememberedSetCards(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	/* Objects are remembered until the end of the thread slot rescan, and the index must not change while it is pruned */
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	MM_RememberedSetCardTable *cardTable = _extensions->rememberedSetCardTable;
+	for (uintptr_t low = (uintptr_t)_heapBase; low < (uintptr_t)_heapTop; low += RSCARDTABLE_WORK_UNIT_SIZE) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t high = OMR_MIN(low + RSCARDTABLE_WORK_UNIT_SIZE, (uintptr_t)_heapTop);
+			MM_RememberedSetCardIterator objectIterator(cardTable, (void *)low, (void *)high);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = objectIterator.nextObject())) {
+				if (!_extensions->objectModel.isRemembered(objectPtr)) {
+					/* the header remembered state is authoritative; the index may only lag behind it */
+					objectIterator.removeObject();
+					continue;
+				}
+
+				/* Unconditionally remember object if it was recently referenced */
+				bool shouldBeRemembered = processRememberedThreadReference(env, objectPtr);
+				if (shouldBeRemembered) {
+					Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+				} else {
+					/* Check if object still has nursery references, direct or indirect */
+					shouldBeRemembered = shouldRememberObject(env, objectPtr);
+				}
+
+				if (!shouldBeRemembered) {
+					/* A simple mask out can be used - we are guaranteed to be the only manipulator of the object */
+					_extensions->objectModel.clearRemembered(objectPtr);
+					objectIterator.removeObject();
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference()) {
+						/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set */
+						oldToOldReferenceCreated(env, objectPtr);
+					}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+				}
+			}
+		}
+	}
+}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 void
 MM_Scavenger::scavengeRememberedSetListDirect(MM_EnvironmentStandard *env)
@@ -2989,6 +3170,39 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
+void
+MM_Scavenger::scavengeRememberedSetCards(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	uint64_t startTime = omrtime_hires_clock();
+	uintptr_t dirtyCards = 0;
+	uintptr_t objects = 0;
+
+	/* Objects remembered while the scan is in progress may or may not be found. Their slots have already been
+	 * scavenged, so scanning them again only finds references that are up to date.
+	 */
+	MM_RememberedSetCardTable *cardTable = _extensions->rememberedSetCardTable;
+	for (uintptr_t low = (uintptr_t)_heapBase; low < (uintptr_t)_heapTop; low += RSCARDTABLE_WORK_UNIT_SIZE) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t high = OMR_MIN(low + RSCARDTABLE_WORK_UNIT_SIZE, (uintptr_t)_heapTop);
+			MM_RememberedSetCardIterator objectIterator(cardTable, (void *)low, (void *)high);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = objectIterator.nextObject())) {
+				/* whether the object is still remembered is decided when the remembered set is pruned */
+				scavengeRememberedObject(env, objectPtr);
+				objects += 1;
+			}
+			dirtyCards += objectIterator.getDirtyCardCount();
+		}
+	}
+
+	env->_scavengerStats._rememberedSetDirtyCards += dirtyCards;
+	env->_scavengerStats._rememberedSetObjectsScanned += objects;
+	env->_scavengerStats._rememberedSetScanTime += omrtime_hires_clock() - startTime;
+}
+
 /* NOTE - only  scavengeRememberedSetOverflow ends with a sync point.
  * Callers of this function must not assume that there is a sync point
  */
@@ -3005,7 +3219,9 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 			scavengeRememberedSetOverflow(env);
 		}
 	} else {
-		if (!IS_CONCURRENT_ENABLED) {
+		if (NULL != _extensions->rememberedSetCardTable) {
+			scavengeRememberedSetCards(env);
+		} else if (!IS_CONCURRENT_ENABLED) {
 			scavengeRememberedSetList(env);
 		}
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -3421,7 +3637,10 @@ MM_Scavenger::returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	/* with work stealing, the shared scan list only receives what overflows the thread's own deque */
+	if (!isScanCacheDequeOwner(env) || !_scanCacheDeques[env->getWorkerID()].push(newCacheEntry)) {
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	}
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3500,7 +3719,105 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	if (isScanCacheDequeOwner(env)) {
+		/* own work first (most recently produced, hence warmest), then other threads' work, then overflow */
+		cache = _scanCacheDeques[env->getWorkerID()].pop();
+		if (NULL == cache) {
+			cache = stealScanCache(env);
+		}
+	}
+
+	if ((NULL == cache) && (0 != _cachedEntryCount)) {
+		cache = _scavengeCacheScanList.popCache(env);
+	}
+
+	return cache;
+}
+
+MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env)
+{
+	uintptr_t workerID = env->getWorkerID();
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	MM_CopyScanCacheDeque *ownDeque = &_scanCacheDeques[workerID];
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	/* with NUMA-bound workers, drain the deques of threads on the same node before going remote */
+	if (0 != env->_numaNode) {
+		MM_ParallelDispatcher *dispatcher = _extensions->dispatcher;
+		for (uintptr_t victimID = 0; (NULL == cache) && (victimID < _scanCacheDequeCount); victimID++) {
+			if ((victimID != workerID) && (env->_numaNode == dispatcher->getWorkerNumaNode(victimID))) {
+				cache = stealScanCache(env, victimID);
+			}
+		}
+	}
+
+	/* random victims first to spread thieves out, then a sweep so a single non-empty deque is not missed */
+	for (uintptr_t attempt = 0; (NULL == cache) && (attempt < (threadCount + _scanCacheDequeCount)); attempt++) {
+		uintptr_t victimID = 0;
+		if (attempt < threadCount) {
+			victimID = ownDeque->nextStealVictim(_scanCacheDequeCount);
+		} else {
+			victimID = (workerID + attempt) % _scanCacheDequeCount;
+		}
+
+		if (victimID != workerID) {
+			cache = stealScanCache(env, victimID);
+		}
+	}
+
+	return cache;
+}
+
+MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env, uintptr_t victimID)
+{
+	MM_CopyScanCacheDeque *victim = &_scanCacheDeques[victimID];
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	if (!victim->isEmpty()) {
+		env->_scavengerStats._scanCacheStealAttempts += 1;
+		cache = victim->steal();
+		if (NULL != cache) {
+			env->_scavengerStats._scanCacheStealSuccesses += 1;
+		}
+	}
+
+	return cache;
+}
+
+bool
+MM_Scavenger::isScanCacheWorkAvailable(MM_EnvironmentStandard *env)
+{
+	if (0 != _cachedEntryCount) {
+		return true;
+	}
+
+	if (isScanCacheDequeOwner(env)) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			if (!_scanCacheDeques[i].isEmpty()) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+uintptr_t
+MM_Scavenger::getApproximateScanCacheCount()
+{
+	uintptr_t count = _scavengeCacheScanList.getApproximateEntryCount();
+
+	if (NULL != _scanCacheDeques) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			count += _scanCacheDeques[i].getApproximateEntryCount();
+		}
+	}
+
+	return count;
 }
 
 /**
@@ -3849,7 +4166,9 @@ MM_Scavenger::processRememberedSetInBackout(MM_EnvironmentStandard *env)
 		}
 	} else
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
-	{
+	if (NULL != _extensions->rememberedSetCardTable) {
+		processRememberedSetCardsInBackout(env);
+	} else {
 		/* Walk the remembered set removing any tagged entries (back out of a tenured copy that is remembered)
 		 * and scanning remembered objects for reverse fwd info
 		 */
@@ -3887,6 +4206,23 @@ MM_Scavenger::processRememberedSetInBackout(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_Scavenger::processRememberedSetCardsInBackout(MM_EnvironmentStandard *env)
+{
+	bool const compressed = _extensions->compressObjectReferences();
+
+	/* Remove back out tenured copies and scan remembered objects for reverse fwd info */
+	MM_RememberedSetCardIterator objectIterator(_extensions->rememberedSetCardTable, _heapBase, _heapTop);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = objectIterator.nextObject())) {
+		if (MM_ForwardedHeader(objectPtr, compressed).isReverseForwardedPointer()) {
+			objectIterator.removeObject();
+		} else {
+			backOutObjectScan(env, objectPtr);
+		}
+	}
+}
+
 void
 MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 {
@@ -3920,6 +4256,15 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+
+			/* all other GC threads are blocked, so stealing drains each deque safely */
+			if (NULL != _scanCacheDeques) {
+				for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+					while (NULL != (cache = _scanCacheDeques[i].steal())) {
+						flushCache(env, cache);
+					}
+				}
+			}
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
 
@@ -4078,6 +4423,15 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 
 	/* merge stats from this increment/phase to aggregate cycle stats */
 	mergeIncrementGCStats(env, lastIncrement);
+
+	if (lastIncrement && (NULL != _hotFieldTable)) {
+		/* hot fields are chosen between scavenges, while no thread samples or copies objects */
+		if (0 == (_extensions->scavengerStats._gcCount % OMR_MAX(_extensions->gcCountBetweenHotFieldSort, 1))) {
+			_hotFieldTable->chooseHotFields(env);
+		}
+		_extensions->scavengerStats._hotFieldClasses = _hotFieldTable->getClassCount();
+		_extensions->scavengerStats._hotFieldHotClasses = _hotFieldTable->getHotClassCount();
+	}
 	reportScavengeEnd(env, lastIncrement);
 
 	if (lastIncrement) {
@@ -34,10 +34,12 @@
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
+#include "CopyScanCacheDeque.hpp"
 #include "CopyScanCacheList.hpp"
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HotFieldTable.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
@@ -107,6 +109,9 @@ private:
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
+	MM_CopyScanCacheDeque *_scanCacheDeques; /**< per GC thread work-stealing deques of scan caches, indexed by worker ID (NULL unless scavengerWorkStealing is enabled) */
+	uintptr_t _scanCacheDequeCount; /**< number of entries in _scanCacheDeques */
+	MM_HotFieldTable *_hotFieldTable; /**< hot fields discovered by sampling scanned objects (NULL unless scavengerHotFieldDiscovery is enabled) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
@@ -279,6 +284,14 @@ public:
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
+	/**
+	 * Decide whether the fields of an object about to be scanned are sampled to discover the hot fields of its class.
+	 * One in scavengerHotFieldSampleInterval objects scanned by a thread is sampled.
+	 * @param objectPtr The object about to be scanned
+	 * @return the field counts of the class of the object, or NULL if the object is not sampled
+	 */
+	MMINLINE uint32_t *startHotFieldSample(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -336,6 +349,9 @@ public:
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
+	void scavengeRememberedSetCards(MM_EnvironmentStandard *env);
+	void pruneRememberedSetCards(MM_EnvironmentStandard *env);
+	void processRememberedSetCardsInBackout(MM_EnvironmentStandard *env);
 
 	/**
 	 * Checks if the  Object should be remembered or not
@@ -401,6 +417,50 @@ public:
 	MMINLINE uintptr_t copyCacheDistanceMetric(MM_CopyScanCacheStandard* cache);
 
 	MMINLINE MM_CopyScanCacheStandard *getNextScanCacheFromList(MM_EnvironmentStandard *env);
+
+	/**
+	 * Determine whether the current thread may push scan caches onto its own work-stealing deque.
+	 * Only GC threads participating in a task own a deque.
+	 * @param env - current thread environment
+	 * @return true if scan caches should be pushed to the thread's deque
+	 */
+	MMINLINE bool
+	isScanCacheDequeOwner(MM_EnvironmentStandard *env)
+	{
+		return (NULL != _scanCacheDeques) && (NULL != env->_currentTask);
+	}
+
+	/**
+	 * Try to steal a scan cache from the deque of another thread. Deques are indexed by worker ID, and the workers
+	 * taking part in a task with fewer threads than the maximum can have any ID, so every deque is a candidate.
+	 * Threads on the same NUMA node are tried first, then victims are chosen at random.
+	 * @param env - current thread environment
+	 * @return a stolen scan cache, or NULL if none could be stolen
+	 */
+	MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env);
+
+	/**
+	 * Try to steal a scan cache from the deque of the specified thread.
+	 * Steal attempts and successes are recorded in the thread's scavenger stats.
+	 * @param env - current thread environment
+	 * @param victimID - worker ID of the thread to steal from
+	 * @return a stolen scan cache, or NULL if the deque was empty or the steal lost a race
+	 */
+	MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env, uintptr_t victimID);
+
+	/**
+	 * Determine whether there is any scan work on the shared scan list or, with work stealing, on the deque of
+	 * any thread. Not synchronized with producers, so only exact while all
+	 * participating threads are blocked in getNextScanCache().
+	 * @param env - current thread environment
+	 * @return true if scan work may be available
+	 */
+	bool isScanCacheWorkAvailable(MM_EnvironmentStandard *env);
+
+	/**
+	 * @return approximate number of scan caches queued on the shared scan list and all work-stealing deques
+	 */
+	uintptr_t getApproximateScanCacheCount();
 	/**
 	 * Called at the end of a task to return empty caches to the global free pool
 	 */
@@ -904,6 +964,9 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
+		, _scanCacheDeques(NULL)
+		, _scanCacheDequeCount(0)
+		, _hotFieldTable(NULL)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
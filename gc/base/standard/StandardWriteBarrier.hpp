@@ -41,6 +41,10 @@ struct OMR_VMThread;
  * To support OMR concurrent marking and/or generational collectors, this method calls the necessary
  * concurrent and generational write barriers.
  *
+ * The concurrent barrier dirties the card through MM_CardTable::dirtyCard(), which also records the card in
+ * the dirty card summary when concurrentCardCleaningSummary is enabled. An equivalent inline barrier must call
+ * it too rather than store to the card table directly, or card cleaning never finds the card.
+ *
  * @param omrThread The thread making the assignment of child reference into parent slot
  * @param parentObject the parent object
  * @param childObject THe child object reference
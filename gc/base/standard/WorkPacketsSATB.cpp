@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "omrcfg.h"
 #include "omrthread.h"
 
 #if defined(OMR_GC_REALTIME)
@@ -40,7 +41,7 @@ MM_WorkPacketsSATB::newInstance(MM_EnvironmentBase *env)
 {
 	MM_WorkPacketsSATB *workPackets;
 	
-	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
 	if (workPackets) {
 		new(workPackets) MM_WorkPacketsSATB(env);
 		if (!workPackets->initialize(env)) {
@@ -67,6 +68,11 @@ MM_WorkPacketsSATB::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* many mutators fill barrier packets at once, so they are queued with atomics regardless of packetListLockFree */
+	if (!_filledBarrierPacketList.initialize(env, true)) {
+		return false;
+	}
+
 	return true;
 }
 
@@ -79,6 +85,7 @@ MM_WorkPacketsSATB::tearDown(MM_EnvironmentBase *env)
 	MM_WorkPackets::tearDown(env);
 
 	_inUseBarrierPacketList.tearDown(env);
+	_filledBarrierPacketList.tearDown(env);
 }
 
 /**
@@ -124,6 +131,9 @@ MM_WorkPacketsSATB::getPacketByOverflowing(MM_EnvironmentBase *env)
 {
 	MM_Packet *packet = NULL;
 
+	/* filled barrier packets can be overflowed as well */
+	drainFilledBarrierPackets(env);
+
 	if (NULL != (packet = getPacket(env, &_fullPacketList))) {
 		/* Attempt to overflow a full mark packet.
 		 * Move the contents of the packet to overflow.
@@ -166,7 +176,32 @@ MM_WorkPacketsSATB::removePacketFromInUseList(MM_EnvironmentBase *env, MM_Packet
 void
 MM_WorkPacketsSATB::putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 {
-	_fullPacketList.push(env, packet);
+	_filledBarrierPacketList.push(env, packet);
+}
+
+bool
+MM_WorkPacketsSATB::drainFilledBarrierPackets(MM_EnvironmentBase *env)
+{
+	bool drained = false;
+
+	if (!_filledBarrierPacketList.isEmpty() && (0 == MM_AtomicOperations::lockCompareExchange(&_filledBarrierPacketsDraining, 0, 1))) {
+		MM_Packet *head = NULL;
+		MM_Packet *tail = NULL;
+		uintptr_t count = 0;
+
+		/* take the whole queue at once, so the full packet list is locked once per batch rather than once per packet */
+		if (_filledBarrierPacketList.popList(&head, &tail, &count)) {
+			_fullPacketList.pushList(head, tail, count);
+			drained = true;
+		}
+		MM_AtomicOperations::set(&_filledBarrierPacketsDraining, 0);
+
+		if (drained && (_inputListWaitCount > 0)) {
+			notifyWaitingThreads(env);
+		}
+	}
+
+	return drained;
 }
 
 /**
@@ -180,6 +215,9 @@ MM_WorkPacketsSATB::moveInUseToNonEmpty(MM_EnvironmentBase *env)
 	UDATA count;
 	bool didPop;
 
+	/* the filled packets are not in use anymore, but must be traced along with them */
+	drainFilledBarrierPackets(env);
+
 	/* pop the inUseList */
 	didPop = _inUseBarrierPacketList.popList(&head, &tail, &count);
 	/* push the values from the inUseList onto the processingList */
@@ -210,6 +248,13 @@ MM_WorkPacketsSATB::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 {
 	MM_Packet *overflowPacket;
 
+	/* Filled barrier packets reach the full packet list only when drained, so pick them up whenever the input lists run dry */
+	if (drainFilledBarrierPackets(env)) {
+		if (NULL != (overflowPacket = getPacket(env, &_fullPacketList))) {
+			return overflowPacket;
+		}
+	}
+
 	/* SATB spec cannot loop here as all packets may currently be on
 	 * the InUseBarrierList.  If all packets are on the InUseBarrierList then this
 	 * would turn into an infinite busy loop.
@@ -35,6 +35,8 @@ class MM_WorkPacketsSATB : public MM_WorkPackets
 {
 protected:
 	MM_PacketList _inUseBarrierPacketList;  /**< List for packets currently being used for the remembered set*/
+	MM_PacketList _filledBarrierPacketList; /**< Packets filled by the barrier, pushed without locks by mutators and drained into the full packet list by one thread at a time */
+	volatile uintptr_t _filledBarrierPacketsDraining; /**< Non-zero while a thread drains _filledBarrierPacketList */
 
 public:
 	static MM_WorkPacketsSATB *newInstance(MM_EnvironmentBase *env);
@@ -54,14 +56,26 @@ public:
 
 	void moveInUseToNonEmpty(MM_EnvironmentBase *env);
 
+	/**
+	 * Move the packets filled by the barrier to the full packet list, where marking threads pick them up.
+	 * Returns immediately if another thread is already draining them.
+	 *
+	 * @return true if any packet was moved
+	 */
+	bool drainFilledBarrierPackets(MM_EnvironmentBase *env);
+
 	/**
 	 * Create a MM_WorkPacketsRealtime object.
 	 */
 	MM_WorkPacketsSATB(MM_EnvironmentBase *env) :
 		MM_WorkPackets(env)
 		, _inUseBarrierPacketList(NULL)
+		, _filledBarrierPacketList(NULL)
+		, _filledBarrierPacketsDraining(0)
 	{
 		_typeId = __FUNCTION__;
+		/* filled barrier packets are input, so marking threads look for work while they are queued */
+		_queuedInputPacketList = &_filledBarrierPacketList;
 	};
 
 protected:
@@ -42,6 +42,43 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/**
+ * Called on a GC thread for every live object of a parallel heap walk.
+ * @param omrVMThread the GC thread walking the object
+ * @param object a live object
+ * @param threadData the zero initialized accumulator private to the walking thread
+ * @param userData the userData passed to OMR_GC_WalkHeapParallel
+ */
+typedef void (*OMR_GC_HeapWalkObjectFunction)(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *threadData, void *userData);
+
+/**
+ * Called on the requesting thread, once per GC thread (up to the maximum GC thread count) after a parallel heap walk,
+ * to merge its accumulator. The accumulators of GC threads which took no part in the walk are still zero.
+ * @param omrVMThread the thread which requested the walk
+ * @param threadData the accumulator of one GC thread
+ * @param userData the userData passed to OMR_GC_WalkHeapParallel
+ */
+typedef void (*OMR_GC_HeapWalkMergeFunction)(OMR_VMThread *omrVMThread, void *threadData, void *userData);
+
+/**
+ * Walk the live objects of the heap on the GC threads, for heap analysis tools.
+ *
+ * The walk runs under exclusive VM access, after a mark of the heap which identifies the live objects. The
+ * heap regions are split into chunks which the GC threads claim in turn, and every thread counts into its own
+ * accumulator, so the object function needs no synchronization. The accumulators are merged on the calling
+ * thread once all GC threads are done. The callbacks must not allocate objects or acquire VM access.
+ *
+ * @param omrVMThread the calling thread
+ * @param threadDataSize the size in bytes of the per-thread accumulator, may be 0
+ * @param objectFunction the function to call for every live object
+ * @param mergeFunction the function to call for every accumulator, may be NULL
+ * @param userData data passed through to the callbacks
+ * @return OMR_ERROR_NONE if the heap was walked, OMR_ERROR_ILLEGAL_ARGUMENT if objectFunction is NULL,
+ * OMR_ERROR_OUT_OF_NATIVE_MEMORY if the accumulators could not be allocated, or OMR_ERROR_NOT_AVAILABLE
+ * if the configured collector does not support parallel heap walks
+ */
+omr_error_t OMR_GC_WalkHeapParallel(OMR_VMThread *omrVMThread, uintptr_t threadDataSize, OMR_GC_HeapWalkObjectFunction objectFunction, OMR_GC_HeapWalkMergeFunction mergeFunction, void *userData);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrcfg.h"
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMap.hpp"
+#include "Math.hpp"
+#include "ModronAssertions.h"
+#include "omrgcstartup.hpp"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "ParallelDispatcher.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#include "ParallelTask.hpp"
+#endif /* OMR_GC_MODRON_STANDARD */
+
+#if defined(OMR_GC_MODRON_STANDARD)
+/* Bounds of the heap chunks handed out as work units, so small heaps still spread over all threads and
+ * very large heaps are not split into more units than needed to balance them */
+#define HEAPWALK_MINIMUM_CHUNK_SIZE ((uintptr_t)64 * 1024)
+#define HEAPWALK_MAXIMUM_CHUNK_SIZE ((uintptr_t)4 * 1024 * 1024)
+/* Alignment of the per thread accumulators, so those of different threads do not share cache lines */
+#define HEAPWALK_THREAD_DATA_ALIGNMENT ((uintptr_t)128)
+
+/**
+ * Per thread state of a parallel heap walk.
+ */
+struct HeapWalkThreadContext {
+	OMR_GC_HeapWalkObjectFunction objectFunction;
+	void *threadData;
+	void *userData;
+};
+
+static void
+heapWalkObjectDo(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkThreadContext *context = (HeapWalkThreadContext *)userData;
+	context->objectFunction(omrVMThread, object, context->threadData, context->userData);
+}
+
+/**
+ * Walk the marked objects of the heap, with an accumulator per GC thread.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelHeapWalkTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_ParallelHeapWalker *_heapWalker;
+	OMR_GC_HeapWalkObjectFunction _objectFunction;
+	void *_userData;
+	uint8_t *_threadData; /**< threadCountMaximum accumulators, indexed by worker ID */
+	uintptr_t _threadDataStride;
+	uintptr_t _chunkSize;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void
+	run(MM_EnvironmentBase *env)
+	{
+		HeapWalkThreadContext context;
+		context.objectFunction = _objectFunction;
+		context.threadData = (NULL == _threadData) ? NULL : (_threadData + (env->getWorkerID() * _threadDataStride));
+		context.userData = _userData;
+		_heapWalker->markedObjectsDoParallel(env, heapWalkObjectDo, &context, _chunkSize);
+	}
+
+	MM_ParallelHeapWalkTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, OMR_GC_HeapWalkObjectFunction objectFunction, void *userData, uint8_t *threadData, uintptr_t threadDataStride, uintptr_t chunkSize)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _heapWalker(heapWalker)
+		, _objectFunction(objectFunction)
+		, _userData(userData)
+		, _threadData(threadData)
+		, _threadDataStride(threadDataStride)
+		, _chunkSize(chunkSize)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+#endif /* OMR_GC_MODRON_STANDARD */
+
+omr_error_t
+OMR_GC_WalkHeapParallel(OMR_VMThread *omrVMThread, uintptr_t threadDataSize, OMR_GC_HeapWalkObjectFunction objectFunction, OMR_GC_HeapWalkMergeFunction mergeFunction, void *userData)
+{
+	if (NULL == objectFunction) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+#if defined(OMR_GC_MODRON_STANDARD)
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (!extensions->isStandardGC()) {
+		return OMR_ERROR_NOT_AVAILABLE;
+	}
+	if (NULL == extensions->getGlobalCollector()) {
+		result = OMR_GC_InitializeCollector(omrVMThread);
+		if (OMR_ERROR_NONE != result) {
+			return result;
+		}
+	}
+
+	MM_ParallelDispatcher *dispatcher = extensions->dispatcher;
+	uintptr_t threadCountMaximum = dispatcher->threadCountMaximum();
+	uintptr_t threadDataStride = MM_Math::roundToCeiling(HEAPWALK_THREAD_DATA_ALIGNMENT, threadDataSize);
+	uint8_t *threadData = NULL;
+	if (0 != threadDataSize) {
+		threadData = (uint8_t *)env->getForge()->allocate(threadDataStride * threadCountMaximum, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == threadData) {
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		memset(threadData, 0, threadDataStride * threadCountMaximum);
+	}
+
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+	MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)globalCollector->getHeapWalker();
+
+	env->acquireExclusiveVMAccessForGC(globalCollector);
+
+	/* identify the live objects, so the walk can start anywhere in the heap rather than parse it from the bottom */
+	globalCollector->prepareHeapForWalk(env);
+
+	uintptr_t chunkSize = extensions->heap->getMemorySize() / (threadCountMaximum * 32);
+	chunkSize = OMR_MIN(OMR_MAX(chunkSize, HEAPWALK_MINIMUM_CHUNK_SIZE), HEAPWALK_MAXIMUM_CHUNK_SIZE);
+	chunkSize = MM_Math::roundToCeiling(J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT, chunkSize);
+
+	MM_ParallelHeapWalkTask heapWalkTask(env, heapWalker, objectFunction, userData, threadData, threadDataStride, chunkSize);
+	dispatcher->run(env, &heapWalkTask);
+
+	env->releaseExclusiveVMAccessForGC();
+
+	if (NULL != threadData) {
+		if (NULL != mergeFunction) {
+			/* the worker IDs of the threads which ran the task need not be the lowest ones, so merge every (zero initialized) slot */
+			for (uintptr_t workerID = 0; workerID < threadCountMaximum; workerID++) {
+				mergeFunction(omrVMThread, threadData + (workerID * threadDataStride), userData);
+			}
+		}
+		env->getForge()->free(threadData);
+	}
+
+	return result;
+#else /* OMR_GC_MODRON_STANDARD */
+	return OMR_ERROR_NOT_AVAILABLE;
+#endif /* OMR_GC_MODRON_STANDARD */
+}
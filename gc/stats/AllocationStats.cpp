@@ -35,6 +35,11 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhRefreshCountBatched = 0;
+	_tlhAllocatedBatched = 0;
+	for (uintptr_t bucket = 0; bucket < OMR_TLH_REFRESH_LATENCY_BUCKETS; bucket++) {
+		_tlhRefreshLatency[bucket] = 0;
+	}
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -59,6 +64,13 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhRefreshCountBatched, stats->_tlhRefreshCountBatched);
+	MM_AtomicOperations::add(&_tlhAllocatedBatched, stats->_tlhAllocatedBatched);
+	for (uintptr_t bucket = 0; bucket < OMR_TLH_REFRESH_LATENCY_BUCKETS; bucket++) {
+		if (0 != stats->_tlhRefreshLatency[bucket]) {
+			MM_AtomicOperations::add(&_tlhRefreshLatency[bucket], stats->_tlhRefreshLatency[bucket]);
+		}
+	}
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
@@ -86,3 +98,33 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 			&_allocationSearchCountMax, prevMax, stats->_allocationSearchCountMax);
 	}
 }
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+/**
+ * Estimate a percentile of the recorded TLH refresh latencies.
+ * @param percent[in] the percentile, 1 to 100
+ * @return the upper bound, in hires ticks, of the histogram bucket holding the percentile (0 if nothing was recorded)
+ */
+uint64_t
+MM_AllocationStats::tlhRefreshLatencyPercentile(uintptr_t percent)
+{
+	uint64_t total = 0;
+	for (uintptr_t bucket = 0; bucket < OMR_TLH_REFRESH_LATENCY_BUCKETS; bucket++) {
+		total += _tlhRefreshLatency[bucket];
+	}
+
+	uint64_t result = 0;
+	if (0 != total) {
+		uint64_t rank = ((total * percent) + 99) / 100;
+		uint64_t count = 0;
+		for (uintptr_t bucket = 0; bucket < OMR_TLH_REFRESH_LATENCY_BUCKETS; bucket++) {
+			count += _tlhRefreshLatency[bucket];
+			if (count >= rank) {
+				result = (uint64_t)1 << bucket;
+				break;
+			}
+		}
+	}
+	return result;
+}
+#endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
@@ -28,6 +28,11 @@
 
 #include "Base.hpp"
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+/* Number of log2 buckets of the TLH refresh latency histogram */
+#define OMR_TLH_REFRESH_LATENCY_BUCKETS 32
+#endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
+
 class MM_AllocationStats : public MM_Base
 {
 private:
@@ -42,6 +47,9 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhRefreshCountBatched; 	/**< Number of refreshes served from chunks carved by an earlier fresh refresh. */
+	uintptr_t _tlhAllocatedBatched; 	/**< The amount of memory allocated from carved chunks. */
+	uintptr_t _tlhRefreshLatency[OMR_TLH_REFRESH_LATENCY_BUCKETS]; /**< Refresh latency histogram, bucket i counts refreshes which took less than 2^i hires ticks (and at least 2^(i-1)). */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -59,9 +67,26 @@ public:
 	void merge(MM_AllocationStats * stats);
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
-	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh - _tlhDiscardedBytes; }
+	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh + _tlhAllocatedBatched - _tlhDiscardedBytes; }
 	uintptr_t tlhBytesAllocatedUsed() { return _tlhAllocatedUsed; }
 	uintptr_t nontlhBytesAllocated() { return _allocationBytes; }
+
+	/**
+	 * Record the latency of one TLH refresh.
+	 * @param ticks[in] hires clock ticks the refresh took
+	 */
+	void
+	recordTLHRefreshLatency(uint64_t ticks)
+	{
+		uintptr_t bucket = 0;
+		while ((0 != ticks) && (bucket < (OMR_TLH_REFRESH_LATENCY_BUCKETS - 1))) {
+			ticks >>= 1;
+			bucket += 1;
+		}
+		_tlhRefreshLatency[bucket] += 1;
+	}
+
+	uint64_t tlhRefreshLatencyPercentile(uintptr_t percent);
 #endif
 
 	/* return bytesAllocated includes new refreshed TLH, if includeJustRefreshedTLH == true(default)
@@ -94,6 +119,8 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhRefreshCountBatched(0),
+		_tlhAllocatedBatched(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
@@ -103,7 +130,13 @@ public:
 		_discardedBytes(0),
 		_allocationSearchCount(0),
 		_allocationSearchCountMax(0)
-	{}
+	{
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		for (uintptr_t bucket = 0; bucket < OMR_TLH_REFRESH_LATENCY_BUCKETS; bucket++) {
+			_tlhRefreshLatency[bucket] = 0;
+		}
+#endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
+	}
 };
 
 #endif /* ALLOCATIONSTATS_HPP_ */
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ClassHistogram.hpp"
+
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+MM_ClassHistogram *
+MM_ClassHistogram::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ClassHistogram *histogram = (MM_ClassHistogram *)env->getForge()->allocate(sizeof(MM_ClassHistogram), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != histogram) {
+		new(histogram) MM_ClassHistogram();
+	}
+	return histogram;
+}
+
+void
+MM_ClassHistogram::kill(MM_EnvironmentBase *env)
+{
+	env->getForge()->free(this);
+}
+
+void
+MM_ClassHistogram::clear()
+{
+	/* most histograms are empty, or describe few classes */
+	if (0 != _classCount) {
+		for (uintptr_t i = 0; i < CLASSHISTOGRAM_CLASSES; i++) {
+			_entries[i].classKey = 0;
+			_entries[i].objects = 0;
+			_entries[i].bytes = 0;
+		}
+	}
+	_classCount = 0;
+	_objects = 0;
+	_bytes = 0;
+	_otherObjects = 0;
+	_otherBytes = 0;
+}
+
+void
+MM_ClassHistogram::drain(MM_ClassHistogram *histogram)
+{
+	if (0 != histogram->_classCount) {
+		for (uintptr_t i = 0; i < CLASSHISTOGRAM_CLASSES; i++) {
+			Entry *entry = &histogram->_entries[i];
+			if (0 != entry->classKey) {
+				add(entry->classKey, entry->objects, entry->bytes);
+			}
+		}
+	}
+	_objects += histogram->_otherObjects;
+	_bytes += histogram->_otherBytes;
+	_otherObjects += histogram->_otherObjects;
+	_otherBytes += histogram->_otherBytes;
+	histogram->clear();
+}
+
+uintptr_t
+MM_ClassHistogram::getTopClasses(Entry *top, uintptr_t count)
+{
+	uintptr_t found = 0;
+	/* insertion sort of the few largest classes */
+	for (uintptr_t i = 0; i < CLASSHISTOGRAM_CLASSES; i++) {
+		Entry *entry = &_entries[i];
+		if (0 != entry->classKey) {
+			uintptr_t position = found;
+			while ((0 < position) && (top[position - 1].bytes < entry->bytes)) {
+				if (position < count) {
+					top[position] = top[position - 1];
+				}
+				position -= 1;
+			}
+			if (position < count) {
+				top[position] = *entry;
+				if (found < count) {
+					found += 1;
+				}
+			}
+		}
+	}
+	return found;
+}
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(CLASSHISTOGRAM_HPP_)
+#define CLASSHISTOGRAM_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+
+#include "Base.hpp"
+
+/* Number of classes a histogram can describe (a power of two) */
+#define CLASSHISTOGRAM_CLASSES 256
+/* Number of entries probed for a class before its objects are counted as other objects */
+#define CLASSHISTOGRAM_MAX_PROBES 8
+
+class MM_EnvironmentBase;
+
+/**
+ * Census of live objects by class, taken while marking.
+ *
+ * Every marking thread counts the objects it marks into a private histogram, without synchronization.
+ * The private histograms are merged into the global one once marking completes. Classes are identified
+ * by the key the marking delegate gives their objects; the objects of classes which do not fit in the
+ * table are still counted, as other objects.
+ * @ingroup GC_Stats
+ */
+class MM_ClassHistogram : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+public:
+	struct Entry {
+		uintptr_t classKey; /**< key of the described class, or 0 if the entry is free */
+		uintptr_t objects; /**< live objects of the class */
+		uintptr_t bytes; /**< bytes consumed by the live objects of the class */
+	};
+
+private:
+	Entry _entries[CLASSHISTOGRAM_CLASSES];
+	uintptr_t _classCount; /**< entries in use */
+	uintptr_t _objects; /**< live objects counted, in all classes */
+	uintptr_t _bytes; /**< bytes consumed by the live objects counted */
+	uintptr_t _otherObjects; /**< live objects of classes without an entry */
+	uintptr_t _otherBytes; /**< bytes consumed by the live objects of classes without an entry */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE static uintptr_t
+	hash(uintptr_t classKey)
+	{
+		/* class keys are often pointers or sizes, so mix the low bits with the high ones */
+		uintptr_t value = classKey ^ (classKey >> 17) ^ (classKey >> 7);
+		return value & (CLASSHISTOGRAM_CLASSES - 1);
+	}
+
+protected:
+public:
+	static MM_ClassHistogram *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	void clear();
+
+	/**
+	 * Count live objects of a class.
+	 * @param classKey[in] the class key of the objects, as given by the marking delegate
+	 * @param objects[in] number of objects
+	 * @param bytes[in] bytes consumed by the objects
+	 */
+	MMINLINE void
+	add(uintptr_t classKey, uintptr_t objects, uintptr_t bytes)
+	{
+		_objects += objects;
+		_bytes += bytes;
+		if (0 != classKey) {
+			uintptr_t index = hash(classKey);
+			for (uintptr_t probe = 0; probe < CLASSHISTOGRAM_MAX_PROBES; probe++) {
+				Entry *entry = &_entries[(index + probe) & (CLASSHISTOGRAM_CLASSES - 1)];
+				if (classKey == entry->classKey) {
+					entry->objects += objects;
+					entry->bytes += bytes;
+					return;
+				}
+				if (0 == entry->classKey) {
+					entry->classKey = classKey;
+					entry->objects = objects;
+					entry->bytes = bytes;
+					_classCount += 1;
+					return;
+				}
+			}
+		}
+		_otherObjects += objects;
+		_otherBytes += bytes;
+	}
+
+	/**
+	 * Add the counts of another histogram into the receiver, and clear them.
+	 * @param histogram[in] the histogram to drain
+	 */
+	void drain(MM_ClassHistogram *histogram);
+
+	/**
+	 * Copy the entries of the classes with the most live bytes, in decreasing order of bytes.
+	 * @param top[out] array of at least count entries
+	 * @param count[in] maximum number of entries to copy
+	 * @return the number of entries copied
+	 */
+	uintptr_t getTopClasses(Entry *top, uintptr_t count);
+
+	MMINLINE uintptr_t getClassCount() { return _classCount; }
+	MMINLINE uintptr_t getObjects() { return _objects; }
+	MMINLINE uintptr_t getBytes() { return _bytes; }
+	MMINLINE uintptr_t getOtherObjects() { return _otherObjects; }
+	MMINLINE uintptr_t getOtherBytes() { return _otherBytes; }
+
+	MM_ClassHistogram()
+		: MM_Base()
+		, _classCount(0)
+		, _objects(0)
+		, _bytes(0)
+		, _otherObjects(0)
+		, _otherBytes(0)
+	{
+		for (uintptr_t i = 0; i < CLASSHISTOGRAM_CLASSES; i++) {
+			_entries[i].classKey = 0;
+			_entries[i].objects = 0;
+			_entries[i].bytes = 0;
+		}
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+
+#endif /* CLASSHISTOGRAM_HPP_ */
@@ -50,6 +50,8 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _liveBytes; /**< bytes of the objects left in the compacted regions */
+	bool _sliding; /**< true if the compaction slid regions rather than evacuating sub areas */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
@@ -68,6 +70,21 @@ public:
 	void clear();
 	void merge(MM_CompactStats *statsToMerge);
 
+	/**
+	 * Normalize the duration of a compaction by the live data it processed, so compactions of
+	 * differently sized heaps can be compared.
+	 * @param duration[in] the compaction time in microseconds
+	 * @return the compaction time in microseconds per GB of live data, 0 if nothing was live
+	 */
+	MMINLINE uint64_t
+	getMicrosecondsPerLiveGB(uint64_t duration)
+	{
+		if (0 == _liveBytes) {
+			return 0;
+		}
+		return (uint64_t)(((double)duration * (double)((uint64_t)1 << 30)) / (double)_liveBytes);
+	}
+
 	MM_CompactStats() :
 		MM_Base()
 		,_lastHeapCompaction(0)
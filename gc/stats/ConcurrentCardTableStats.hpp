@@ -49,6 +49,9 @@ public:
 	volatile uintptr_t finalCleanedCardsPhase2;
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
+
+	volatile uintptr_t concurrentScannedCards; /**< cards read while looking for dirty cards during concurrent card cleaning */
+	volatile uintptr_t finalScannedCards; /**< cards read while looking for dirty cards during final card cleaning */
 	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
@@ -75,6 +78,10 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+
+		/* Card scanning counts */
+		setCount(concurrentScannedCards, 0);
+		setCount(finalScannedCards, 0);
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -119,6 +126,18 @@ public:
 		incrementCount(finalCleanedCardsPhase2, numCards);	
 	};
 	
+	MMINLINE uintptr_t getConcurrentScannedCards() { return concurrentScannedCards; };
+	MMINLINE void incConcurrentScannedCards(uintptr_t numCards)
+	{
+		incrementCount(concurrentScannedCards, numCards);
+	};
+
+	MMINLINE uintptr_t getFinalScannedCards() { return finalScannedCards; };
+	MMINLINE void incFinalScannedCards(uintptr_t numCards)
+	{
+		incrementCount(finalScannedCards, numCards);
+	};
+	
 	/**
 	 * Create a CardTableStats object.
 	 */   
@@ -129,7 +148,9 @@ public:
 		finalCleanedCardsPhase1(0),
 		concurrentCleanedCardsPhase2(0),
 		finalCleanedCardsPhase2(0),
-		concurrentCleanedCardsPhase3(0)
+		concurrentCleanedCardsPhase3(0),
+		concurrentScannedCards(0),
+		finalScannedCards(0)
 	{};
 };
 
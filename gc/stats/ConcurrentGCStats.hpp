@@ -67,6 +67,7 @@ class MM_ConcurrentGCStats : public MM_Base
 	volatile uintptr_t _RSObjectsFound;
 	volatile uintptr_t _threadsScannedCount;
 	uintptr_t _threadsToScanCount;
+	volatile uintptr_t _pacingFallbackCount; /**< allocations taxed because the concurrent helpers fell behind the pacing schedule */
 	
 	bool _concurrentWorkStackOverflowOcurred;
 	uintptr_t _concurrentWorkStackOverflowCount;
@@ -201,6 +202,8 @@ public:
 	MMINLINE uintptr_t getThreadsToScanCount() { return _threadsToScanCount; };
 	MMINLINE void incThreadsScannedCount() { incrementCount((uintptr_t*)&_threadsScannedCount, 1); };
 	MMINLINE uintptr_t getThreadsScannedCount() { return _threadsScannedCount; };
+	MMINLINE void incPacingFallbackCount() { incrementCount((uintptr_t *)&_pacingFallbackCount, 1); };
+	MMINLINE uintptr_t getPacingFallbackCount() { return _pacingFallbackCount; };
 	
 	MMINLINE bool isRootTracingComplete() { return (_completedModes & CONCURRENT_ROOT_TRACING) == CONCURRENT_ROOT_TRACING; };
 	MMINLINE void setModeComplete(ConcurrentStatus mode) {
@@ -227,6 +230,7 @@ public:
 		clearCount((uintptr_t *)&_RSObjectsFound);
 		clearCount((uintptr_t *)&_threadsScannedCount);
 		clearCount(&_threadsToScanCount);
+		clearCount((uintptr_t *)&_pacingFallbackCount);
 		_completedModes = 0;
 		_cardCleaningReason = CARD_CLEANING_REASON_NONE;
 	};
@@ -260,6 +264,7 @@ public:
 		_RSObjectsFound(0),
 		_threadsScannedCount(0),
 		_threadsToScanCount(0),
+		_pacingFallbackCount(0),
 		_concurrentWorkStackOverflowOcurred(false),
 		_concurrentWorkStackOverflowCount(0),
 		_completedModes(0),
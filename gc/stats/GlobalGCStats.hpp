@@ -26,6 +26,7 @@
 #include "omrcomp.h"
 #include "modronbase.h"
 
+#include "ClassHistogram.hpp"
 #include "ClassUnloadStats.hpp"
 #if defined(OMR_GC_MODRON_COMPACTION)
 #include "CompactStats.hpp"
@@ -33,6 +34,7 @@
 #include "MarkStats.hpp"
 #include "MetronomeStats.hpp"
 #include "SweepStats.hpp"
+#include "TaskDispatchStats.hpp"
 #include "WorkPacketStats.hpp"
 
 /**
@@ -52,11 +54,16 @@ public:
 	uint64_t fixHeapForWalkTime;
 
 	MM_MarkStats markStats;
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	MM_ClassHistogram classHistogram; /**< live objects found by the last mark, by class (markingClassHistogram only) */
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
 	MM_ClassUnloadStats classUnloadStats;
 	MM_MetronomeStats metronomeStats; /**< Stats collected during one GC increment (quantum) */
 
 	uintptr_t finalizableCount; /**< count of objects pushed for finalization during one GC cycle */
 
+	MM_TaskDispatchStats taskDispatchStats; /**< start latency of the parallel tasks dispatched during one GC cycle */
+
 	MMINLINE void clear()
 	{
 		/* gcCount is not cleared as the value must persist across cycles */
@@ -71,10 +78,15 @@ public:
 		fixHeapForWalkTime = 0;
 
 		markStats.clear();
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+		classHistogram.clear();
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
 		classUnloadStats.clear();
 		metronomeStats.clearStart();
 
 		finalizableCount = 0;
+
+		taskDispatchStats.clear();
 	};
 
 	/**
@@ -97,9 +109,13 @@ public:
 		, fixHeapForWalkReason(FIXUP_NONE)
 		, fixHeapForWalkTime(0)
 		, markStats()
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+		, classHistogram()
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
 		, classUnloadStats()
 		, metronomeStats()
-		, finalizableCount(0) {};
+		, finalizableCount(0)
+		, taskDispatchStats() {};
 };
 
 #endif /* GLOBALGCSTATS_HPP_ */
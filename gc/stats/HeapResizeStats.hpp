@@ -62,6 +62,13 @@ private:
 
 	uint64_t				_lastExpandTime; /**< time in hi-res ticks of the last expansion */
 	uint64_t				_lastContractTime; /**< time in hi-res ticks of the last expansion */
+	uint64_t				_lastPretouchTime; /**< time in hi-res ticks spent pre-touching the memory added by the last expansion */
+	uintptr_t				_lastPretouchBytes; /**< bytes pre-touched by the last expansion */
+	uint64_t				_totalPretouchTime; /**< time in hi-res ticks spent pre-touching since startup */
+	uintptr_t				_lastReleasedBytes; /**< free heap bytes returned to the operating system by the last idle collection */
+	uintptr_t				_totalReleasedBytes; /**< free heap bytes returned to the operating system by idle collections since startup */
+	uintptr_t				_lastLazilyFreedBytes; /**< free heap bytes released lazily (still resident until memory pressure) by the last idle collection */
+	uintptr_t				_totalLazilyFreedBytes; /**< free heap bytes released lazily by idle collections since startup */
 	uint32_t				_lastGCPercentage;
 	
 	uint64_t				_lastTimeOutsideGC;
@@ -138,6 +145,37 @@ public:
 	MMINLINE uint64_t getLastExpandTime() { return _lastExpandTime; }
 	MMINLINE void setLastContractTime(uint64_t ticks) { _lastContractTime = ticks; }
 	MMINLINE uint64_t getLastContractTime() { return _lastContractTime; }
+
+	MMINLINE void resetLastPretouch()
+	{
+		_lastPretouchTime = 0;
+		_lastPretouchBytes = 0;
+	}
+	MMINLINE void addPretouch(uint64_t ticks, uintptr_t bytes)
+	{
+		_lastPretouchTime += ticks;
+		_lastPretouchBytes += bytes;
+		_totalPretouchTime += ticks;
+	}
+	MMINLINE uint64_t getLastPretouchTime() { return _lastPretouchTime; }
+	MMINLINE uintptr_t getLastPretouchBytes() { return _lastPretouchBytes; }
+	MMINLINE uint64_t getTotalPretouchTime() { return _totalPretouchTime; }
+
+	MMINLINE void setLastReleasedBytes(uintptr_t bytes)
+	{
+		_lastReleasedBytes = bytes;
+		_totalReleasedBytes += bytes;
+	}
+	MMINLINE uintptr_t getLastReleasedBytes() { return _lastReleasedBytes; }
+	MMINLINE uintptr_t getTotalReleasedBytes() { return _totalReleasedBytes; }
+
+	MMINLINE void setLastLazilyFreedBytes(uintptr_t bytes)
+	{
+		_lastLazilyFreedBytes = bytes;
+		_totalLazilyFreedBytes += bytes;
+	}
+	MMINLINE uintptr_t getLastLazilyFreedBytes() { return _lastLazilyFreedBytes; }
+	MMINLINE uintptr_t getTotalLazilyFreedBytes() { return _totalLazilyFreedBytes; }
 	
 	MMINLINE void	setLastTimeOutsideGC()			{
 		/* CMVC 125876:  Note that time can go backward (core-swap, for example) so store a 1 as the delta if this
@@ -188,6 +226,13 @@ public:
 		_lastLoaResizeReason(NO_LOA_RESIZE),
 		_lastExpandTime(0),
 		_lastContractTime(0),
+		_lastPretouchTime(0),
+		_lastPretouchBytes(0),
+		_totalPretouchTime(0),
+		_lastReleasedBytes(0),
+		_totalReleasedBytes(0),
+		_lastLazilyFreedBytes(0),
+		_totalLazilyFreedBytes(0),
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
 		_globalGCCountAtAF(0)
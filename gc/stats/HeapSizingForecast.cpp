@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "HeapSizingForecast.hpp"
+
+void
+MM_HeapSizingForecast::smooth(double *level, double *trend, double sample, uintptr_t previousSamples)
+{
+	if (0 == previousSamples) {
+		*level = sample;
+		*trend = 0.0;
+	} else {
+		double previousLevel = *level;
+		*level = (HEAP_SIZING_FORECAST_LEVEL_WEIGHT * sample) + ((1.0 - HEAP_SIZING_FORECAST_LEVEL_WEIGHT) * (previousLevel + *trend));
+		*trend = (HEAP_SIZING_FORECAST_TREND_WEIGHT * (*level - previousLevel)) + ((1.0 - HEAP_SIZING_FORECAST_TREND_WEIGHT) * *trend);
+	}
+}
+
+void
+MM_HeapSizingForecast::recordCollectionStart(uint64_t time, uintptr_t usedBytes)
+{
+	/* time can go backward (core-swap, for example), so only sample sane intervals */
+	if ((0 != _lastCollectionEndTime) && (time > _lastCollectionEndTime)) {
+		/* measured as growth of the bytes in use, so that heap resizing in between does not count as allocation */
+		uintptr_t consumedBytes = 0;
+		if (usedBytes > _usedBytesAtLastCollectionEnd) {
+			consumedBytes = usedBytes - _usedBytesAtLastCollectionEnd;
+		}
+		double rate = (double)consumedBytes / (double)(time - _lastCollectionEndTime);
+		smooth(&_allocationRate, &_allocationRateTrend, rate, _rateSamples);
+		_rateSamples += 1;
+	}
+	_collectionStartTime = time;
+}
+
+void
+MM_HeapSizingForecast::recordCollectionEnd(uint64_t time, uintptr_t usedBytes)
+{
+	uint64_t collectionTicks = 1;
+	if (time > _collectionStartTime) {
+		collectionTicks = time - _collectionStartTime;
+	}
+
+	if (0 == _liveSamples) {
+		_collectionTicks = (double)collectionTicks;
+	} else {
+		_collectionTicks = (HEAP_SIZING_FORECAST_LEVEL_WEIGHT * (double)collectionTicks) + ((1.0 - HEAP_SIZING_FORECAST_LEVEL_WEIGHT) * _collectionTicks);
+	}
+	smooth(&_liveBytes, &_liveBytesTrend, (double)usedBytes, _liveSamples);
+	_liveSamples += 1;
+
+	_usedBytesAtLastCollectionEnd = usedBytes;
+	_lastCollectionEndTime = time;
+}
+
+uintptr_t
+MM_HeapSizingForecast::calculateTargetSize(uintptr_t liveBytes, uintptr_t gcOverheadPercent)
+{
+	/* the live set cannot be below what this collection just found, but a growing one is anticipated */
+	double forecastLiveBytes = (double)liveBytes + OMR_MAX(_liveBytesTrend, 0.0);
+
+	/* to spend gcOverheadPercent of the time collecting, each collection must be followed by
+	 * (100 - gcOverheadPercent) / gcOverheadPercent times its duration of allocation
+	 */
+	uintptr_t overheadPercent = OMR_MIN(OMR_MAX(gcOverheadPercent, (uintptr_t)1), (uintptr_t)99);
+	double mutatorTicks = (_collectionTicks * (double)(100 - overheadPercent)) / (double)overheadPercent;
+	double forecastFreeBytes = getAllocationRate() * mutatorTicks;
+
+	double targetSize = forecastLiveBytes + forecastFreeBytes;
+	if (targetSize >= (double)UDATA_MAX) {
+		_lastTargetSize = UDATA_MAX;
+	} else {
+		_lastTargetSize = (uintptr_t)targetSize;
+	}
+	return _lastTargetSize;
+}
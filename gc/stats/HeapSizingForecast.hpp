@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(HEAPSIZINGFORECAST_HPP_)
+#define HEAPSIZINGFORECAST_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+/* Smoothing weights of the forecast level and trend; higher values follow new samples faster */
+#define HEAP_SIZING_FORECAST_LEVEL_WEIGHT	0.5
+#define HEAP_SIZING_FORECAST_TREND_WEIGHT	0.3
+/* Number of allocation rate samples required before the forecast is used to size the heap */
+#define HEAP_SIZING_FORECAST_MINIMUM_SAMPLES	3
+
+/**
+ * Forecast of the old space allocation rate, live set and global collection time, used to size the
+ * heap for a target percentage of time spent in global collections.
+ *
+ * The allocation rate and the live set are smoothed with their trend (double exponential smoothing),
+ * so that a steadily growing or shrinking workload is anticipated rather than reacted to, while a
+ * single unusual collection barely moves the forecast.
+ * @ingroup GC_Stats
+ */
+class MM_HeapSizingForecast : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	double _allocationRate; /**< smoothed old space bytes consumed per hi-res tick outside global collections */
+	double _allocationRateTrend; /**< smoothed change of the allocation rate from one collection to the next */
+	double _liveBytes; /**< smoothed old space bytes in use at the end of a global collection */
+	double _liveBytesTrend; /**< smoothed change of the live bytes from one collection to the next */
+	double _collectionTicks; /**< smoothed duration of a global collection in hi-res ticks */
+	uintptr_t _rateSamples; /**< number of allocation rate samples taken */
+	uintptr_t _liveSamples; /**< number of live set and collection time samples taken */
+	uint64_t _collectionStartTime; /**< start of the global collection in progress */
+	uint64_t _lastCollectionEndTime; /**< end of the previous global collection, 0 before the first one */
+	uintptr_t _usedBytesAtLastCollectionEnd; /**< old space bytes in use at the end of the previous global collection */
+	uintptr_t _lastTargetSize; /**< heap size recommended by the most recent forecast */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	static void smooth(double *level, double *trend, double sample, uintptr_t previousSamples);
+
+protected:
+public:
+	/**
+	 * Take an allocation rate sample at the start of a global collection.
+	 * @param time[in] hi-res time the collection started
+	 * @param usedBytes[in] old space bytes in use before the collection
+	 */
+	void recordCollectionStart(uint64_t time, uintptr_t usedBytes);
+
+	/**
+	 * Take live set and collection time samples at the end of a global collection.
+	 * @param time[in] hi-res time the collection ended
+	 * @param usedBytes[in] old space bytes in use after the collection
+	 */
+	void recordCollectionEnd(uint64_t time, uintptr_t usedBytes);
+
+	/**
+	 * Calculate the heap size which, at the forecast allocation rate and collection time, would let
+	 * global collections take gcOverheadPercent of the time.
+	 * @param liveBytes[in] bytes in use following the current collection, including any pending allocation
+	 * @param gcOverheadPercent[in] target percentage of time spent in global collections
+	 * @return the recommended heap size in bytes
+	 */
+	uintptr_t calculateTargetSize(uintptr_t liveBytes, uintptr_t gcOverheadPercent);
+
+	/**
+	 * @return true once enough collections were observed for the forecast to be used
+	 */
+	MMINLINE bool isReady() { return (HEAP_SIZING_FORECAST_MINIMUM_SAMPLES <= _rateSamples) && (0 < _liveSamples); }
+
+	/**
+	 * @return forecast old space bytes consumed per hi-res tick outside global collections
+	 */
+	MMINLINE double getAllocationRate() { return OMR_MAX(_allocationRate + _allocationRateTrend, 0.0); }
+	MMINLINE double getCollectionTicks() { return _collectionTicks; }
+	MMINLINE uintptr_t getLastTargetSize() { return _lastTargetSize; }
+
+	MM_HeapSizingForecast() :
+		MM_Base(),
+		_allocationRate(0.0),
+		_allocationRateTrend(0.0),
+		_liveBytes(0.0),
+		_liveBytesTrend(0.0),
+		_collectionTicks(0.0),
+		_rateSamples(0),
+		_liveSamples(0),
+		_collectionStartTime(0),
+		_lastCollectionEndTime(0),
+		_usedBytesAtLastCollectionEnd(0),
+		_lastTargetSize(0)
+	{}
+};
+
+#endif /* HEAPSIZINGFORECAST_HPP_ */
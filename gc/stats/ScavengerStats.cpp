@@ -91,6 +91,18 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
+	,_scanCacheStealAttempts(0)
+	,_scanCacheStealSuccesses(0)
+	,_scanCacheIdleTime(0)
+	,_rememberedSetDirtyCards(0)
+	,_rememberedSetObjectsScanned(0)
+	,_rememberedSetScanTime(0)
+	,_hotFieldSamples(0)
+	,_hotFieldLookups(0)
+	,_hotFieldHits(0)
+	,_hotFieldClasses(0)
+	,_hotFieldHotClasses(0)
+	,_taskDispatchStats()
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	,_readObjectBarrierCopy(0)
 	,_readObjectBarrierUpdate(0)
@@ -195,6 +207,20 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_slotsCopied = 0;
 	_slotsScanned = 0;
 
+	_scanCacheStealAttempts = 0;
+	_scanCacheStealSuccesses = 0;
+	_scanCacheIdleTime = 0;
+	_rememberedSetDirtyCards = 0;
+	_rememberedSetObjectsScanned = 0;
+	_rememberedSetScanTime = 0;
+	_hotFieldSamples = 0;
+	_hotFieldLookups = 0;
+	_hotFieldHits = 0;
+	_hotFieldClasses = 0;
+	_hotFieldHotClasses = 0;
+
+	_taskDispatchStats.clear();
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	_readObjectBarrierCopy = 0;
 	_readObjectBarrierUpdate = 0;
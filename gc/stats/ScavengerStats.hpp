@@ -33,6 +33,7 @@ class MM_EnvironmentBase;
 #include "objectdescription.h"
 
 #include "Math.hpp"
+#include "TaskDispatchStats.hpp"
 
 #define OMR_SCAVENGER_DISTANCE_BINS 32
 #define OMR_SCAVENGER_CACHESIZE_BINS 16
@@ -139,6 +140,20 @@ public:
 
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
+
+	uintptr_t _scanCacheStealAttempts; /**< The number of attempts to steal a scan cache from another thread's deque (scavengerWorkStealing only) */
+	uintptr_t _scanCacheStealSuccesses; /**< The number of scan caches successfully stolen from another thread's deque (scavengerWorkStealing only) */
+	uint64_t _scanCacheIdleTime; /**< The time, in hi-res ticks, spent without scan work while looking for a scan cache (scavengerWorkStealing only) */
+	uintptr_t _rememberedSetDirtyCards; /**< The number of dirty cards visited while scanning the remembered set (scavengerRememberedSetCards only) */
+	uintptr_t _rememberedSetObjectsScanned; /**< The number of remembered objects scanned (scavengerRememberedSetCards only) */
+	uint64_t _rememberedSetScanTime; /**< The time, in hi-res ticks, spent scanning the remembered set (scavengerRememberedSetCards only) */
+	uintptr_t _hotFieldSamples; /**< The number of objects sampled to discover hot fields (scavengerHotFieldDiscovery only) */
+	uintptr_t _hotFieldLookups; /**< The number of copied objects whose discovered hot fields were looked up (scavengerHotFieldDiscovery only) */
+	uintptr_t _hotFieldHits; /**< The number of hot field lookups which found hot fields to depth copy (scavengerHotFieldDiscovery only) */
+	uintptr_t _hotFieldClasses; /**< The number of classes sampled so far, at the end of the scavenge (scavengerHotFieldDiscovery only) */
+	uintptr_t _hotFieldHotClasses; /**< The number of classes with hot fields, at the end of the scavenge (scavengerHotFieldDiscovery only) */
+
+	MM_TaskDispatchStats _taskDispatchStats; /**< start latency of the parallel tasks dispatched during the scavenge */
 	
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _readObjectBarrierCopy; /**< Number of objects copied by read barrier */
@@ -39,6 +39,12 @@ MM_SweepStats::clear()
 	sweepHeapBytesTotal = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	concurrentSweepOnDemandRegions = 0;
+	concurrentSweepBackgroundRegions = 0;
+	concurrentSweepUnsweptRegions = 0;
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	idleTime = 0;
 	mergeTime = 0;
@@ -53,6 +59,12 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 	sweepHeapBytesTotal += statsToMerge->sweepHeapBytesTotal;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	concurrentSweepOnDemandRegions += statsToMerge->concurrentSweepOnDemandRegions;
+	concurrentSweepBackgroundRegions += statsToMerge->concurrentSweepBackgroundRegions;
+	concurrentSweepUnsweptRegions += statsToMerge->concurrentSweepUnsweptRegions;
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
 	idleTime += statsToMerge->idleTime;
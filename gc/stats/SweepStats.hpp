@@ -44,6 +44,12 @@ public:
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t concurrentSweepOnDemandRegions; /**< Small regions swept by allocating threads between the previous pause and this one */
+	uintptr_t concurrentSweepBackgroundRegions; /**< Small regions swept by background helpers between the previous pause and this one */
+	uintptr_t concurrentSweepUnsweptRegions; /**< Small regions still unswept when this pause started (swept with the marks of this cycle) */
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uint64_t idleTime;
 	uint64_t mergeTime;
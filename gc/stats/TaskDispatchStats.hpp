@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(TASKDISPATCHSTATS_HPP_)
+#define TASKDISPATCHSTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+/**
+ * Storage for statistics on how quickly the dispatcher gets parallel tasks started.
+ * The start latency of a task is the time from MM_ParallelDispatcher::run() until every
+ * thread taking part in the task has accepted it.
+ * @ingroup GC_Stats
+ */
+class MM_TaskDispatchStats
+{
+public:
+	uintptr_t _taskCount; /**< The number of parallel tasks dispatched */
+	uint64_t _startLatency; /**< The total start latency of the tasks, in hi-res ticks */
+	uint64_t _maxStartLatency; /**< The longest start latency of a single task, in hi-res ticks */
+	uintptr_t _spinWakeups; /**< The number of times a worker thread saw a task while spinning (dispatcherParkWorkers only) */
+	uintptr_t _parkWakeups; /**< The number of times a worker thread had to be unparked to see a task (dispatcherParkWorkers only) */
+
+	MMINLINE void
+	clear()
+	{
+		_taskCount = 0;
+		_startLatency = 0;
+		_maxStartLatency = 0;
+		_spinWakeups = 0;
+		_parkWakeups = 0;
+	}
+
+	MMINLINE void
+	merge(MM_TaskDispatchStats *statsToMerge)
+	{
+		_taskCount += statsToMerge->_taskCount;
+		_startLatency += statsToMerge->_startLatency;
+		_maxStartLatency = OMR_MAX(_maxStartLatency, statsToMerge->_maxStartLatency);
+		_spinWakeups += statsToMerge->_spinWakeups;
+		_parkWakeups += statsToMerge->_parkWakeups;
+	}
+
+	MM_TaskDispatchStats()
+		: _taskCount(0)
+		, _startLatency(0)
+		, _maxStartLatency(0)
+		, _spinWakeups(0)
+		, _parkWakeups(0)
+	{}
+};
+
+#endif /* TASKDISPATCHSTATS_HPP_ */
@@ -51,6 +51,8 @@ public:
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
 	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting for all other threads to complete working */
+	uintptr_t packetListCASRetries; /**< The number of times a lock-free packet list push or pop had to retry its compare-and-swap */
+	uintptr_t packetListShardMisses; /**< The number of lock-free packet list pops satisfied from a sublist other than the thread's own */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 protected:
@@ -73,6 +75,8 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		packetListCASRetries = 0;
+		packetListShardMisses = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +95,8 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		packetListCASRetries += statsToMerge->packetListCASRetries;
+		packetListShardMisses += statsToMerge->packetListShardMisses;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -151,6 +157,8 @@ public:
 		,_completeStallCount(0)
 		,_workStallTime(0)
 		,_completeStallTime(0)
+		,packetListCASRetries(0)
+		,packetListShardMisses(0)
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
@@ -0,0 +1,436 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "VerboseBinaryDecoder.hpp"
+
+#include <string.h>
+
+bool
+MM_VerboseBinaryDecoder::initialize(OMRPortLibrary *portLibrary, Listener *listener)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	_portLibrary = portLibrary;
+	_listener = listener;
+
+	_entries = (DictionaryEntry *)omrmem_allocate_memory(VERBOSE_BINARY_DICTIONARY_LIMIT * sizeof(DictionaryEntry), OMRMEM_CATEGORY_MM);
+	if (NULL == _entries) {
+		return false;
+	}
+
+	reset();
+	return true;
+}
+
+void
+MM_VerboseBinaryDecoder::tearDown()
+{
+	if (NULL != _portLibrary) {
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		omrmem_free_memory(_pending);
+		_pending = NULL;
+		omrmem_free_memory(_strings);
+		_strings = NULL;
+		omrmem_free_memory(_entries);
+		_entries = NULL;
+		omrmem_free_memory(_previous);
+		_previous = NULL;
+		omrmem_free_memory(_scratch);
+		_scratch = NULL;
+		omrmem_free_memory(_fields);
+		_fields = NULL;
+		omrmem_free_memory(_attributes);
+		_attributes = NULL;
+		omrmem_free_memory(_stack);
+		_stack = NULL;
+		omrmem_free_memory(_stackOffsets);
+		_stackOffsets = NULL;
+	}
+}
+
+void
+MM_VerboseBinaryDecoder::reset()
+{
+	_headerRead = false;
+	_pendingSize = 0;
+	_stringsSize = 0;
+	_entryCount = 0;
+	_previousSize = 0;
+	_stackSize = 0;
+	_depth = 0;
+	_recordCount = 0;
+	_error = NULL;
+}
+
+bool
+MM_VerboseBinaryDecoder::decode(const uint8_t *bytes, uintptr_t length)
+{
+	if (NULL != _error) {
+		return false;
+	}
+
+	/* decode straight from the caller's bytes unless part of a record is left over from the previous call */
+	bool usePending = (0 != _pendingSize) || !_headerRead;
+	if (usePending) {
+		if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_pending, &_pendingCapacity, _pendingSize, _pendingSize + length)) {
+			return fail("out of memory");
+		}
+		memcpy(_pending + _pendingSize, bytes, length);
+		_pendingSize += length;
+		bytes = _pending;
+		length = _pendingSize;
+	}
+
+	const uint8_t *cursor = bytes;
+	const uint8_t *end = bytes + length;
+
+	if (!_headerRead && (VERBOSE_BINARY_HEADER_SIZE <= length)) {
+		if ((VERBOSE_BINARY_MAGIC_0 != cursor[0]) || (VERBOSE_BINARY_MAGIC_1 != cursor[1]) || (VERBOSE_BINARY_MAGIC_2 != cursor[2]) || (VERBOSE_BINARY_MAGIC_3 != cursor[3])) {
+			return fail("not a binary verbose GC stream");
+		}
+		if (VERBOSE_BINARY_VERSION != cursor[4]) {
+			return fail("unsupported binary verbose GC version");
+		}
+		cursor += VERBOSE_BINARY_HEADER_SIZE;
+		_headerRead = true;
+	}
+
+	while (_headerRead && (cursor < end)) {
+		const uint8_t *recordStart = cursor;
+		uint64_t recordLength = 0;
+		if (!MM_VerboseBinaryFormat::readVarint(&cursor, end, &recordLength)) {
+			if ((uintptr_t)(end - recordStart) >= VERBOSE_BINARY_VARINT_MAXIMUM_SIZE) {
+				return fail("malformed record length");
+			}
+			cursor = recordStart;
+			break;
+		}
+		if ((uint64_t)(end - cursor) < recordLength) {
+			cursor = recordStart;
+			break;
+		}
+		if (!decodeRecord(cursor, cursor + recordLength)) {
+			return false;
+		}
+		cursor += recordLength;
+		_recordCount += 1;
+	}
+
+	/* keep the incomplete record for the next call */
+	uintptr_t remaining = end - cursor;
+	if (usePending) {
+		memmove(_pending, cursor, remaining);
+	} else if (0 != remaining) {
+		if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_pending, &_pendingCapacity, 0, remaining)) {
+			return fail("out of memory");
+		}
+		memcpy(_pending, cursor, remaining);
+	}
+	_pendingSize = remaining;
+
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::decodeRecord(const uint8_t *cursor, const uint8_t *end)
+{
+	if (cursor >= end) {
+		return fail("empty record");
+	}
+
+	uint8_t type = *cursor++;
+	switch (type) {
+	case MM_VerboseBinaryFormat::RECORD_START:
+	case MM_VerboseBinaryFormat::RECORD_START_EMPTY:
+	{
+		_scratchSize = 0;
+		_fieldCount = 0;
+		uint64_t attributeCount = 0;
+		if (!decodeSymbol(&cursor, end) || !MM_VerboseBinaryFormat::readVarint(&cursor, end, &attributeCount)) {
+			return fail((NULL != _error) ? _error : "malformed start record");
+		}
+		for (uint64_t i = 0; i < attributeCount; i++) {
+			if (!decodeSymbol(&cursor, end) || !decodeValue(&cursor, end)) {
+				return fail((NULL != _error) ? _error : "malformed attribute");
+			}
+		}
+		if (cursor != end) {
+			return fail("malformed start record");
+		}
+		if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, (uint8_t **)&_attributes, &_attributesCapacity, 0, (uintptr_t)attributeCount * sizeof(Attribute))) {
+			return fail("out of memory");
+		}
+		/* _scratch no longer moves, so the strings can be handed out */
+		const char *name = (const char *)_scratch + _fields[0];
+		for (uintptr_t i = 0; i < attributeCount; i++) {
+			_attributes[i].name = (const char *)_scratch + _fields[1 + (2 * i)];
+			_attributes[i].value = (const char *)_scratch + _fields[2 + (2 * i)];
+		}
+
+		uintptr_t depth = _depth;
+		bool isEmpty = (MM_VerboseBinaryFormat::RECORD_START_EMPTY == type);
+		if (!isEmpty && !push(name)) {
+			return fail("out of memory");
+		}
+		_listener->startElement(name, depth, _attributes, (uintptr_t)attributeCount, isEmpty);
+		break;
+	}
+	case MM_VerboseBinaryFormat::RECORD_END:
+		if ((0 == _depth) || (cursor != end)) {
+			return fail("unmatched end record");
+		}
+		_depth -= 1;
+		_stackSize = _stackOffsets[_depth];
+		_listener->endElement((const char *)_stack + _stackSize, _depth);
+		break;
+	case MM_VerboseBinaryFormat::RECORD_TEXT:
+		_listener->text((const char *)cursor, end - cursor, _depth);
+		break;
+	default:
+		return fail("unknown record type");
+	}
+
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::decodeSymbol(const uint8_t **cursor, const uint8_t *end)
+{
+	uint64_t symbol = 0;
+	if (!MM_VerboseBinaryFormat::readVarint(cursor, end, &symbol) || !beginField()) {
+		return false;
+	}
+
+	if (MM_VerboseBinaryFormat::SYMBOL_FIRST_ID <= symbol) {
+		uint64_t id = symbol - MM_VerboseBinaryFormat::SYMBOL_FIRST_ID;
+		if (id >= _entryCount) {
+			return fail("undefined symbol");
+		}
+		if (!appendScratch(_strings + _entries[id].offset, _entries[id].length)) {
+			return false;
+		}
+	} else {
+		const uint8_t *bytes = NULL;
+		uintptr_t length = 0;
+		if (!readString(cursor, end, &bytes, &length)) {
+			return false;
+		}
+		if ((MM_VerboseBinaryFormat::SYMBOL_DEFINE == symbol) && !define(bytes, length)) {
+			return false;
+		}
+		if (!appendScratch(bytes, length)) {
+			return false;
+		}
+	}
+
+	return appendScratch("", 1);
+}
+
+bool
+MM_VerboseBinaryDecoder::decodeValue(const uint8_t **cursor, const uint8_t *end)
+{
+	if ((*cursor >= end) || !beginField()) {
+		return false;
+	}
+
+	uint8_t type = *(*cursor)++;
+	uint64_t number = 0;
+	const uint8_t *bytes = NULL;
+	uintptr_t length = 0;
+	bool result = true;
+
+	switch (type) {
+	case MM_VerboseBinaryFormat::VALUE_REF:
+		if (!MM_VerboseBinaryFormat::readVarint(cursor, end, &number)) {
+			return false;
+		}
+		if (number >= _entryCount) {
+			return fail("undefined value");
+		}
+		result = appendScratch(_strings + _entries[number].offset, _entries[number].length);
+		break;
+	case MM_VerboseBinaryFormat::VALUE_DEFINE:
+	case MM_VerboseBinaryFormat::VALUE_INLINE:
+		if (!readString(cursor, end, &bytes, &length)) {
+			return false;
+		}
+		if ((MM_VerboseBinaryFormat::VALUE_DEFINE == type) && !define(bytes, length)) {
+			return false;
+		}
+		if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_previous, &_previousCapacity, 0, length)) {
+			return fail("out of memory");
+		}
+		memcpy(_previous, bytes, length);
+		_previousSize = length;
+		result = appendScratch(bytes, length);
+		break;
+	case MM_VerboseBinaryFormat::VALUE_PREFIX:
+		if (!MM_VerboseBinaryFormat::readVarint(cursor, end, &number) || (number > _previousSize) || !readString(cursor, end, &bytes, &length)) {
+			return fail("malformed prefix value");
+		}
+		if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_previous, &_previousCapacity, (uintptr_t)number, (uintptr_t)number + length)) {
+			return fail("out of memory");
+		}
+		memcpy(_previous + number, bytes, length);
+		_previousSize = (uintptr_t)number + length;
+		result = appendScratch(_previous, _previousSize);
+		break;
+	case MM_VerboseBinaryFormat::VALUE_UINT:
+	case MM_VerboseBinaryFormat::VALUE_NEGATIVE:
+		if (!MM_VerboseBinaryFormat::readVarint(cursor, end, &number)) {
+			return false;
+		}
+		if (MM_VerboseBinaryFormat::VALUE_NEGATIVE == type) {
+			result = appendScratch("-", 1);
+		}
+		result = result && appendUnsigned(number, 1);
+		break;
+	case MM_VerboseBinaryFormat::VALUE_HEX:
+		if (!MM_VerboseBinaryFormat::readVarint(cursor, end, &number)) {
+			return false;
+		}
+		result = appendScratch("0x", 2) && appendHex(number);
+		break;
+	case MM_VerboseBinaryFormat::VALUE_DECIMAL:
+	{
+		uint64_t fraction = 0;
+		if (!MM_VerboseBinaryFormat::readVarint(cursor, end, &number) || (*cursor >= end)) {
+			return false;
+		}
+		uintptr_t digits = *(*cursor)++;
+		if ((0 == digits) || (VERBOSE_BINARY_FRACTION_DIGITS_LIMIT < digits) || !MM_VerboseBinaryFormat::readVarint(cursor, end, &fraction)) {
+			return fail("malformed decimal value");
+		}
+		result = appendUnsigned(number, 1) && appendScratch(".", 1) && appendUnsigned(fraction, digits);
+		break;
+	}
+	default:
+		return fail("unknown value type");
+	}
+
+	return result && appendScratch("", 1);
+}
+
+/**
+ * Read a length and that many bytes.
+ */
+bool
+MM_VerboseBinaryDecoder::readString(const uint8_t **cursor, const uint8_t *end, const uint8_t **bytes, uintptr_t *length)
+{
+	uint64_t stringLength = 0;
+	if (!MM_VerboseBinaryFormat::readVarint(cursor, end, &stringLength) || ((uint64_t)(end - *cursor) < stringLength)) {
+		return false;
+	}
+	*bytes = *cursor;
+	*length = (uintptr_t)stringLength;
+	*cursor += stringLength;
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::define(const uint8_t *bytes, uintptr_t length)
+{
+	if (VERBOSE_BINARY_DICTIONARY_LIMIT <= _entryCount) {
+		return fail("dictionary overflow");
+	}
+	if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_strings, &_stringsCapacity, _stringsSize, _stringsSize + length)) {
+		return fail("out of memory");
+	}
+
+	memcpy(_strings + _stringsSize, bytes, length);
+	_entries[_entryCount].offset = _stringsSize;
+	_entries[_entryCount].length = length;
+	_stringsSize += length;
+	_entryCount += 1;
+	return true;
+}
+
+/**
+ * Record the start of the next name or value in _scratch.
+ */
+bool
+MM_VerboseBinaryDecoder::beginField()
+{
+	if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, (uint8_t **)&_fields, &_fieldsCapacity, _fieldCount * sizeof(uintptr_t), (_fieldCount + 1) * sizeof(uintptr_t))) {
+		return fail("out of memory");
+	}
+	_fields[_fieldCount] = _scratchSize;
+	_fieldCount += 1;
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::appendScratch(const void *bytes, uintptr_t length)
+{
+	if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_scratch, &_scratchCapacity, _scratchSize, _scratchSize + length)) {
+		return fail("out of memory");
+	}
+	memcpy(_scratch + _scratchSize, bytes, length);
+	_scratchSize += length;
+	return true;
+}
+
+/**
+ * Append value in decimal, zero padded to minimumDigits.
+ */
+bool
+MM_VerboseBinaryDecoder::appendUnsigned(uint64_t value, uintptr_t minimumDigits)
+{
+	char digits[24];
+	uintptr_t count = 0;
+	while ((0 != value) || (count < minimumDigits)) {
+		digits[sizeof(digits) - 1 - count] = (char)('0' + (value % 10));
+		value /= 10;
+		count += 1;
+	}
+	return appendScratch(digits + sizeof(digits) - count, count);
+}
+
+bool
+MM_VerboseBinaryDecoder::appendHex(uint64_t value)
+{
+	static const char hexDigits[] = "0123456789abcdef";
+	char digits[16];
+	uintptr_t count = 0;
+	do {
+		digits[sizeof(digits) - 1 - count] = hexDigits[value & 0xF];
+		value >>= 4;
+		count += 1;
+	} while (0 != value);
+	return appendScratch(digits + sizeof(digits) - count, count);
+}
+
+bool
+MM_VerboseBinaryDecoder::push(const char *name)
+{
+	uintptr_t length = strlen(name) + 1;
+	if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, (uint8_t **)&_stackOffsets, &_stackOffsetsCapacity, _depth * sizeof(uintptr_t), (_depth + 1) * sizeof(uintptr_t))
+		|| !MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_stack, &_stackCapacity, _stackSize, _stackSize + length)
+	) {
+		return false;
+	}
+	_stackOffsets[_depth] = _stackSize;
+	memcpy(_stack + _stackSize, name, length);
+	_stackSize += length;
+	_depth += 1;
+	return true;
+}
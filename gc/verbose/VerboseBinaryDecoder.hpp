@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEBINARYDECODER_HPP_)
+#define VERBOSEBINARYDECODER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+
+#include "VerboseBinaryFormat.hpp"
+
+/**
+ * Streaming decoder for the binary verbose GC format described in VerboseBinaryFormat.hpp.
+ *
+ * Bytes can be fed in chunks of any size; complete records are reported to a Listener as they arrive, and
+ * an incomplete trailing record is kept until the next call. Names and values are passed as NUL terminated
+ * strings, with numbers formatted back to the text they were encoded from, and are only valid for the
+ * duration of the callback. The decoder needs only a port library, so it can be used by standalone tools.
+ */
+class MM_VerboseBinaryDecoder
+{
+	/*
+	 * Data members
+	 */
+public:
+	struct Attribute {
+		const char *name;
+		const char *value;
+	};
+
+	/**
+	 * Receives the decoded stream. depth is the number of elements enclosing the event.
+	 */
+	class Listener
+	{
+	public:
+		virtual void startElement(const char *name, uintptr_t depth, const Attribute *attributes, uintptr_t attributeCount, bool isEmpty) = 0;
+		virtual void endElement(const char *name, uintptr_t depth) = 0;
+		virtual void text(const char *text, uintptr_t length, uintptr_t depth) = 0;
+	};
+
+protected:
+private:
+	struct DictionaryEntry {
+		uintptr_t offset; /**< offset of the bytes in _strings */
+		uintptr_t length;
+	};
+
+	OMRPortLibrary *_portLibrary;
+	Listener *_listener;
+
+	bool _headerRead;
+	uint8_t *_pending; /**< bytes of an incomplete record, kept for the next call */
+	uintptr_t _pendingSize;
+	uintptr_t _pendingCapacity;
+
+	uint8_t *_strings; /**< bytes of the dictionary entries */
+	uintptr_t _stringsSize;
+	uintptr_t _stringsCapacity;
+	DictionaryEntry *_entries; /**< VERBOSE_BINARY_DICTIONARY_LIMIT entries, indexed by id */
+	uintptr_t _entryCount;
+
+	uint8_t *_previous; /**< the previous string value, for VALUE_PREFIX */
+	uintptr_t _previousSize;
+	uintptr_t _previousCapacity;
+
+	uint8_t *_scratch; /**< NUL terminated names and values of the record being decoded */
+	uintptr_t _scratchSize;
+	uintptr_t _scratchCapacity;
+	uintptr_t *_fields; /**< offset in _scratch of each name and value */
+	uintptr_t _fieldCount;
+	uintptr_t _fieldsCapacity; /**< in bytes */
+	Attribute *_attributes;
+	uintptr_t _attributesCapacity; /**< in bytes */
+
+	uint8_t *_stack; /**< NUL terminated names of the open elements */
+	uintptr_t _stackSize;
+	uintptr_t _stackCapacity;
+	uintptr_t *_stackOffsets; /**< offset in _stack of each open element */
+	uintptr_t _stackOffsetsCapacity; /**< in bytes */
+	uintptr_t _depth;
+
+	uint64_t _recordCount;
+	const char *_error;
+
+	/*
+	 * Function members
+	 */
+public:
+	bool initialize(OMRPortLibrary *portLibrary, Listener *listener);
+	void tearDown();
+
+	/**
+	 * Start decoding a new stream.
+	 */
+	void reset();
+
+	/**
+	 * Decode the next chunk of the stream.
+	 * @return false if the stream is malformed (see getError()); the decoder then rejects further input until reset
+	 */
+	bool decode(const uint8_t *bytes, uintptr_t length);
+
+	/**
+	 * @return true if everything fed so far has been decoded, i.e. the stream did not end within a record
+	 */
+	MMINLINE bool atRecordBoundary() { return _headerRead && (0 == _pendingSize) && (NULL == _error); }
+
+	MMINLINE uintptr_t getDepth() { return _depth; }
+	MMINLINE uint64_t getRecordCount() { return _recordCount; }
+	MMINLINE const char *getError() { return _error; }
+
+	MM_VerboseBinaryDecoder()
+		: _portLibrary(NULL)
+		, _listener(NULL)
+		, _headerRead(false)
+		, _pending(NULL)
+		, _pendingSize(0)
+		, _pendingCapacity(0)
+		, _strings(NULL)
+		, _stringsSize(0)
+		, _stringsCapacity(0)
+		, _entries(NULL)
+		, _entryCount(0)
+		, _previous(NULL)
+		, _previousSize(0)
+		, _previousCapacity(0)
+		, _scratch(NULL)
+		, _scratchSize(0)
+		, _scratchCapacity(0)
+		, _fields(NULL)
+		, _fieldCount(0)
+		, _fieldsCapacity(0)
+		, _attributes(NULL)
+		, _attributesCapacity(0)
+		, _stack(NULL)
+		, _stackSize(0)
+		, _stackCapacity(0)
+		, _stackOffsets(NULL)
+		, _stackOffsetsCapacity(0)
+		, _depth(0)
+		, _recordCount(0)
+		, _error(NULL)
+	{}
+
+protected:
+private:
+	MMINLINE bool fail(const char *error) { _error = error; return false; }
+
+	bool decodeRecord(const uint8_t *cursor, const uint8_t *end);
+	bool decodeSymbol(const uint8_t **cursor, const uint8_t *end);
+	bool decodeValue(const uint8_t **cursor, const uint8_t *end);
+	bool readString(const uint8_t **cursor, const uint8_t *end, const uint8_t **bytes, uintptr_t *length);
+	bool define(const uint8_t *bytes, uintptr_t length);
+
+	bool beginField();
+	bool appendScratch(const void *bytes, uintptr_t length);
+	bool appendUnsigned(uint64_t value, uintptr_t minimumDigits);
+	bool appendHex(uint64_t value);
+
+	bool push(const char *name);
+};
+
+#endif /* VERBOSEBINARYDECODER_HPP_ */
@@ -0,0 +1,920 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "VerboseBinaryEncoder.hpp"
+
+#include <string.h>
+
+#define VERBOSE_BINARY_DICTIONARY_SLOTS (2 * VERBOSE_BINARY_DICTIONARY_LIMIT)
+#define VERBOSE_BINARY_ARGUMENT_MARKER '\001' /**< stands for a numeric argument in the line being encoded by encodeFormat() */
+#define VERBOSE_BINARY_UINT_MAXIMUM ((uint64_t)9999999999999999999ULL) /**< largest value parseUnsigned() accepts */
+
+static MMINLINE bool
+isSpace(char c)
+{
+	return (' ' == c) || ('\t' == c) || ('\r' == c) || ('\n' == c);
+}
+
+/**
+ * Parse a canonical unsigned decimal: digits only, without leading zeros, small enough for 64 bits.
+ */
+static bool
+parseUnsigned(const char *string, uintptr_t length, uint64_t *value)
+{
+	if ((0 == length) || (length > 19) || (('0' == string[0]) && (length > 1))) {
+		return false;
+	}
+	uint64_t result = 0;
+	for (uintptr_t i = 0; i < length; i++) {
+		if (('0' > string[i]) || ('9' < string[i])) {
+			return false;
+		}
+		result = (result * 10) + (string[i] - '0');
+	}
+	*value = result;
+	return true;
+}
+
+/**
+ * Parse canonical lower case hex digits (as printed by %zx): without leading zeros, at most 16 of them.
+ */
+static bool
+parseHex(const char *string, uintptr_t length, uint64_t *value)
+{
+	if ((0 == length) || (length > 16) || (('0' == string[0]) && (length > 1))) {
+		return false;
+	}
+	uint64_t result = 0;
+	for (uintptr_t i = 0; i < length; i++) {
+		char c = string[i];
+		if (('0' <= c) && ('9' >= c)) {
+			result = (result << 4) | (uint64_t)(c - '0');
+		} else if (('a' <= c) && ('f' >= c)) {
+			result = (result << 4) | (uint64_t)(c - 'a' + 10);
+		} else {
+			return false;
+		}
+	}
+	*value = result;
+	return true;
+}
+
+/**
+ * Find the magnitude of an integer argument of encodeFormat(), the way omrstr_vprintf() prints it.
+ * @param isNegative[out] true if the argument is negative
+ */
+static uint64_t
+integerMagnitude(uint64_t value, bool is64Bit, char conversion, bool *isNegative)
+{
+	*isNegative = false;
+	if (('d' == conversion) || ('i' == conversion)) {
+		int64_t signedValue = is64Bit ? (int64_t)value : (int64_t)(int32_t)value;
+		if (0 > signedValue) {
+			*isNegative = true;
+			/* well defined for the smallest int64_t too */
+			return (uint64_t)(-(signedValue + 1)) + 1;
+		}
+	}
+	return value;
+}
+
+static MMINLINE uint32_t
+hashString(const char *string, uintptr_t length)
+{
+	/* FNV-1a */
+	uint32_t hash = 2166136261U;
+	for (uintptr_t i = 0; i < length; i++) {
+		hash ^= (uint8_t)string[i];
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+bool
+MM_VerboseBinaryEncoder::initialize(OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	_portLibrary = portLibrary;
+
+	_entries = (DictionaryEntry *)omrmem_allocate_memory(VERBOSE_BINARY_DICTIONARY_LIMIT * sizeof(DictionaryEntry), OMRMEM_CATEGORY_MM);
+	_slots = (uint32_t *)omrmem_allocate_memory(VERBOSE_BINARY_DICTIONARY_SLOTS * sizeof(uint32_t), OMRMEM_CATEGORY_MM);
+	if ((NULL == _entries) || (NULL == _slots)) {
+		return false;
+	}
+
+	reset();
+	return !_failed;
+}
+
+void
+MM_VerboseBinaryEncoder::tearDown()
+{
+	if (NULL != _portLibrary) {
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		omrmem_free_memory(_output);
+		_output = NULL;
+		omrmem_free_memory(_record);
+		_record = NULL;
+		omrmem_free_memory(_strings);
+		_strings = NULL;
+		omrmem_free_memory(_entries);
+		_entries = NULL;
+		omrmem_free_memory(_slots);
+		_slots = NULL;
+		omrmem_free_memory(_previous);
+		_previous = NULL;
+		omrmem_free_memory(_line);
+		_line = NULL;
+		omrmem_free_memory(_scratch);
+		_scratch = NULL;
+	}
+}
+
+void
+MM_VerboseBinaryEncoder::reset()
+{
+	static const uint8_t header[VERBOSE_BINARY_HEADER_SIZE] = {
+		VERBOSE_BINARY_MAGIC_0, VERBOSE_BINARY_MAGIC_1, VERBOSE_BINARY_MAGIC_2, VERBOSE_BINARY_MAGIC_3, VERBOSE_BINARY_VERSION
+	};
+
+	_failed = false;
+	_outputSize = 0;
+	_stringsSize = 0;
+	_entryCount = 0;
+	_previousSize = 0;
+	memset(_slots, 0, VERBOSE_BINARY_DICTIONARY_SLOTS * sizeof(uint32_t));
+
+	if (MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_output, &_outputCapacity, 0, sizeof(header))) {
+		memcpy(_output, header, sizeof(header));
+		_outputSize = sizeof(header);
+	} else {
+		_failed = true;
+	}
+}
+
+bool
+MM_VerboseBinaryEncoder::encode(const char *xml, uintptr_t length)
+{
+	const char *cursor = xml;
+	const char *end = xml + length;
+
+	while ((cursor < end) && !_failed) {
+		while ((cursor < end) && isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if (cursor >= end) {
+			break;
+		}
+
+		if ('<' != *cursor) {
+			/* character data, with the surrounding white space which only formats the XML dropped */
+			const char *textEnd = (const char *)memchr(cursor, '<', end - cursor);
+			if (NULL == textEnd) {
+				textEnd = end;
+			}
+			const char *trimmed = textEnd;
+			while (isSpace(trimmed[-1])) {
+				trimmed -= 1;
+			}
+			encodeText(cursor, trimmed - cursor);
+			cursor = textEnd;
+		} else {
+			const char *next = encodeTag(cursor, end);
+			if (NULL == next) {
+				/* not markup the encoder understands: keep it verbatim, up to the end of the tag */
+				next = (const char *)memchr(cursor, '>', end - cursor);
+				next = (NULL == next) ? end : (next + 1);
+				encodeText(cursor, next - cursor);
+			}
+			cursor = next;
+		}
+	}
+
+	return !_failed;
+}
+
+/**
+ * Encode the markup at cursor as a record.
+ * @return the character after the markup, or NULL if it is not markup the encoder understands
+ */
+const char *
+MM_VerboseBinaryEncoder::encodeTag(const char *cursor, const char *end)
+{
+	if ((cursor + 1) >= end) {
+		return NULL;
+	}
+
+	if (('?' == cursor[1]) || ('!' == cursor[1])) {
+		/* processing instruction, declaration or comment: kept as text */
+		const char *tokenEnd = NULL;
+		if (((cursor + 4) <= end) && (0 == strncmp(cursor, "<!--", 4))) {
+			for (const char *read = cursor + 4; (read + 3) <= end; read++) {
+				if (0 == strncmp(read, "-->", 3)) {
+					tokenEnd = read + 3;
+					break;
+				}
+			}
+		} else {
+			tokenEnd = (const char *)memchr(cursor, '>', end - cursor);
+			if (NULL != tokenEnd) {
+				tokenEnd += 1;
+			}
+		}
+		if (NULL != tokenEnd) {
+			encodeText(cursor, tokenEnd - cursor);
+		}
+		return tokenEnd;
+	}
+
+	if ('/' == cursor[1]) {
+		const char *close = (const char *)memchr(cursor, '>', end - cursor);
+		if (NULL == close) {
+			return NULL;
+		}
+		startRecord(MM_VerboseBinaryFormat::RECORD_END);
+		finishRecord();
+		return close + 1;
+	}
+
+	uintptr_t attributeCount = 0;
+	bool isEmpty = false;
+	if (NULL == parseTag(cursor, end, false, false, &attributeCount, &isEmpty)) {
+		return NULL;
+	}
+	startRecord(isEmpty ? MM_VerboseBinaryFormat::RECORD_START_EMPTY : MM_VerboseBinaryFormat::RECORD_START);
+	const char *tagEnd = parseTag(cursor, end, true, false, &attributeCount, &isEmpty);
+	finishRecord();
+	return tagEnd;
+}
+
+/**
+ * Parse the start tag at cursor. Only double quoted attribute values are accepted.
+ * @param emit[in] false to only validate the tag and count its attributes, true to also encode its name and attributes
+ * @param formatted[in] true if the tag is in the line read by readFormat(), whose arguments may only be in attribute values
+ * @return the character after the tag, or NULL if it is not a well formed start tag
+ */
+const char *
+MM_VerboseBinaryEncoder::parseTag(const char *cursor, const char *end, bool emit, bool formatted, uintptr_t *attributeCount, bool *isEmpty)
+{
+	const char *read = cursor + 1;
+	const char *name = read;
+	while ((read < end) && !isSpace(*read) && ('/' != *read) && ('>' != *read)) {
+		read += 1;
+	}
+	if ((read == name) || (formatted && (NULL != memchr(name, VERBOSE_BINARY_ARGUMENT_MARKER, read - name)))) {
+		return NULL;
+	}
+	if (emit) {
+		encodeSymbol(name, read - name);
+		appendVarint(*attributeCount);
+	}
+
+	uintptr_t count = 0;
+	while (true) {
+		while ((read < end) && isSpace(*read)) {
+			read += 1;
+		}
+		if (read >= end) {
+			return NULL;
+		}
+		if ('>' == *read) {
+			*isEmpty = false;
+			break;
+		}
+		if ('/' == *read) {
+			if (((read + 1) < end) && ('>' == read[1])) {
+				*isEmpty = true;
+				read += 1;
+				break;
+			}
+			return NULL;
+		}
+
+		const char *attributeName = read;
+		while ((read < end) && !isSpace(*read) && ('=' != *read) && ('>' != *read) && ('/' != *read)) {
+			read += 1;
+		}
+		const char *attributeNameEnd = read;
+		while ((read < end) && isSpace(*read)) {
+			read += 1;
+		}
+		if ((attributeName == attributeNameEnd) || (read >= end) || ('=' != *read)) {
+			return NULL;
+		}
+		if (formatted && (NULL != memchr(attributeName, VERBOSE_BINARY_ARGUMENT_MARKER, attributeNameEnd - attributeName))) {
+			return NULL;
+		}
+		read += 1;
+		while ((read < end) && isSpace(*read)) {
+			read += 1;
+		}
+		if ((read >= end) || ('"' != *read)) {
+			return NULL;
+		}
+		const char *value = read + 1;
+		const char *valueEnd = (const char *)memchr(value, '"', end - value);
+		if (NULL == valueEnd) {
+			return NULL;
+		}
+		if (emit) {
+			encodeSymbol(attributeName, attributeNameEnd - attributeName);
+			if (formatted) {
+				encodeFormatValue(value, valueEnd - value);
+			} else {
+				encodeValue(value, valueEnd - value);
+			}
+		}
+		read = valueEnd + 1;
+		count += 1;
+	}
+
+	*attributeCount = count;
+	return read + 1;
+}
+
+void
+MM_VerboseBinaryEncoder::encodeText(const char *text, uintptr_t length)
+{
+	if (0 != length) {
+		startRecord(MM_VerboseBinaryFormat::RECORD_TEXT);
+		appendBytes(text, length);
+		finishRecord();
+	}
+}
+
+bool
+MM_VerboseBinaryEncoder::encodeFormat(const char *format, va_list args)
+{
+	va_list argsCopy;
+
+	COPY_VA_LIST(argsCopy, args);
+	bool isMarkup = readFormat(format, argsCopy) && encodeLine(false);
+	END_VA_LIST_COPY(argsCopy);
+
+	if (isMarkup) {
+		encodeLine(true);
+	} else {
+		encodeFormattedText(format, args);
+	}
+
+	return !_failed;
+}
+
+/**
+ * Read a format string and its arguments into _line and _arguments. String arguments are copied into
+ * the line; every other argument is replaced by a marker and kept with its conversion specification.
+ * @return false if the format uses something encodeFormat() does not handle, so the line must be formatted
+ */
+bool
+MM_VerboseBinaryEncoder::readFormat(const char *format, va_list args)
+{
+	_lineSize = 0;
+	_argumentCount = 0;
+
+	const char *cursor = format;
+	while ('\0' != *cursor) {
+		const char *literal = cursor;
+		while (('\0' != *cursor) && ('%' != *cursor)) {
+			cursor += 1;
+		}
+		if ((NULL != memchr(literal, VERBOSE_BINARY_ARGUMENT_MARKER, cursor - literal)) || !reserve(&_line, &_lineCapacity, _lineSize, _lineSize + (cursor - literal) + 1)) {
+			return false;
+		}
+		memcpy(_line + _lineSize, literal, cursor - literal);
+		_lineSize += cursor - literal;
+		if ('\0' == *cursor) {
+			break;
+		}
+
+		const char *specification = cursor;
+		cursor += 1;
+		if ('%' == *cursor) {
+			_line[_lineSize++] = '%';
+			cursor += 1;
+			continue;
+		}
+
+		/* the grammar of omrstr_vprintf(): one flag, width, precision, modifier and conversion; no '*' or '$' */
+		char flag = '\0';
+		if (('0' == *cursor) || (' ' == *cursor) || ('-' == *cursor) || ('+' == *cursor) || ('#' == *cursor)) {
+			flag = *cursor;
+			cursor += 1;
+		}
+		uintptr_t width = 0;
+		bool hasWidth = ('0' <= *cursor) && ('9' >= *cursor);
+		while (('0' <= *cursor) && ('9' >= *cursor)) {
+			width = (width * 10) + (*cursor - '0');
+			cursor += 1;
+		}
+		uintptr_t precision = 0;
+		bool hasPrecision = ('.' == *cursor);
+		if (hasPrecision) {
+			cursor += 1;
+			while (('0' <= *cursor) && ('9' >= *cursor)) {
+				precision = (precision * 10) + (*cursor - '0');
+				cursor += 1;
+			}
+		}
+		bool isLong = false;
+		bool isLongLong = false;
+		if ('z' == *cursor) {
+#if defined(OMR_ENV_DATA64)
+			isLongLong = true;
+#endif /* OMR_ENV_DATA64 */
+			cursor += 1;
+		} else if ('l' == *cursor) {
+			cursor += 1;
+			if ('l' == *cursor) {
+				isLongLong = true;
+				cursor += 1;
+			} else {
+				isLong = true;
+			}
+		}
+		char conversion = *cursor;
+		if ('\0' == conversion) {
+			return false;
+		}
+		cursor += 1;
+		bool isPlain = ('\0' == flag) && !hasWidth && !hasPrecision;
+
+		if ('s' == conversion) {
+			const char *string = va_arg(args, const char *);
+			if (!isPlain || isLong || (NULL == string)) {
+				return false;
+			}
+			uintptr_t length = strlen(string);
+			if ((NULL != memchr(string, VERBOSE_BINARY_ARGUMENT_MARKER, length)) || !reserve(&_line, &_lineCapacity, _lineSize, _lineSize + length + 1)) {
+				return false;
+			}
+			memcpy(_line + _lineSize, string, length);
+			_lineSize += length;
+			continue;
+		}
+
+		if ((VERBOSE_BINARY_ARGUMENT_LIMIT <= _argumentCount) || (VERBOSE_BINARY_SPECIFICATION_LIMIT <= (uintptr_t)(cursor - specification))) {
+			return false;
+		}
+		FormatArgument *argument = &_arguments[_argumentCount];
+		switch (conversion) {
+		case 'd':
+		case 'i':
+		case 'u':
+		case 'x':
+		case 'X':
+			if (isLongLong) {
+				argument->type = ARGUMENT_U64;
+				argument->value.u64 = va_arg(args, uint64_t);
+			} else {
+				argument->type = ARGUMENT_U32;
+				argument->value.u32 = va_arg(args, uint32_t);
+			}
+			break;
+		case 'p':
+			argument->type = ARGUMENT_POINTER;
+			argument->value.pointer = va_arg(args, void *);
+			break;
+		case 'f':
+		case 'e':
+		case 'E':
+		case 'F':
+		case 'g':
+		case 'G':
+			argument->type = ARGUMENT_DOUBLE;
+			argument->value.dbl = va_arg(args, double);
+			break;
+		default:
+			/* characters may be markup */
+			return false;
+		}
+		argument->conversion = conversion;
+		argument->isPlain = isPlain;
+		argument->zeroPadding = (('0' == flag) && hasWidth && (!hasPrecision || (precision <= width))) ? width : 0;
+		memcpy(argument->specification, specification, cursor - specification);
+		argument->specification[cursor - specification] = '\0';
+		_argumentCount += 1;
+		_line[_lineSize++] = VERBOSE_BINARY_ARGUMENT_MARKER;
+	}
+
+	return true;
+}
+
+/**
+ * Encode the line read by readFormat() as a record per tag.
+ * @param emit[in] false to only check the line, true to also encode it
+ * @return false if the line is not a sequence of start and end tags with arguments only in attribute values
+ */
+bool
+MM_VerboseBinaryEncoder::encodeLine(bool emit)
+{
+	const char *cursor = _line;
+	const char *end = _line + _lineSize;
+
+	_nextArgument = 0;
+	while (true) {
+		while ((cursor < end) && isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if (cursor >= end) {
+			break;
+		}
+		if (((cursor + 1) >= end) || ('<' != cursor[0]) || ('?' == cursor[1]) || ('!' == cursor[1])) {
+			return false;
+		}
+
+		if ('/' == cursor[1]) {
+			const char *close = (const char *)memchr(cursor, '>', end - cursor);
+			if (NULL == close) {
+				return false;
+			}
+			if (emit) {
+				/* an end tag has no values, but the arguments in it are still used */
+				for (const char *read = cursor; read < close; read++) {
+					if (VERBOSE_BINARY_ARGUMENT_MARKER == *read) {
+						_nextArgument += 1;
+					}
+				}
+				startRecord(MM_VerboseBinaryFormat::RECORD_END);
+				finishRecord();
+			}
+			cursor = close + 1;
+		} else {
+			uintptr_t attributeCount = 0;
+			bool isEmpty = false;
+			const char *tagEnd = parseTag(cursor, end, false, true, &attributeCount, &isEmpty);
+			if (NULL == tagEnd) {
+				return false;
+			}
+			if (emit) {
+				startRecord(isEmpty ? MM_VerboseBinaryFormat::RECORD_START_EMPTY : MM_VerboseBinaryFormat::RECORD_START);
+				parseTag(cursor, end, true, true, &attributeCount, &isEmpty);
+				finishRecord();
+			}
+			cursor = tagEnd;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Encode an attribute value of the line read by readFormat(). The values verbose GC prints most (a decimal,
+ * "0x" and hex digits, or seconds and zero padded milliseconds) are encoded from their arguments; any other
+ * value with arguments is formatted, then encoded as encodeValue() would have encoded it in formatted XML.
+ */
+void
+MM_VerboseBinaryEncoder::encodeFormatValue(const char *value, uintptr_t length)
+{
+	if (NULL == memchr(value, VERBOSE_BINARY_ARGUMENT_MARKER, length)) {
+		encodeValue(value, length);
+		return;
+	}
+
+	FormatArgument *argument = &_arguments[_nextArgument];
+	bool isInteger = (ARGUMENT_U32 == argument->type) || (ARGUMENT_U64 == argument->type);
+	uint64_t number = (ARGUMENT_U32 == argument->type) ? argument->value.u32 : argument->value.u64;
+	bool isNegative = false;
+	uint8_t type = 0;
+
+	if ((1 == length) && isInteger && argument->isPlain && (('d' == argument->conversion) || ('i' == argument->conversion) || ('u' == argument->conversion))) {
+		number = integerMagnitude(number, ARGUMENT_U64 == argument->type, argument->conversion, &isNegative);
+		if (VERBOSE_BINARY_UINT_MAXIMUM >= number) {
+			type = isNegative ? MM_VerboseBinaryFormat::VALUE_NEGATIVE : MM_VerboseBinaryFormat::VALUE_UINT;
+			appendBytes(&type, sizeof(type));
+			appendVarint(number);
+			_nextArgument += 1;
+			return;
+		}
+	} else if ((3 == length) && ('0' == value[0]) && ('x' == value[1]) && isInteger && argument->isPlain && ('x' == argument->conversion)) {
+		type = MM_VerboseBinaryFormat::VALUE_HEX;
+		appendBytes(&type, sizeof(type));
+		appendVarint(number);
+		_nextArgument += 1;
+		return;
+	} else if ((3 == length) && (VERBOSE_BINARY_ARGUMENT_MARKER == value[0]) && ('.' == value[1]) && (VERBOSE_BINARY_ARGUMENT_MARKER == value[2])
+		&& isInteger && argument->isPlain && ('u' == argument->conversion) && (VERBOSE_BINARY_UINT_MAXIMUM >= number)
+	) {
+		/* the fraction has exactly as many digits as it is zero padded to */
+		FormatArgument *fractionArgument = &_arguments[_nextArgument + 1];
+		uintptr_t digits = fractionArgument->zeroPadding;
+		uint64_t fraction = (ARGUMENT_U32 == fractionArgument->type) ? fractionArgument->value.u32 : fractionArgument->value.u64;
+		uint64_t limit = 0;
+		if ((0 < digits) && (VERBOSE_BINARY_FRACTION_DIGITS_LIMIT >= digits)) {
+			limit = 1;
+			for (uintptr_t i = 0; i < digits; i++) {
+				limit *= 10;
+			}
+		}
+		if (((ARGUMENT_U32 == fractionArgument->type) || (ARGUMENT_U64 == fractionArgument->type)) && ('u' == fractionArgument->conversion) && (fraction < limit)) {
+			uint8_t fractionDigits = (uint8_t)digits;
+			type = MM_VerboseBinaryFormat::VALUE_DECIMAL;
+			appendBytes(&type, sizeof(type));
+			appendVarint(number);
+			appendBytes(&fractionDigits, sizeof(fractionDigits));
+			appendVarint(fraction);
+			_nextArgument += 2;
+			return;
+		}
+	}
+
+	uintptr_t size = 0;
+	for (uintptr_t i = 0; i < length; i++) {
+		if (VERBOSE_BINARY_ARGUMENT_MARKER == value[i]) {
+			argument = &_arguments[_nextArgument];
+			_nextArgument += 1;
+			uintptr_t required = formatArgument(NULL, 0, argument);
+			if (!reserve(&_scratch, &_scratchCapacity, size, size + required)) {
+				_failed = true;
+				return;
+			}
+			size += formatArgument(_scratch + size, required, argument);
+		} else {
+			if (!reserve(&_scratch, &_scratchCapacity, size, size + 1)) {
+				_failed = true;
+				return;
+			}
+			_scratch[size++] = value[i];
+		}
+	}
+	encodeValue(_scratch, size);
+}
+
+/**
+ * Format an argument read by readFormat() with its conversion specification.
+ * @return as omrstr_printf(): the number of characters written, or the size needed if buffer is NULL
+ */
+uintptr_t
+MM_VerboseBinaryEncoder::formatArgument(char *buffer, uintptr_t length, FormatArgument *argument)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	uintptr_t result = 0;
+
+	switch (argument->type) {
+	case ARGUMENT_U32:
+		result = omrstr_printf(buffer, length, argument->specification, argument->value.u32);
+		break;
+	case ARGUMENT_U64:
+		result = omrstr_printf(buffer, length, argument->specification, argument->value.u64);
+		break;
+	case ARGUMENT_POINTER:
+		result = omrstr_printf(buffer, length, argument->specification, argument->value.pointer);
+		break;
+	case ARGUMENT_DOUBLE:
+		result = omrstr_printf(buffer, length, argument->specification, argument->value.dbl);
+		break;
+	}
+
+	return result;
+}
+
+/**
+ * Format a line encodeFormat() cannot encode from its arguments, and tokenize it.
+ */
+void
+MM_VerboseBinaryEncoder::encodeFormattedText(const char *format, va_list args)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	va_list argsCopy;
+
+	COPY_VA_LIST(argsCopy, args);
+	uintptr_t required = omrstr_vprintf(NULL, 0, format, argsCopy);
+	END_VA_LIST_COPY(argsCopy);
+	if (!reserve(&_scratch, &_scratchCapacity, 0, required)) {
+		_failed = true;
+		return;
+	}
+
+	COPY_VA_LIST(argsCopy, args);
+	uintptr_t length = omrstr_vprintf(_scratch, required, format, argsCopy);
+	END_VA_LIST_COPY(argsCopy);
+	encode(_scratch, length);
+}
+
+bool
+MM_VerboseBinaryEncoder::reserve(char **buffer, uintptr_t *capacity, uintptr_t used, uintptr_t required)
+{
+	uint8_t *bytes = (uint8_t *)*buffer;
+	bool result = MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &bytes, capacity, used, required);
+	*buffer = (char *)bytes;
+	return result;
+}
+
+void
+MM_VerboseBinaryEncoder::startRecord(uint8_t type)
+{
+	_recordSize = 0;
+	appendBytes(&type, sizeof(type));
+}
+
+void
+MM_VerboseBinaryEncoder::finishRecord()
+{
+	if (!_failed) {
+		if (MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_output, &_outputCapacity, _outputSize, _outputSize + VERBOSE_BINARY_VARINT_MAXIMUM_SIZE + _recordSize)) {
+			uint8_t *write = MM_VerboseBinaryFormat::writeVarint(_output + _outputSize, _recordSize);
+			memcpy(write, _record, _recordSize);
+			_outputSize = (write + _recordSize) - _output;
+		} else {
+			_failed = true;
+		}
+	}
+}
+
+void
+MM_VerboseBinaryEncoder::appendBytes(const void *bytes, uintptr_t length)
+{
+	if (MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_record, &_recordCapacity, _recordSize, _recordSize + length)) {
+		memcpy(_record + _recordSize, bytes, length);
+		_recordSize += length;
+	} else {
+		_failed = true;
+	}
+}
+
+void
+MM_VerboseBinaryEncoder::appendVarint(uint64_t value)
+{
+	uint8_t buffer[VERBOSE_BINARY_VARINT_MAXIMUM_SIZE];
+	uint8_t *end = MM_VerboseBinaryFormat::writeVarint(buffer, value);
+	appendBytes(buffer, end - buffer);
+}
+
+void
+MM_VerboseBinaryEncoder::encodeSymbol(const char *name, uintptr_t length)
+{
+	uint32_t hash = hashString(name, length);
+	uintptr_t slot = 0;
+	intptr_t id = lookup(name, length, hash, &slot);
+
+	if (0 <= id) {
+		appendVarint(MM_VerboseBinaryFormat::SYMBOL_FIRST_ID + (uintptr_t)id);
+	} else {
+		if ((length <= VERBOSE_BINARY_DICTIONARY_NAME_LIMIT) && define(name, length, slot)) {
+			appendVarint(MM_VerboseBinaryFormat::SYMBOL_DEFINE);
+		} else {
+			appendVarint(MM_VerboseBinaryFormat::SYMBOL_INLINE);
+		}
+		appendVarint(length);
+		appendBytes(name, length);
+	}
+}
+
+void
+MM_VerboseBinaryEncoder::encodeValue(const char *value, uintptr_t length)
+{
+	uint64_t number = 0;
+	uint8_t type = 0;
+
+	if (parseUnsigned(value, length, &number)) {
+		type = MM_VerboseBinaryFormat::VALUE_UINT;
+		appendBytes(&type, sizeof(type));
+		appendVarint(number);
+		return;
+	}
+	if ((1 < length) && ('-' == value[0]) && parseUnsigned(value + 1, length - 1, &number) && (0 != number)) {
+		type = MM_VerboseBinaryFormat::VALUE_NEGATIVE;
+		appendBytes(&type, sizeof(type));
+		appendVarint(number);
+		return;
+	}
+	if ((2 < length) && ('0' == value[0]) && ('x' == value[1]) && parseHex(value + 2, length - 2, &number)) {
+		type = MM_VerboseBinaryFormat::VALUE_HEX;
+		appendBytes(&type, sizeof(type));
+		appendVarint(number);
+		return;
+	}
+
+	const char *dot = (const char *)memchr(value, '.', length);
+	if (NULL != dot) {
+		uintptr_t fractionDigits = length - (dot - value) - 1;
+		uint64_t fraction = 0;
+		bool isDecimal = parseUnsigned(value, dot - value, &number) && (0 < fractionDigits) && (VERBOSE_BINARY_FRACTION_DIGITS_LIMIT >= fractionDigits);
+		for (uintptr_t i = 1; isDecimal && (i <= fractionDigits); i++) {
+			char c = dot[i];
+			isDecimal = ('0' <= c) && ('9' >= c);
+			fraction = (fraction * 10) + (c - '0');
+		}
+		if (isDecimal) {
+			uint8_t digits = (uint8_t)fractionDigits;
+			type = MM_VerboseBinaryFormat::VALUE_DECIMAL;
+			appendBytes(&type, sizeof(type));
+			appendVarint(number);
+			appendBytes(&digits, sizeof(digits));
+			appendVarint(fraction);
+			return;
+		}
+	}
+
+	uint32_t hash = hashString(value, length);
+	uintptr_t slot = 0;
+	intptr_t id = lookup(value, length, hash, &slot);
+	if (0 <= id) {
+		type = MM_VerboseBinaryFormat::VALUE_REF;
+		appendBytes(&type, sizeof(type));
+		appendVarint((uintptr_t)id);
+		return;
+	}
+
+	uintptr_t prefix = 0;
+	uintptr_t prefixLimit = OMR_MIN(length, _previousSize);
+	while ((prefix < prefixLimit) && (value[prefix] == (char)_previous[prefix])) {
+		prefix += 1;
+	}
+
+	if (VERBOSE_BINARY_PREFIX_MINIMUM <= prefix) {
+		/* e.g. successive timestamps */
+		type = MM_VerboseBinaryFormat::VALUE_PREFIX;
+		appendBytes(&type, sizeof(type));
+		appendVarint(prefix);
+		appendVarint(length - prefix);
+		appendBytes(value + prefix, length - prefix);
+	} else {
+		if ((length <= VERBOSE_BINARY_DICTIONARY_VALUE_LIMIT) && define(value, length, slot)) {
+			type = MM_VerboseBinaryFormat::VALUE_DEFINE;
+		} else {
+			type = MM_VerboseBinaryFormat::VALUE_INLINE;
+		}
+		appendBytes(&type, sizeof(type));
+		appendVarint(length);
+		appendBytes(value, length);
+	}
+	setPrevious(value, length);
+}
+
+void
+MM_VerboseBinaryEncoder::setPrevious(const char *value, uintptr_t length)
+{
+	if (MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_previous, &_previousCapacity, 0, length)) {
+		memcpy(_previous, value, length);
+		_previousSize = length;
+	} else {
+		_failed = true;
+	}
+}
+
+/**
+ * Find a string in the dictionary.
+ * @param slot[out] the empty slot the string would be defined in, when it is not found
+ * @return the id of the string, or -1 if it is not in the dictionary
+ */
+intptr_t
+MM_VerboseBinaryEncoder::lookup(const char *string, uintptr_t length, uint32_t hash, uintptr_t *slot)
+{
+	uintptr_t index = hash & (VERBOSE_BINARY_DICTIONARY_SLOTS - 1);
+
+	/* the table is never more than half full, so the probe always finds an empty slot */
+	while (0 != _slots[index]) {
+		uintptr_t id = _slots[index] - 1;
+		if ((_entries[id].length == length) && (0 == memcmp(_strings + _entries[id].offset, string, length))) {
+			return (intptr_t)id;
+		}
+		index = (index + 1) & (VERBOSE_BINARY_DICTIONARY_SLOTS - 1);
+	}
+
+	*slot = index;
+	return -1;
+}
+
+/**
+ * Add a string to the dictionary, in the slot found by lookup().
+ * @return true if the string was added, false if the dictionary is full
+ */
+bool
+MM_VerboseBinaryEncoder::define(const char *string, uintptr_t length, uintptr_t slot)
+{
+	if (VERBOSE_BINARY_DICTIONARY_LIMIT <= _entryCount) {
+		return false;
+	}
+	if (!MM_VerboseBinaryFormat::ensureCapacity(_portLibrary, &_strings, &_stringsCapacity, _stringsSize, _stringsSize + length)) {
+		_failed = true;
+		return false;
+	}
+
+	memcpy(_strings + _stringsSize, string, length);
+	_entries[_entryCount].offset = (uint32_t)_stringsSize;
+	_entries[_entryCount].length = (uint32_t)length;
+	_stringsSize += length;
+	_slots[slot] = (uint32_t)(_entryCount + 1);
+	_entryCount += 1;
+	return true;
+}
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEBINARYENCODER_HPP_)
+#define VERBOSEBINARYENCODER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrstdarg.h"
+
+#include "VerboseBinaryFormat.hpp"
+
+#define VERBOSE_BINARY_ARGUMENT_LIMIT 64 /**< most numeric arguments of a line encoded by encodeFormat() */
+#define VERBOSE_BINARY_SPECIFICATION_LIMIT 16 /**< longest conversion specification encoded by encodeFormat() */
+
+/**
+ * Converts the verbose GC XML stream into the binary format described in VerboseBinaryFormat.hpp.
+ *
+ * encodeFormat() encodes a line from the format string and arguments a verbose handler passes to the
+ * writer chain, while the line is output: names come from the format string and numeric arguments are
+ * encoded from their values, so they are never printed and parsed back. Only string arguments are copied,
+ * as they may hold markup (such as the tag template of a stanza). A line which is not a single tag is
+ * formatted and tokenized like encode() does.
+ *
+ * encode() tokenizes XML which is already formatted, such as the header and the initialized stanza. It
+ * accepts whole tags only: anything it does not recognize as markup, including a tag split across two
+ * calls, is kept as a text record.
+ *
+ * Encoded bytes accumulate in an output buffer until the caller takes them with consumeOutput(). The
+ * encoder needs only a port library, so tools and tests can use it without a VM.
+ */
+class MM_VerboseBinaryEncoder
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	struct DictionaryEntry {
+		uint32_t offset; /**< offset of the bytes in _strings */
+		uint32_t length;
+	};
+
+	OMRPortLibrary *_portLibrary;
+
+	uint8_t *_output; /**< encoded records not yet consumed */
+	uintptr_t _outputSize;
+	uintptr_t _outputCapacity;
+
+	uint8_t *_record; /**< body of the record being encoded */
+	uintptr_t _recordSize;
+	uintptr_t _recordCapacity;
+
+	uint8_t *_strings; /**< bytes of the dictionary entries */
+	uintptr_t _stringsSize;
+	uintptr_t _stringsCapacity;
+	DictionaryEntry *_entries; /**< VERBOSE_BINARY_DICTIONARY_LIMIT entries, indexed by id */
+	uintptr_t _entryCount;
+	uint32_t *_slots; /**< open addressed hash of the dictionary: 0 for an empty slot, otherwise id + 1 */
+
+	uint8_t *_previous; /**< the previous string value, for VALUE_PREFIX */
+	uintptr_t _previousSize;
+	uintptr_t _previousCapacity;
+
+	/**
+	 * A numeric argument of the line being encoded by encodeFormat(), read the way omrstr_vprintf() reads it.
+	 */
+	struct FormatArgument {
+		union {
+			uint32_t u32;
+			uint64_t u64;
+			void *pointer;
+			double dbl;
+		} value;
+		uint8_t type; /**< one of ArgumentType */
+		char conversion; /**< the conversion character of the specification */
+		bool isPlain; /**< the specification has no flag, width or precision */
+		uintptr_t zeroPadding; /**< the width of a specification with only the '0' flag and a precision no larger, 0 otherwise */
+		char specification[VERBOSE_BINARY_SPECIFICATION_LIMIT]; /**< the conversion specification, NUL terminated */
+	};
+
+	enum ArgumentType {
+		ARGUMENT_U32 = 0,
+		ARGUMENT_U64,
+		ARGUMENT_POINTER,
+		ARGUMENT_DOUBLE
+	};
+
+	bool _failed; /**< a buffer could not be grown; the output is no longer a valid stream */
+
+	char *_line; /**< the line being encoded by encodeFormat(): its markup, with a marker for each numeric argument */
+	uintptr_t _lineSize;
+	uintptr_t _lineCapacity;
+	FormatArgument _arguments[VERBOSE_BINARY_ARGUMENT_LIMIT]; /**< the numeric arguments of _line, in order */
+	uintptr_t _argumentCount;
+	uintptr_t _nextArgument; /**< the argument of the next marker of _line */
+	char *_scratch; /**< text of formatted values and lines */
+	uintptr_t _scratchCapacity;
+
+	/*
+	 * Function members
+	 */
+public:
+	bool initialize(OMRPortLibrary *portLibrary);
+	void tearDown();
+
+	/**
+	 * Start a new stream: forget the dictionary and previous value, and queue the stream header.
+	 * Pending output is discarded.
+	 */
+	void reset();
+
+	/**
+	 * Encode a chunk of the XML stream, appending the records to the output buffer.
+	 * @return false if memory could not be allocated
+	 */
+	bool encode(const char *xml, uintptr_t length);
+
+	/**
+	 * Encode one line of the XML stream from the format string and arguments it would be formatted with
+	 * by omrstr_vprintf(), appending the records to the output buffer.
+	 * @return false if memory could not be allocated
+	 */
+	bool encodeFormat(const char *format, va_list args);
+
+	/**
+	 * @return true if a buffer could not be grown, so the output is no longer a valid stream until reset()
+	 */
+	MMINLINE bool hasFailed() { return _failed; }
+
+	MMINLINE uint8_t *getOutput() { return _output; }
+	MMINLINE uintptr_t getOutputSize() { return _outputSize; }
+
+	/**
+	 * Discard the output buffer contents once the caller has written them.
+	 */
+	MMINLINE void consumeOutput() { _outputSize = 0; }
+
+	MM_VerboseBinaryEncoder()
+		: _portLibrary(NULL)
+		, _output(NULL)
+		, _outputSize(0)
+		, _outputCapacity(0)
+		, _record(NULL)
+		, _recordSize(0)
+		, _recordCapacity(0)
+		, _strings(NULL)
+		, _stringsSize(0)
+		, _stringsCapacity(0)
+		, _entries(NULL)
+		, _entryCount(0)
+		, _slots(NULL)
+		, _previous(NULL)
+		, _previousSize(0)
+		, _previousCapacity(0)
+		, _failed(false)
+		, _line(NULL)
+		, _lineSize(0)
+		, _lineCapacity(0)
+		, _argumentCount(0)
+		, _nextArgument(0)
+		, _scratch(NULL)
+		, _scratchCapacity(0)
+	{}
+
+protected:
+private:
+	const char *parseTag(const char *cursor, const char *end, bool emit, bool formatted, uintptr_t *attributeCount, bool *isEmpty);
+	const char *encodeTag(const char *cursor, const char *end);
+	void encodeText(const char *text, uintptr_t length);
+
+	bool readFormat(const char *format, va_list args);
+	bool encodeLine(bool emit);
+	void encodeFormatValue(const char *value, uintptr_t length);
+	uintptr_t formatArgument(char *buffer, uintptr_t length, FormatArgument *argument);
+	void encodeFormattedText(const char *format, va_list args);
+	bool reserve(char **buffer, uintptr_t *capacity, uintptr_t used, uintptr_t required);
+
+	void startRecord(uint8_t type);
+	void finishRecord();
+	void appendBytes(const void *bytes, uintptr_t length);
+	void appendVarint(uint64_t value);
+
+	void encodeSymbol(const char *name, uintptr_t length);
+	void encodeValue(const char *value, uintptr_t length);
+	void setPrevious(const char *value, uintptr_t length);
+
+	intptr_t lookup(const char *string, uintptr_t length, uint32_t hash, uintptr_t *slot);
+	bool define(const char *string, uintptr_t length, uintptr_t slot);
+};
+
+#endif /* VERBOSEBINARYENCODER_HPP_ */
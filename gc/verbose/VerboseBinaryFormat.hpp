@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "modronbase.h"
+
+#include <string.h>
+
+/**
+ * @file
+ * Compact binary encoding of the verbose GC XML stream.
+ *
+ * A stream starts with the four magic bytes and a version byte, followed by records. Each record is a
+ * varint length, then that many bytes: a record type byte and its body. All integers are unsigned LEB128
+ * varints. Element and attribute names are symbols, numeric attribute values are stored as integers, and
+ * short string values go into a dictionary, so the stream is a fraction of the size of the XML and can be
+ * decoded without an XML parser. Every file (including each rotated file) is a self contained stream.
+ *
+ * Record bodies:
+ *  RECORD_START, RECORD_START_EMPTY: name symbol, attribute count, then (name symbol, value) per attribute
+ *  RECORD_END: empty; closes the innermost open element
+ *  RECORD_TEXT: raw bytes (processing instructions, comments and character data)
+ *
+ * A symbol is a varint n: n >= SYMBOL_FIRST_ID refers to dictionary entry (n - SYMBOL_FIRST_ID),
+ * SYMBOL_DEFINE is followed by a length and the bytes of a new dictionary entry, and SYMBOL_INLINE by a
+ * length and bytes which are not added to the dictionary.
+ *
+ * A value is a type byte followed by:
+ *  VALUE_REF: dictionary id
+ *  VALUE_DEFINE: length and bytes of a new dictionary entry
+ *  VALUE_INLINE: length and bytes
+ *  VALUE_PREFIX: the number of leading bytes shared with the previous string value, then the length and bytes of the rest
+ *  VALUE_UINT, VALUE_NEGATIVE, VALUE_HEX: the magnitude of a canonical decimal, negative decimal or "0x" lower case hex number
+ *  VALUE_DECIMAL: integer part, number of fraction digits (one byte), fraction
+ * The previous string value is the last one encoded as VALUE_DEFINE, VALUE_INLINE or VALUE_PREFIX.
+ */
+
+#define VERBOSE_BINARY_MAGIC_0 0x89
+#define VERBOSE_BINARY_MAGIC_1 'V'
+#define VERBOSE_BINARY_MAGIC_2 'G'
+#define VERBOSE_BINARY_MAGIC_3 'C'
+#define VERBOSE_BINARY_VERSION 1
+#define VERBOSE_BINARY_HEADER_SIZE 5
+
+#define VERBOSE_BINARY_DICTIONARY_LIMIT 4096 /**< maximum number of dictionary entries in one stream */
+#define VERBOSE_BINARY_DICTIONARY_NAME_LIMIT 64 /**< longest name added to the dictionary */
+#define VERBOSE_BINARY_DICTIONARY_VALUE_LIMIT 32 /**< longest value added to the dictionary */
+#define VERBOSE_BINARY_PREFIX_MINIMUM 8 /**< shortest shared prefix worth encoding as VALUE_PREFIX */
+#define VERBOSE_BINARY_FRACTION_DIGITS_LIMIT 18
+#define VERBOSE_BINARY_VARINT_MAXIMUM_SIZE 10
+
+class MM_VerboseBinaryFormat
+{
+public:
+	enum RecordType {
+		RECORD_START = 1,
+		RECORD_START_EMPTY = 2,
+		RECORD_END = 3,
+		RECORD_TEXT = 4
+	};
+
+	enum SymbolType {
+		SYMBOL_DEFINE = 0,
+		SYMBOL_INLINE = 1,
+		SYMBOL_FIRST_ID = 2
+	};
+
+	enum ValueType {
+		VALUE_REF = 0,
+		VALUE_DEFINE = 1,
+		VALUE_INLINE = 2,
+		VALUE_PREFIX = 3,
+		VALUE_UINT = 4,
+		VALUE_NEGATIVE = 5,
+		VALUE_HEX = 6,
+		VALUE_DECIMAL = 7
+	};
+
+	/**
+	 * Write value as a varint.
+	 * @param cursor[in] where to write, with room for VERBOSE_BINARY_VARINT_MAXIMUM_SIZE bytes
+	 * @return the byte after the varint
+	 */
+	static MMINLINE uint8_t *
+	writeVarint(uint8_t *cursor, uint64_t value)
+	{
+		while (value >= 0x80) {
+			*cursor++ = (uint8_t)(value | 0x80);
+			value >>= 7;
+		}
+		*cursor++ = (uint8_t)value;
+		return cursor;
+	}
+
+	/**
+	 * Read a varint from [*cursor, end).
+	 * @return true and advance *cursor on success, false if the varint is truncated or too long
+	 */
+	static MMINLINE bool
+	readVarint(const uint8_t **cursor, const uint8_t *end, uint64_t *value)
+	{
+		uint64_t result = 0;
+		const uint8_t *read = *cursor;
+		for (uintptr_t shift = 0; shift < 64; shift += 7) {
+			if (read >= end) {
+				return false;
+			}
+			uint8_t byte = *read++;
+			result |= ((uint64_t)(byte & 0x7F)) << shift;
+			if (0 == (byte & 0x80)) {
+				*cursor = read;
+				*value = result;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Grow a native buffer so that it holds at least required bytes, preserving its contents.
+	 * @return true on success, false if the memory could not be allocated (the buffer is unchanged)
+	 */
+	static MMINLINE bool
+	ensureCapacity(OMRPortLibrary *portLibrary, uint8_t **buffer, uintptr_t *capacity, uintptr_t used, uintptr_t required)
+	{
+		if (required > *capacity) {
+			OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+			uintptr_t newCapacity = OMR_MAX(*capacity * 2, OMR_MAX(required, (uintptr_t)256));
+			uint8_t *newBuffer = (uint8_t *)omrmem_allocate_memory(newCapacity, OMRMEM_CATEGORY_MM);
+			if (NULL == newBuffer) {
+				return false;
+			}
+			if (NULL != *buffer) {
+				memcpy(newBuffer, *buffer, used);
+				omrmem_free_memory(*buffer);
+			}
+			*buffer = newBuffer;
+			*capacity = newCapacity;
+		}
+		return true;
+	}
+};
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
@@ -28,12 +28,18 @@
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapScanKernels.hpp"
 #include "HeapRegionManager.hpp"
 #include "ObjectAllocationInterface.hpp"
+#include "OMRVMThreadListIterator.hpp"
 #include "ParallelDispatcher.hpp"
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+#include "TLHAllocationInterface.hpp"
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
+#include "VerboseBinaryFormat.hpp"
 #include "VerboseBuffer.hpp"
 
 #include "gcutils.h"
@@ -41,6 +47,21 @@
 static void verboseHandlerInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
+static const char *
+getHugePagePolicyString(MM_GCExtensionsBase::HugePagePolicy policy)
+{
+	switch (policy) {
+	case MM_GCExtensionsBase::HUGE_PAGE_POLICY_OFF:
+		return "off";
+	case MM_GCExtensionsBase::HUGE_PAGE_POLICY_TRANSPARENT:
+		return "thp";
+	case MM_GCExtensionsBase::HUGE_PAGE_POLICY_EXPLICIT:
+		return "explicit";
+	default:
+		return "default";
+	}
+}
+
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutput::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
 {
@@ -65,6 +86,12 @@ MM_VerboseHandlerOutput::MM_VerboseHandlerOutput(MM_GCExtensionsBase *extensions
 	,_mmPrivateHooks(NULL)
 	,_mmOmrHooks(NULL)
 	,_manager(NULL)
+	,_hugePageBytes(0)
+	,_hugePageBytesCollectionCount(0)
+	,_hugePageBytesActiveSize(0)
+	,_hugePageBytesReleasedBytes(0)
+	,_hugePageBytesValid(false)
+	,_hugePageBytesAvailable(false)
 {}
 
 bool
@@ -245,6 +272,21 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (_extensions->scavengerWorkStealing) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"scavengerWorkStealing\" value=\"%s\" />",
+				_extensions->isConcurrentScavengerEnabled() ? "disabled, not supported with concurrentScavenger" : "enabled");
+	}
+	if (_extensions->scavengerRememberedSetCards) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"scavengerRememberedSetCards\" value=\"%s\" />",
+				_extensions->isConcurrentScavengerEnabled() ? "disabled, not supported with concurrentScavenger" : "enabled");
+	}
+	if (_extensions->scavengerHotFieldDiscovery) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"scavengerHotFieldDiscovery\" value=\"%s\" />",
+				(MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == _extensions->scavengerScanOrdering) ? "enabled" : "disabled, requires dynamicBreadthFirstScanOrdering");
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	buffer->formatAndOutput(env, 1, "<attribute name=\"maxHeapSize\" value=\"0x%zx\" />", _extensions->memoryMax);
 	buffer->formatAndOutput(env, 1, "<attribute name=\"initialHeapSize\" value=\"0x%zx\" />", _extensions->initialMemorySize);
 
@@ -263,6 +305,15 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	buffer->formatAndOutput(env, 1, "<attribute name=\"pageType\" value=\"%s\" />", getPageTypeString(_extensions->heap->getPageFlags()));
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageSize\" value=\"0x%zx\" />", _extensions->requestedPageSize);
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageType\" value=\"%s\" />", getPageTypeString(_extensions->requestedPageFlags));
+	buffer->formatAndOutput(env, 1, "<attribute name=\"heapHugePagePolicy\" value=\"%s\" />", getHugePagePolicyString(_extensions->heapHugePagePolicy));
+	if (isHeapHugePageCoverageAvailable(env)) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"heapHugePageBytes\" value=\"%zu\" />", _hugePageBytes);
+	}
+	buffer->formatAndOutput(env, 1, "<attribute name=\"heapPretouch\" value=\"%s\" />", _extensions->heapPretouch ? "true" : "false");
+	buffer->formatAndOutput(env, 1, "<attribute name=\"heapSizingForecast\" value=\"%s\" />", _extensions->heapSizingForecast ? "true" : "false");
+	if (_extensions->heapSizingForecast) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"heapSizingGCOverheadTarget\" value=\"%zu\" />", _extensions->heapSizingGCOverheadTarget);
+	}
 	buffer->formatAndOutput(env, 1, "<attribute name=\"gcthreads\" value=\"%zu\" />", _extensions->gcThreadCount);
 
 	if (gc_policy_gencon == _extensions->configurationOptions._gcPolicy) {
@@ -278,12 +329,53 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 	}
 
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	if (_extensions->isConcurrentMarkEnabled() && _extensions->concurrentHelperPacing) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"concurrentHelperPacing\" value=\"true\" />");
+	}
+	if (_extensions->isConcurrentMarkEnabled() && _extensions->concurrentCardCleaningSummary) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"concurrentCardCleaningSummary\" value=\"true\" />");
+	}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+
 	buffer->formatAndOutput(env, 1, "<attribute name=\"packetListSplit\" value=\"%zu\" />", _extensions->packetListSplit);
+	buffer->formatAndOutput(env, 1, "<attribute name=\"packetListLockFree\" value=\"%s\" />", _extensions->packetListLockFree ? "true" : "false");
+	if (_extensions->markingClassHistogram) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"markingClassHistogramTopK\" value=\"%zu\" />", _extensions->markingClassHistogramTopK);
+	}
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	buffer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	buffer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmount\" value=\"%zu\" />", _extensions->splitFreeListSplitAmount);
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	buffer->formatAndOutput(env, 1, "<attribute name=\"tlhAdaptiveSizing\" value=\"%s\" />", _extensions->tlhAdaptiveSizing ? "true" : "false");
+	if (_extensions->tlhAdaptiveSizing) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"tlhAdaptiveRefreshTarget\" value=\"%zu\" />", _extensions->tlhAdaptiveRefreshTarget);
+	}
+	buffer->formatAndOutput(env, 1, "<attribute name=\"tlhRefreshBatchCount\" value=\"%zu\" />", _extensions->tlhRefreshBatchCount);
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+	if (_extensions->binaryLogging) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"binaryLoggingVersion\" value=\"%u\" />", VERBOSE_BINARY_VERSION);
+	}
+	if (_extensions->asynchronousLogging) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"asynchronousLoggingBufferSize\" value=\"0x%zx\" />", _extensions->asynchronousLoggingBufferSize);
+	}
 	buffer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", _extensions->_numaManager.getAffinityLeaderCount());
+	buffer->formatAndOutput(env, 1, "<attribute name=\"numaGCThreadAffinity\" value=\"%s\" />", _extensions->numaGCThreadAffinity ? "true" : "false");
+	buffer->formatAndOutput(env, 1, "<attribute name=\"dispatcherParkWorkers\" value=\"%s\" />", _extensions->dispatcherParkWorkers ? "true" : "false");
+	buffer->formatAndOutput(env, 1, "<attribute name=\"adaptiveGCThreadCount\" value=\"%s\" />", _extensions->adaptiveGCThreadCount ? "true" : "false");
+	buffer->formatAndOutput(env, 1, "<attribute name=\"heapMapScanKernels\" value=\"%s\" />", MM_HeapMapScanKernels::selectKernels(env)->name);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	buffer->formatAndOutput(env, 1, "<attribute name=\"parallelSlidingCompaction\" value=\"%s\" />", _extensions->parallelSlidingCompaction ? "true" : "false");
+	buffer->formatAndOutput(env, 1, "<attribute name=\"compactPrefetchDistance\" value=\"%zu\" />", _extensions->compactPrefetchDistance);
+#endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (_extensions->isSegregatedHeap()) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"segregatedConcurrentSweep\" value=\"%s\" />", _extensions->segregatedConcurrentSweep ? "true" : "false");
+		buffer->formatAndOutput(env, 1, "<attribute name=\"segregatedConcurrentSweepHelperThreads\" value=\"%zu\" />", _extensions->segregatedConcurrentSweepHelperThreads);
+		buffer->formatAndOutput(env, 1, "<attribute name=\"segregatedSizeClassStats\" value=\"%s\" />", _extensions->segregatedSizeClassStats ? "true" : "false");
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
 
 	outputInitializedInnerStanza(env, buffer);
 
@@ -765,6 +857,44 @@ MM_VerboseHandlerOutput::outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, ui
 {
 }
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+void
+MM_VerboseHandlerOutput::printTLHSizing(MM_EnvironmentBase* env)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	uintptr_t activeThreads = 0;
+	uintptr_t idleThreads = 0;
+	uintptr_t refreshSize = 0;
+	uintptr_t refreshCount = 0;
+	uintptr_t refreshBytes = 0;
+
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	OMR_VMThread *walkThread = NULL;
+	while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(walkThread);
+		((MM_TLHAllocationInterface *)walkEnv->_objectAllocationInterface)->getTLHSizing(&refreshSize, &refreshCount, &refreshBytes);
+		if (0 == refreshCount) {
+			idleThreads += 1;
+		} else {
+			activeThreads += 1;
+		}
+	}
+
+	writer->formatAndOutput(env, 1, "<tlh-sizing activethreads=\"%zu\" idlethreads=\"%zu\">", activeThreads, idleThreads);
+	/* only the threads which refreshed their TLH since the previous collection are listed */
+	threadListIterator.reset();
+	while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(walkThread);
+		((MM_TLHAllocationInterface *)walkEnv->_objectAllocationInterface)->getTLHSizing(&refreshSize, &refreshCount, &refreshBytes);
+		if (0 != refreshCount) {
+			writer->formatAndOutput(env, 2, "<tlh-thread threadId=\"%p\" tlhsize=\"%zu\" refreshes=\"%zu\" bytes=\"%zu\" />",
+					walkThread->_language_vmthread, refreshSize, refreshCount, refreshBytes);
+		}
+	}
+	writer->formatAndOutput(env, 1, "</tlh-sizing>");
+}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+
 void
 MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 {
@@ -785,6 +915,18 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		if ((1 < _extensions->tlhRefreshBatchCount) && (0 != (systemStats->_tlhRefreshCountFresh + systemStats->_tlhRefreshCountReused + systemStats->_tlhRefreshCountBatched))) {
+			writer->formatAndOutput(env, 1, "<tlh-refresh fresh=\"%zu\" reused=\"%zu\" batched=\"%zu\" p50ns=\"%llu\" p90ns=\"%llu\" p99ns=\"%llu\" />",
+					systemStats->_tlhRefreshCountFresh, systemStats->_tlhRefreshCountReused, systemStats->_tlhRefreshCountBatched,
+					omrtime_hires_delta(0, systemStats->tlhRefreshLatencyPercentile(50), OMRPORT_TIME_DELTA_IN_NANOSECONDS),
+					omrtime_hires_delta(0, systemStats->tlhRefreshLatencyPercentile(90), OMRPORT_TIME_DELTA_IN_NANOSECONDS),
+					omrtime_hires_delta(0, systemStats->tlhRefreshLatencyPercentile(99), OMRPORT_TIME_DELTA_IN_NANOSECONDS));
+		}
+		if (_extensions->tlhAdaptiveSizing) {
+			printTLHSizing(env);
+		}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -994,7 +1136,31 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 
 	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
 
-	writer->formatAndOutput(env, indent, "<heap-resize id=\"%zu\" type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" %s />", id, resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString, tagTemplate);
+	char resizeDetails[256];
+	uintptr_t resizeDetailsLength = 0;
+	resizeDetails[0] = '\0';
+	if (isHeapHugePageCoverageAvailable(env)) {
+		resizeDetailsLength += omrstr_printf(resizeDetails + resizeDetailsLength, sizeof(resizeDetails) - resizeDetailsLength, "hugepagebytes=\"%zu\" ", _hugePageBytes);
+	}
+	if (_extensions->heapPretouch && (HEAP_EXPAND == resizeType)) {
+		MM_HeapResizeStats *resizeStats = _extensions->heap->getResizeStats();
+		uint64_t pretouchMicroSeconds = omrtime_hires_delta(0, resizeStats->getLastPretouchTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		resizeDetailsLength += omrstr_printf(resizeDetails + resizeDetailsLength, sizeof(resizeDetails) - resizeDetailsLength, "pretouchbytes=\"%zu\" pretouchms=\"%llu.%03llu\" ", resizeStats->getLastPretouchBytes(), pretouchMicroSeconds / 1000, pretouchMicroSeconds % 1000);
+	}
+	if (((HEAP_EXPAND == resizeType) && (FORECAST_GC_OVERHEAD_TOO_HIGH == (ExpandReason)reason))
+		|| ((HEAP_CONTRACT == resizeType) && (FORECAST_GC_OVERHEAD_TOO_LOW == (ContractReason)reason))
+	) {
+		MM_HeapSizingForecast *forecast = _extensions->heap->getSizingForecast();
+		uint64_t allocationRate = (uint64_t)(forecast->getAllocationRate() * (double)omrtime_hires_frequency());
+		uint64_t collectionMicroSeconds = omrtime_hires_delta(0, (uint64_t)forecast->getCollectionTicks(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		resizeDetailsLength += omrstr_printf(resizeDetails + resizeDetailsLength, sizeof(resizeDetails) - resizeDetailsLength, "forecastbytes=\"%zu\" forecastallocrate=\"%llu\" forecastgcms=\"%llu.%03llu\" ", forecast->getLastTargetSize(), allocationRate, collectionMicroSeconds / 1000, collectionMicroSeconds % 1000);
+	}
+	if (HEAP_RELEASE_FREE_PAGES == resizeType) {
+		MM_HeapResizeStats *resizeStats = _extensions->heap->getResizeStats();
+		resizeDetailsLength += omrstr_printf(resizeDetails + resizeDetailsLength, sizeof(resizeDetails) - resizeDetailsLength, "totalreleasedbytes=\"%zu\" totallazilyfreedbytes=\"%zu\" ", resizeStats->getTotalReleasedBytes(), resizeStats->getTotalLazilyFreedBytes());
+	}
+
+	writer->formatAndOutput(env, indent, "<heap-resize id=\"%zu\" type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" %s%s />", id, resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString, resizeDetails, tagTemplate);
 	writer->flush(env);
 }
 
@@ -1020,7 +1186,43 @@ MM_VerboseHandlerOutput::outputCollectorHeapResizeInfo(MM_EnvironmentBase *env,
 
 	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
 
-	writer->formatAndOutput(env, indent, "<heap-resize type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" />", resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString);
+	if (isHeapHugePageCoverageAvailable(env)) {
+		writer->formatAndOutput(env, indent, "<heap-resize type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" hugepagebytes=\"%zu\" />", resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString, _hugePageBytes);
+	} else {
+		writer->formatAndOutput(env, indent, "<heap-resize type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" />", resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString);
+	}
+}
+
+bool
+MM_VerboseHandlerOutput::isHeapHugePageCoverageAvailable(MM_EnvironmentBase *env)
+{
+	if (MM_GCExtensionsBase::HUGE_PAGE_POLICY_DEFAULT == _extensions->heapHugePagePolicy) {
+		return false;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_Heap *heap = _extensions->heap;
+	uintptr_t collectionCount = _extensions->globalGCStats.gcCount;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	collectionCount += _extensions->scavengerStats._gcCount;
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	uintptr_t activeSize = heap->getActiveMemorySize();
+	uintptr_t releasedBytes = heap->getResizeStats()->getTotalReleasedBytes();
+
+	if (!_hugePageBytesValid
+		|| (collectionCount != _hugePageBytesCollectionCount)
+		|| (activeSize != _hugePageBytesActiveSize)
+		|| (releasedBytes != _hugePageBytesReleasedBytes)
+	) {
+		uintptr_t heapBase = (uintptr_t)heap->getHeapBase();
+		_hugePageBytes = 0;
+		_hugePageBytesAvailable = (0 == omrvmem_get_huge_page_coverage((void *)heapBase, (uintptr_t)heap->getHeapTop() - heapBase, &_hugePageBytes));
+		_hugePageBytesCollectionCount = collectionCount;
+		_hugePageBytesActiveSize = activeSize;
+		_hugePageBytesReleasedBytes = releasedBytes;
+		_hugePageBytesValid = true;
+	}
+	return _hugePageBytesAvailable;
 }
 
 const char *
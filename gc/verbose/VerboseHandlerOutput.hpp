@@ -49,6 +49,12 @@ protected:
 	J9HookInterface** _mmPrivateHooks;  /**< Pointers to the internal Hook interface */
 	J9HookInterface** _mmOmrHooks;  /**< Pointers to the internal Hook interface */
 	MM_VerboseManager *_manager; /* VerboseManager used to format and print output */
+	uintptr_t _hugePageBytes; /**< heap huge page coverage at the last sample */
+	uintptr_t _hugePageBytesCollectionCount; /**< collection count at the last huge page coverage sample */
+	uintptr_t _hugePageBytesActiveSize; /**< active heap size at the last huge page coverage sample */
+	uintptr_t _hugePageBytesReleasedBytes; /**< total idle released bytes at the last huge page coverage sample */
+	bool _hugePageBytesValid; /**< true once the huge page coverage has been sampled */
+	bool _hugePageBytesAvailable; /**< true if the last sample measured the coverage of a heap which can be backed by huge pages */
 public:
 
 private:
@@ -184,6 +190,15 @@ protected:
 	 */
 	virtual void printAllocationStats(MM_EnvironmentBase* env);
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	/**
+	 * Print the TLH size and the refreshes since the previous collection of every allocating thread.
+	 * Only valid when the allocation interfaces are TLH based.
+	 * @param env current Env
+	 */
+	void printTLHSizing(MM_EnvironmentBase* env);
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+
 	/**
 	 * Called before outputting verbose data which is intended to be logically atomic.  Most implementations do nothing with this
 	 * call but some might need to lock if they permit concurrent event reporting.
@@ -221,6 +236,17 @@ protected:
 	 */
 	void outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t indent, HeapResizeType resizeType, uintptr_t resizeAmount, uintptr_t resizeCount, uintptr_t subSpaceType, uintptr_t reason, uint64_t timeInMicroSeconds);
 
+	/**
+	 * Measure how much of the heap is currently backed by huge pages. Reads the process memory
+	 * map, so it is only done when a heap huge page policy was requested, and the sample is
+	 * reused until a collection completes or the heap is resized or released, so the several
+	 * resize stanzas of one collection share a single read. The coverage is left in _hugePageBytes.
+	 * @param env current Env
+	 * @return true if the coverage was measured, false if no policy was requested, the platform
+	 * cannot tell, or the heap cannot be backed by huge pages (such as when THP is disabled)
+	 */
+	bool isHeapHugePageCoverageAvailable(MM_EnvironmentBase *env);
+
 	/**
 	 * Output an embedded stanza for collector heap resize events.
 	 * @param env GC thread used for output.
@@ -24,6 +24,7 @@
 #define VERBOSEWRITER_HPP_
 
 #include "omrcfg.h"
+#include "omrstdarg.h"
 #include "modronbase.h"
 
 #include "Base.hpp"
@@ -35,7 +36,9 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 7
 } WriterType;
 
 /**
@@ -69,6 +72,24 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Writers which encode each line from its format string and arguments, rather than from its text,
+	 * return true. They are given the lines output through the writer chain with outputFormat(), and only
+	 * text written straight into the chain's buffer with outputString().
+	 */
+	virtual bool encodesFormat() { return false; }
+
+	/**
+	 * Output one line, as it would be formatted by omrstr_vprintf().
+	 * @param indent[in] the indent level of the line
+	 */
+	virtual void outputFormat(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args) {}
+
+	/**
+	 * Complete the output of the lines given to outputFormat() since the previous flush.
+	 */
+	virtual void flushFormat(MM_EnvironmentBase *env) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
@@ -36,6 +36,7 @@ MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
 	,_writers(NULL)
+	,_encodedSize(0)
 {}
 
 MM_VerboseWriterChain *
@@ -58,21 +59,65 @@ void
 MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent, const char *format, ...)
 {
 	va_list args;
+	bool needsText = false;
 
-	va_start(args, format);
-	_buffer->formatAndOutputV(env, indent, format, args);
-	va_end(args);
+	outputUnencoded(env);
+
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		if (writer->encodesFormat()) {
+			va_start(args, format);
+			writer->outputFormat(env, indent, format, args);
+			va_end(args);
+		} else {
+			needsText = true;
+		}
+		writer = writer->getNextWriter();
+	}
+
+	if (needsText) {
+		va_start(args, format);
+		_buffer->formatAndOutputV(env, indent, format, args);
+		va_end(args);
+	}
+	_encodedSize = _buffer->currentSize();
 }
 
 void
 MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
+	outputUnencoded(env);
+
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (writer->encodesFormat()) {
+			writer->flushFormat(env);
+		} else {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
+	_encodedSize = 0;
+}
+
+/**
+ * Give the writers which encode formats the text written straight into the buffer (such as the
+ * initialized stanza) since the last line they were given, so they see it in order.
+ */
+void
+MM_VerboseWriterChain::outputUnencoded(MM_EnvironmentBase *env)
+{
+	if (_encodedSize < _buffer->currentSize()) {
+		MM_VerboseWriter* writer = _writers;
+		while (NULL != writer) {
+			if (writer->encodesFormat()) {
+				writer->outputString(env, _buffer->contents() + _encodedSize);
+			}
+			writer = writer->getNextWriter();
+		}
+		_encodedSize = _buffer->currentSize();
+	}
 }
 
 void
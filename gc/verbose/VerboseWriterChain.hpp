@@ -36,7 +36,8 @@ class MM_VerboseWriter;
 
 /**
  * This class manages a list of writers. It formats and buffers output, flushing it
- * to the writers when asked.
+ * to the writers when asked. Writers which encode formats are given each line's format
+ * and arguments instead, and the chain only formats lines if another writer needs them.
  */
 class MM_VerboseWriterChain : public MM_Base
 {
@@ -45,6 +46,7 @@ protected:
 private:
 	MM_VerboseBuffer *_buffer;
 	MM_VerboseWriter *_writers;
+	uintptr_t _encodedSize; /**< bytes at the start of _buffer already given to the writers which encode formats */
 
 public:
 	static MM_VerboseWriterChain *newInstance(MM_EnvironmentBase *env);
@@ -79,6 +81,7 @@ protected:
 	void tearDown(MM_EnvironmentBase *env);
 	bool initialize(MM_EnvironmentBase* env);
 private:
+	void outputUnencoded(MM_EnvironmentBase *env);
 };
 
 #endif /* VERBOSEWRITERCHAIN_HPP_ */
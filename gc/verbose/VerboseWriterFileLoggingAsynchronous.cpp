@@ -0,0 +1,480 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrutil.h"
+
+#include "modronapicore.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+/* Smallest ring the writer will run with */
+#define VERBOSE_ASYNCHRONOUS_MINIMUM_RING_SIZE 4096
+/* How long the flush thread sleeps when it has not been woken to write */
+#define VERBOSE_ASYNCHRONOUS_FLUSH_INTERVAL_MILLIS 100
+
+extern "C" {
+
+/**
+ * Verbose flush thread procedure
+ *
+ * @parm info Address of the MM_VerboseWriterFileLoggingAsynchronous
+ */
+static int J9THREAD_PROC
+verbose_flush_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->threadEntryPoint();
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_logFileDescriptor(-1)
+	,_ring(NULL)
+	,_ringSize(0)
+	,_head(0)
+	,_tail(0)
+	,_pendingDropped(0)
+	,_droppedRecords(0)
+	,_rotationBuffer(NULL)
+	,_monitor(NULL)
+	,_threadActive(false)
+	,_shutdownRequested(false)
+	,_threadTerminated(false)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance.
+ * The ring, rotation buffer and monitor survive reconfiguration; the file and the flush thread do not.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL == _ring) {
+		_ringSize = VERBOSE_ASYNCHRONOUS_MINIMUM_RING_SIZE;
+		while (_ringSize < extensions->asynchronousLoggingBufferSize) {
+			_ringSize <<= 1;
+		}
+		_ring = (uint8_t *)extensions->getForge()->allocate(_ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _ring) {
+			return false;
+		}
+	}
+
+	if (NULL == _rotationBuffer) {
+		_rotationBuffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL == _rotationBuffer) {
+			return false;
+		}
+	}
+
+	if (NULL == _monitor) {
+		if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingAsynchronous")) {
+			_monitor = NULL;
+			return false;
+		}
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	/* if the thread can not be started, output is written synchronously instead */
+	startFlushThread(env);
+
+	return true;
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the flush thread and frees the ring.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL != _monitor) {
+		closeFile(env);
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+	if (NULL != _rotationBuffer) {
+		_rotationBuffer->kill(env);
+		_rotationBuffer = NULL;
+	}
+	if (NULL != _ring) {
+		extensions->getForge()->free(_ring);
+		_ring = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startFlushThread(MM_EnvironmentBase *env)
+{
+	omrthread_t thread = NULL;
+
+	omrthread_monitor_enter(_monitor);
+	_shutdownRequested = false;
+	_threadTerminated = false;
+	intptr_t threadForkResult = createThreadWithCategory(&thread,
+						OMR_OS_STACK_SIZE,
+						J9THREAD_PRIORITY_NORMAL,
+						0,
+						verbose_flush_thread_proc,
+						(void *)this,
+						J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == threadForkResult) {
+		while (!_threadActive && !_threadTerminated) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return _threadActive;
+}
+
+/**
+ * Ask the flush thread to write out the ring and terminate, and wait for it to do so.
+ * The file is left open; it belongs to the calling thread again afterwards.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopFlushThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if (_threadActive) {
+		_shutdownRequested = true;
+		omrthread_monitor_notify_all(_monitor);
+		while (!_threadTerminated) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::threadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_monitor);
+	_threadActive = true;
+	omrthread_monitor_notify_all(_monitor);
+	while (!_shutdownRequested) {
+		omrthread_monitor_exit(_monitor);
+		drain(&env);
+		omrthread_monitor_enter(_monitor);
+		if (!_shutdownRequested && (_head == _tail)) {
+			omrthread_monitor_wait_timed(_monitor, VERBOSE_ASYNCHRONOUS_FLUSH_INTERVAL_MILLIS, 0);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+
+	/* records queued before shutdown was requested */
+	drain(&env);
+
+	omrthread_monitor_enter(_monitor);
+	_threadActive = false;
+	_threadTerminated = true;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::enqueue(MM_EnvironmentBase *env, uint32_t type, const char *payload, uintptr_t length)
+{
+	uintptr_t recordSize = sizeof(RecordHeader) + MM_Math::roundToCeiling(sizeof(RecordHeader), length);
+	uintptr_t head = _head;
+	uintptr_t offset = head & (_ringSize - 1);
+	uintptr_t padding = 0;
+	if ((_ringSize - offset) < recordSize) {
+		/* records never wrap: pad out the end of the ring and start again at the beginning */
+		padding = _ringSize - offset;
+	}
+
+	uintptr_t tail = _tail;
+	/* the space behind the tail must not be overwritten until the flush thread has finished reading it */
+	MM_AtomicOperations::readWriteBarrier();
+	uintptr_t used = head - tail;
+	if ((padding + recordSize) > (_ringSize - used)) {
+		_pendingDropped += 1;
+		_droppedRecords += 1;
+		return false;
+	}
+
+	if (0 != padding) {
+		RecordHeader *pad = (RecordHeader *)(_ring + offset);
+		pad->type = RECORD_PADDING;
+		pad->length = 0;
+		pad->dropped = 0;
+		offset = 0;
+	}
+
+	RecordHeader *record = (RecordHeader *)(_ring + offset);
+	record->type = type;
+	record->length = (uint32_t)length;
+	record->dropped = _pendingDropped;
+	memcpy(record + 1, payload, length);
+	_pendingDropped = 0;
+
+	/* publish the record before the cursor which makes it visible */
+	MM_AtomicOperations::writeBarrier();
+	_head = head + padding + recordSize;
+
+	/* wake the flush thread for a rotation, or once the ring crosses half full, rather than for every record */
+	uintptr_t half = _ringSize / 2;
+	uintptr_t usedAfter = used + padding + recordSize;
+	if ((RECORD_ROTATE == type) || ((used <= half) && (usedAfter > half))) {
+		omrthread_monitor_enter(_monitor);
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drain(MM_EnvironmentBase *env)
+{
+	uintptr_t tail = _tail;
+	uintptr_t head = _head;
+	/* read records only after seeing the cursor which published them */
+	MM_AtomicOperations::readBarrier();
+
+	while (tail != head) {
+		uintptr_t offset = tail & (_ringSize - 1);
+		RecordHeader *record = (RecordHeader *)(_ring + offset);
+		uintptr_t recordSize = 0;
+
+		if (RECORD_PADDING == record->type) {
+			recordSize = _ringSize - offset;
+		} else {
+			const char *payload = (const char *)(record + 1);
+			recordSize = sizeof(RecordHeader) + MM_Math::roundToCeiling(sizeof(RecordHeader), record->length);
+			if (0 != record->dropped) {
+				writeDropped(env, record->dropped);
+			}
+			if (RECORD_ROTATE == record->type) {
+				closeLogFile(env);
+				_currentFile = (_currentFile + 1) % _numFiles;
+				openFile(env);
+			}
+			writeText(env, payload, record->length);
+		}
+
+		tail += recordSize;
+		/* finish reading the record before the producer may reuse its space */
+		MM_AtomicOperations::readWriteBarrier();
+		_tail = tail;
+	}
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	omrfile_printf(_logFileDescriptor, getHeader(env), version);
+	/* Print an Initialized Stanza in new file (the flush thread writes the one queued with the rotation instead) */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			omrfile_write_text(_logFileDescriptor, buffer->contents(), buffer->currentSize());
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Stops the flush thread once it has written out the ring, then prints the footer and closes the file
+ * being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	stopFlushThread(env);
+
+	if (0 != _pendingDropped) {
+		writeDropped(env, _pendingDropped);
+		_pendingDropped = 0;
+	}
+	closeLogFile(env);
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeLogFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeText(MM_EnvironmentBase *env, const char *text, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/**
+		 * Under normal circumstances, new file should be opened during rotation.
+		 * This path works as one backup, in case we failed to open the file,  we’ll attempt to open it again before outputting the string.
+		 */
+		openFile(env);
+	}
+
+	if(-1 != _logFileDescriptor){
+		omrfile_write_text(_logFileDescriptor, text, length);
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, text, length);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeDropped(MM_EnvironmentBase *env, uintptr_t dropped)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	char comment[128];
+
+	uintptr_t length = omrstr_printf(comment, sizeof(comment), "<!-- %zu verbose records dropped: the asynchronous logging buffer was full -->\n", dropped);
+	writeText(env, comment, length);
+}
+
+/**
+ * Queue the string for the flush thread. Only the copy into the ring is done on the calling thread.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	if (_threadActive) {
+		enqueue(env, RECORD_TEXT, string, strlen(string));
+	} else {
+		/* no flush thread (it could not be started, or the stream has been closed): write synchronously */
+		writeText(env, string, strlen(string));
+	}
+}
+
+/**
+ * Queue a file rotation if this cycle completes the current file. The initialized stanza for the next file
+ * is formatted here, so that its id is allocated in order with the other stanzas, and the flush thread
+ * closes and opens the files.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	if (!_threadActive) {
+		MM_VerboseWriterFileLogging::endOfCycle(env);
+	} else if ((0 != _numFiles) && (0 != _numCycles)) {
+		_currentCycle = (_currentCycle + 1) % _numCycles;
+		if (0 == _currentCycle) {
+			_rotationBuffer->reset();
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, _rotationBuffer);
+			enqueue(env, RECORD_ROTATE, _rotationBuffer->contents(), _rotationBuffer->currentSize());
+		}
+	}
+}
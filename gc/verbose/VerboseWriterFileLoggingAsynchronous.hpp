@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+class MM_VerboseBuffer;
+
+/**
+ * Output agent which directs verbosegc output to file from a dedicated flush thread.
+ *
+ * outputString() only copies the formatted stanza into a preallocated ring and endOfCycle() only queues
+ * a rotation record, so the GC thread never blocks on the file system. The flush thread writes the ring
+ * out and performs file rotation. Producers are already serialized by the writer chain (they share its
+ * formatting buffer), so the ring has a single producer and a single consumer and needs no lock: each
+ * side publishes its cursor with a barrier. If the ring is full the record is dropped and counted, and
+ * the number dropped is written as a comment in front of the next record that fits.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * Header of each record in the ring. Records start on a RecordHeader boundary, and a record
+	 * never wraps: the unused tail of the ring is covered by a padding record instead.
+	 */
+	struct RecordHeader {
+		uint32_t type; /**< one of the record types below */
+		uint32_t length; /**< payload bytes following the header */
+		uint32_t dropped; /**< records dropped immediately before this one */
+		uint32_t reserved;
+	};
+
+	enum {
+		RECORD_TEXT = 0, /**< verbose output, written to the current file */
+		RECORD_ROTATE, /**< end of a file: the payload is the initialized stanza for the next one */
+		RECORD_PADDING /**< skip to the start of the ring */
+	};
+
+	OMR_VM *_omrVM; /**< the VM the flush thread builds its environment from */
+	intptr_t _logFileDescriptor; /**< the file being written to, owned by the flush thread while it runs */
+
+	uint8_t *_ring; /**< record storage, _ringSize bytes */
+	uintptr_t _ringSize; /**< power of two */
+	volatile uintptr_t _head; /**< bytes ever written into the ring, advanced by the producer only */
+	volatile uintptr_t _tail; /**< bytes ever consumed from the ring, advanced by the flush thread only */
+	uint32_t _pendingDropped; /**< records dropped since the last record which was queued (producer only) */
+	volatile uintptr_t _droppedRecords; /**< total records dropped because the ring was full */
+
+	MM_VerboseBuffer *_rotationBuffer; /**< buffer the initialized stanza for the next file is formatted into */
+
+	omrthread_monitor_t _monitor; /**< the flush thread waits on this between flushes */
+	volatile bool _threadActive; /**< the flush thread owns the file and drains the ring */
+	volatile bool _shutdownRequested;
+	volatile bool _threadTerminated;
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of records dropped so far because the ring was full
+	 */
+	MMINLINE uintptr_t getDroppedRecords() { return _droppedRecords; }
+
+	void threadEntryPoint();
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool startFlushThread(MM_EnvironmentBase *env);
+	void stopFlushThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Copy a record into the ring and wake the flush thread if the ring is getting full.
+	 * @return true if the record was queued, false if it was dropped
+	 */
+	bool enqueue(MM_EnvironmentBase *env, uint32_t type, const char *payload, uintptr_t length);
+
+	/**
+	 * Write out every record queued so far. Called by the flush thread, or by the closing thread once the
+	 * flush thread has stopped.
+	 */
+	void drain(MM_EnvironmentBase *env);
+
+	void closeLogFile(MM_EnvironmentBase *env);
+	void writeText(MM_EnvironmentBase *env, const char *text, uintptr_t length);
+	void writeDropped(MM_EnvironmentBase *env, uintptr_t dropped);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
@@ -23,12 +23,20 @@
 #include "omrcfg.h"
 
 #include "omrgcconsts.h"
+#include "omrmodroncore.h"
 #include "gcutils.h"
 
+#include "ClassHistogram.hpp"
 #include "ConcurrentGCStats.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "GlobalAllocationManagerSegregated.hpp"
+#include "SizeClasses.hpp"
+#include "SizeClassStatsSegregated.hpp"
+#endif /* OMR_GC_SEGREGATED_HEAP */
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -287,6 +295,53 @@ MM_VerboseHandlerOutputStandard::handleGCOPOuterStanzaEnd(MM_EnvironmentBase* en
 	writer->formatAndOutput(env, 0, "</gc-op>");
 }
 
+bool
+MM_VerboseHandlerOutputStandard::outputAdaptiveThreadCount(MM_EnvironmentBase *env, uintptr_t indent, uintptr_t vmStateID)
+{
+	MM_ParallelDispatcher::AdaptiveThreadCountModel *model = _extensions->dispatcher->getAdaptiveThreadCountModel(vmStateID);
+	if (NULL == model) {
+		return false;
+	}
+
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	writer->formatAndOutput(env, indent, "<thread-count chosen=\"%zu\" maximum=\"%zu\" workvolume=\"%zu\" workrate=\"%zu\" threadstartus=\"%zu\" />",
+			model->threadCount, model->maximumThreadCount, (uintptr_t)model->decisionWorkVolume, (uintptr_t)model->decisionWorkRate,
+			(uintptr_t)(model->decisionThreadStartCost * 1000.0f));
+	return true;
+}
+
+void
+MM_VerboseHandlerOutputStandard::outputTaskDispatchStats(MM_EnvironmentBase *env, uintptr_t indent, MM_TaskDispatchStats *stats)
+{
+	if (!_extensions->dispatcherParkWorkers || (0 == stats->_taskCount)) {
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	writer->formatAndOutput(env, indent, "<task-dispatch tasks=\"%zu\" startlatencyus=\"%llu\" maxstartlatencyus=\"%llu\" spinwakeups=\"%zu\" parkwakeups=\"%zu\" />",
+			stats->_taskCount,
+			omrtime_hires_delta(0, stats->_startLatency, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			omrtime_hires_delta(0, stats->_maxStartLatency, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			stats->_spinWakeups, stats->_parkWakeups);
+}
+
+void
+MM_VerboseHandlerOutputStandard::outputClassHistogram(MM_EnvironmentBase *env, uintptr_t indent, MM_ClassHistogram *histogram)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	MM_ClassHistogram::Entry top[CLASSHISTOGRAM_CLASSES];
+	uintptr_t count = histogram->getTopClasses(top, OMR_MIN(extensions->markingClassHistogramTopK, (uintptr_t)CLASSHISTOGRAM_CLASSES));
+
+	writer->formatAndOutput(env, indent, "<class-histogram classes=\"%zu\" objects=\"%zu\" bytes=\"%zu\" otherobjects=\"%zu\" otherbytes=\"%zu\">",
+			histogram->getClassCount(), histogram->getObjects(), histogram->getBytes(), histogram->getOtherObjects(), histogram->getOtherBytes());
+	for (uintptr_t i = 0; i < count; i++) {
+		writer->formatAndOutput(env, indent + 1, "<class key=\"0x%zx\" objects=\"%zu\" bytes=\"%zu\" />", top[i].classKey, top[i].objects, top[i].bytes);
+	}
+	writer->formatAndOutput(env, indent, "</class-histogram>");
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
 {
@@ -304,6 +359,18 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (extensions->packetListLockFree) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<packet-lists casretries=\"%zu\" shardmisses=\"%zu\" />",
+				workPacketStats->packetListCASRetries, workPacketStats->packetListShardMisses);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	outputAdaptiveThreadCount(env, 1, OMRVMSTATE_GC_MARK);
+	outputTaskDispatchStats(env, 1, &extensions->globalGCStats.taskDispatchStats);
+	if (extensions->markingClassHistogram) {
+		outputClassHistogram(env, 1, &extensions->globalGCStats.classHistogram);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -328,13 +395,65 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
-	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	bool concurrentSweep = false;
+	bool sizeClassStats = false;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	concurrentSweep = extensions->isSegregatedHeap() && extensions->segregatedConcurrentSweep;
+	sizeClassStats = extensions->isSegregatedHeap() && extensions->segregatedSizeClassStats;
+#endif /* OMR_GC_SEGREGATED_HEAP */
 
-	handleSweepEndInternal(env, eventData);
+	enterAtomicReportingBlock();
+	if (concurrentSweep || sizeClassStats || (NULL != extensions->dispatcher->getAdaptiveThreadCountModel(OMRVMSTATE_GC_SWEEP))) {
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		outputAdaptiveThreadCount(env, 1, OMRVMSTATE_GC_SWEEP);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		if (concurrentSweep) {
+			/* how the regions left unswept by the previous pause were reclaimed */
+			getManager()->getWriterChain()->formatAndOutput(env, 1, "<concurrent-sweep ondemandregions=\"%zu\" backgroundregions=\"%zu\" unsweptregions=\"%zu\" />",
+					sweepStats->concurrentSweepOnDemandRegions, sweepStats->concurrentSweepBackgroundRegions, sweepStats->concurrentSweepUnsweptRegions);
+		}
+		if (sizeClassStats) {
+			outputSizeClassStats(env, 1);
+		}
+#endif /* OMR_GC_SEGREGATED_HEAP */
+		handleSweepEndInternal(env, eventData);
+		handleGCOPOuterStanzaEnd(env);
+		getManager()->getWriterChain()->flush(env);
+	} else {
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		handleSweepEndInternal(env, eventData);
+	}
 	exitAtomicReportingBlock();
 }
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+void
+MM_VerboseHandlerOutputStandard::outputSizeClassStats(MM_EnvironmentBase* env, uintptr_t indent)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	MM_SizeClassStatsSegregated stats;
+
+	((MM_GlobalAllocationManagerSegregated *)extensions->globalAllocationManager)->getSizeClassStats(env, &stats);
+
+	writer->formatAndOutput(env, indent, "<size-class-stats>");
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		/* size classes that were neither allocated into nor swept are left out */
+		if ((0 != stats.allocatedCells[sizeClass])
+			|| (0 != (stats.fullRegions[sizeClass] + stats.partiallyFreeRegions[sizeClass] + stats.freedRegions[sizeClass]))
+			|| (0 != (stats.regionFlipsIn[sizeClass] + stats.regionFlipsOut[sizeClass]))
+		) {
+			writer->formatAndOutput(env, indent + 1, "<size-class id=\"%zu\" cellsize=\"%zu\" allocatedcells=\"%zu\" livecells=\"%zu\" fullregions=\"%zu\" partiallyfreeregions=\"%zu\" freedregions=\"%zu\" flipsin=\"%zu\" flipsout=\"%zu\" />",
+					sizeClass, extensions->defaultSizeClasses->getCellSize(sizeClass),
+					stats.allocatedCells[sizeClass], stats.liveCells[sizeClass],
+					stats.fullRegions[sizeClass], stats.partiallyFreeRegions[sizeClass], stats.freedRegions[sizeClass],
+					stats.regionFlipsIn[sizeClass], stats.regionFlipsOut[sizeClass]);
+		}
+	}
+	writer->formatAndOutput(env, indent, "</size-class-stats>");
+}
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 void
 MM_VerboseHandlerOutputStandard::handleSweepEndInternal(MM_EnvironmentBase* env, void* eventData)
 {
@@ -377,12 +496,16 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	handleGCOPOuterStanzaStart(env, "compact", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
-		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
-				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" livebytes=\"%zu\" usperlivegb=\"%llu\" mode=\"%s\" reason=\"%s\" />",
+				compactStats->_movedObjects, compactStats->_movedBytes, compactStats->_liveBytes,
+				deltaTimeSuccess ? compactStats->getMicrosecondsPerLiveGB(duration) : 0,
+				compactStats->_sliding ? "sliding" : "subarea",
+				getCompactionReasonAsString(compactStats->_compactReason));
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
 	}
+	outputAdaptiveThreadCount(env, 1, OMRVMSTATE_GC_COMPACT);
 
 	handleCompactEndInternal(env, eventData);
 
@@ -437,6 +560,25 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (extensions->scavengerWorkStealing && !extensions->isConcurrentScavengerEnabled()) {
+		uint64_t idleMicros = omrtime_hires_delta(0, scavengerStats->_scanCacheIdleTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->formatAndOutput(env, 1, "<work-stealing attempts=\"%zu\" successes=\"%zu\" idlems=\"%llu.%03.3llu\" />",
+				scavengerStats->_scanCacheStealAttempts, scavengerStats->_scanCacheStealSuccesses, idleMicros / 1000, idleMicros % 1000);
+	}
+	if (NULL != extensions->rememberedSetCardTable) {
+		uint64_t scanMicros = omrtime_hires_delta(0, scavengerStats->_rememberedSetScanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->formatAndOutput(env, 1, "<remembered-set-cards dirtycards=\"%zu\" objects=\"%zu\" scanms=\"%llu.%03.3llu\" />",
+				scavengerStats->_rememberedSetDirtyCards, scavengerStats->_rememberedSetObjectsScanned, scanMicros / 1000, scanMicros % 1000);
+	}
+	if (extensions->scavengerHotFieldDiscovery && (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == extensions->scavengerScanOrdering)) {
+		writer->formatAndOutput(env, 1, "<hot-fields samples=\"%zu\" lookups=\"%zu\" hits=\"%zu\" classes=\"%zu\" hotclasses=\"%zu\" />",
+				scavengerStats->_hotFieldSamples, scavengerStats->_hotFieldLookups, scavengerStats->_hotFieldHits,
+				cycleScavengerStats->_hotFieldClasses, cycleScavengerStats->_hotFieldHotClasses);
+	}
+	if (!extensions->isConcurrentScavengerEnabled()) {
+		outputAdaptiveThreadCount(env, 1, OMRVMSTATE_GC_SCAVENGE);
+	}
+	outputTaskDispatchStats(env, 1, &scavengerStats->_taskDispatchStats);
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -565,8 +707,8 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 	handleGCOPOuterStanzaStart(env, "card-cleaning", env->_cycleState->_verboseContextID, durationUs, true);
 
 	writer->formatAndOutput(
-			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
-			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
+			env, 1, "<card-cleaning cardsCleaned=\"%zu\" cardsScanned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
+			event->finalcleanedCards, event->finalScannedCards, event->bytesTraced, event->workStackOverflowCount);
 
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
@@ -695,7 +837,7 @@ MM_VerboseHandlerOutputStandard::handleConcurrentHalted(J9HookInterface** hook,
 			event->traceTarget, event->tracedTotal,
 			event->tracedByMutators, event->tracedByHelpers,
 			event->traceTarget == 0 ? 0 : (uintptr_t)(((uint64_t)event->tracedTotal * 100) / (uint64_t)event->traceTarget));
-	writer->formatAndOutput(env, 1, "<cards cleaned=\"%zu\" thresholdBytes=\"%zu\" />", event->cardsCleaned, event->cardCleaningThreshold);
+	writer->formatAndOutput(env, 1, "<cards cleaned=\"%zu\" scanned=\"%zu\" thresholdBytes=\"%zu\" />", event->cardsCleaned, event->cardsScanned, event->cardCleaningThreshold);
 	writer->formatAndOutput(env, 0, "</concurrent-halted>");
 	writer->flush(env);
 
@@ -753,6 +895,13 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCollectionStart(J9HookInterface
 		tagTemplate, deltaTime / 1000, deltaTime % 1000);
 	writer->formatAndOutput(env, 1, "<concurrent-trace-info reason=\"%s\" tracedByMutators=\"%zu\" tracedByHelpers=\"%zu\" cardsCleaned=\"%zu\" workStackOverflowCount=\"%zu\" />",
 		cardCleaningReasonString, event->tracedByMutators, event->tracedByHelpers, event->cardsCleaned, event->workStackOverflowCount);
+	if (_extensions->concurrentHelperPacing) {
+		/* how the concurrent work of the cycle was split between allocation tax and the helper threads */
+		writer->formatAndOutput(env, 1, "<concurrent-tax mutatortraced=\"%zu\" mutatorcleaned=\"%zu\" helpertraced=\"%zu\" helpercleaned=\"%zu\" fallbacks=\"%zu\" />",
+			event->tracedByMutators - event->cleanedByMutators, event->cleanedByMutators,
+			event->tracedByHelpers - event->cleanedByHelpers, event->cleanedByHelpers,
+			event->pacingFallbacks);
+	}
   	writer->formatAndOutput(env, 0, "</concurrent-collection-start>");
 
 	writer->flush(env);
@@ -29,8 +29,10 @@
 #include "VerboseHandlerOutput.hpp"
 #include "CollectionStatisticsStandard.hpp"
 
+class MM_ClassHistogram;
 class MM_CollectionStatistics;
 class MM_EnvironmentBase;
+class MM_TaskDispatchStats;
 
 class MM_VerboseHandlerOutputStandard : public MM_VerboseHandlerOutput
 {
@@ -56,6 +58,33 @@ protected:
 	void handleGCOPOuterStanzaStart(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess);
 	void handleGCOPOuterStanzaEnd(MM_EnvironmentBase* env);
 
+	/**
+	 * Output the thread count chosen for the task of the given VM state by the adaptive thread count model, and the model inputs.
+	 * @param[IN] vmStateID the VM state of the task
+	 * @return true if an element was output (adaptiveGCThreadCount is enabled and a task of this type has been dispatched)
+	 */
+	bool outputAdaptiveThreadCount(MM_EnvironmentBase *env, uintptr_t indent, uintptr_t vmStateID);
+
+	/**
+	 * Output the start latency of the parallel tasks dispatched by an operation (dispatcherParkWorkers only).
+	 * @param[IN] stats the task dispatch stats of the operation
+	 */
+	void outputTaskDispatchStats(MM_EnvironmentBase *env, uintptr_t indent, MM_TaskDispatchStats *stats);
+
+	/**
+	 * Output the census of the objects left marked by the mark, premarked and allocated marked objects
+	 * included, with the classes holding the most live bytes.
+	 * @param[IN] histogram the merged census of the mark
+	 */
+	void outputClassHistogram(MM_EnvironmentBase *env, uintptr_t indent, MM_ClassHistogram *histogram);
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	/**
+	 * Output the per size class counters of the segregated heap published at the end of the sweep.
+	 */
+	void outputSizeClassStats(MM_EnvironmentBase *env, uintptr_t indent);
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 	virtual bool hasOutputMemoryInfoInnerStanza();
 	virtual void outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
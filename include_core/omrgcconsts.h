@@ -423,7 +423,8 @@ typedef enum {
 	SCAV_RATIO_TOO_LOW,
 	HEAP_RESIZE,
 	SATISFY_EXPAND,
-	FORCED_NURSERY_CONTRACT
+	FORCED_NURSERY_CONTRACT,
+	FORECAST_GC_OVERHEAD_TOO_LOW
 } ContractReason;
 
 typedef enum {
@@ -434,7 +435,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	FORECAST_GC_OVERHEAD_TOO_HIGH
 } ExpandReason;
 
 typedef enum {
@@ -0,0 +1,524 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Decode the binary verbose GC logs written with -Xgc:binaryLogging.
+ *
+ * usage: omrverbosegcdecoder [-xml | -csv | -stats] [file ...]
+ *  -xml   write the log back as XML (default)
+ *  -csv   write one row per attribute: record,depth,element,attribute,value
+ *  -stats summarize the pause times (exclusive-end) and collection times (gc-end, by type)
+ * Without files, every binary VerboseGC* file in the current directory is decoded. Files are decoded in
+ * chunks as they are read, so the memory needed does not depend on the size of the log.
+ */
+
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "VerboseBinaryDecoder.hpp"
+
+const char* SRC_DIR = "./";
+const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
+
+#define READ_BUFFER_SIZE (64 * 1024)
+#define OUTPUT_FLUSH_SIZE (64 * 1024)
+
+/**
+ * Base class of the output modes: buffers the output and writes it to stdout in large chunks.
+ */
+class OutputListener : public MM_VerboseBinaryDecoder::Listener
+{
+public:
+	virtual ~OutputListener() {}
+
+	/**
+	 * Called once a file has been decoded.
+	 */
+	virtual void
+	finish(const char *fileName)
+	{
+		flush();
+	}
+
+	void
+	flush()
+	{
+		fwrite(_output.data(), 1, _output.size(), stdout);
+		_output.clear();
+	}
+
+protected:
+	std::string _output;
+
+	void
+	flushIfFull()
+	{
+		if (_output.size() >= OUTPUT_FLUSH_SIZE) {
+			flush();
+		}
+	}
+};
+
+/**
+ * Write the XML back, one element or text per line, indented two spaces per level below the root.
+ */
+class XMLOutput : public OutputListener
+{
+public:
+	virtual void
+	startElement(const char *name, uintptr_t depth, const MM_VerboseBinaryDecoder::Attribute *attributes, uintptr_t attributeCount, bool isEmpty)
+	{
+		indent(depth);
+		_output += "<";
+		_output += name;
+		for (uintptr_t i = 0; i < attributeCount; i++) {
+			_output += " ";
+			_output += attributes[i].name;
+			_output += "=\"";
+			_output += attributes[i].value;
+			_output += "\"";
+		}
+		_output += isEmpty ? " />\n" : ">\n";
+		flushIfFull();
+	}
+
+	virtual void
+	endElement(const char *name, uintptr_t depth)
+	{
+		indent(depth);
+		_output += "</";
+		_output += name;
+		_output += ">\n";
+		flushIfFull();
+	}
+
+	virtual void
+	text(const char *text, uintptr_t length, uintptr_t depth)
+	{
+		indent(depth);
+		_output.append(text, length);
+		_output += "\n";
+		flushIfFull();
+	}
+
+private:
+	void
+	indent(uintptr_t depth)
+	{
+		if (depth > 1) {
+			_output.append(2 * (depth - 1), ' ');
+		}
+	}
+};
+
+/**
+ * Write one row per attribute, or per element without attributes, and one per text.
+ */
+class CSVOutput : public OutputListener
+{
+public:
+	CSVOutput() : _record(0)
+	{
+		_output += "record,depth,element,attribute,value\n";
+	}
+
+	virtual void
+	startElement(const char *name, uintptr_t depth, const MM_VerboseBinaryDecoder::Attribute *attributes, uintptr_t attributeCount, bool isEmpty)
+	{
+		_record += 1;
+		if (0 == attributeCount) {
+			row(depth, name, strlen(name), "", "", 0);
+		}
+		for (uintptr_t i = 0; i < attributeCount; i++) {
+			row(depth, name, strlen(name), attributes[i].name, attributes[i].value, strlen(attributes[i].value));
+		}
+		flushIfFull();
+	}
+
+	virtual void
+	endElement(const char *name, uintptr_t depth)
+	{
+	}
+
+	virtual void
+	text(const char *text, uintptr_t length, uintptr_t depth)
+	{
+		_record += 1;
+		row(depth, "#text", 5, "", text, length);
+		flushIfFull();
+	}
+
+private:
+	uint64_t _record;
+
+	void
+	row(uintptr_t depth, const char *element, uintptr_t elementLength, const char *attribute, const char *value, uintptr_t valueLength)
+	{
+		char number[64];
+		snprintf(number, sizeof(number), "%llu,%llu,", (unsigned long long)_record, (unsigned long long)depth);
+		_output += number;
+		field(element, elementLength);
+		_output += ",";
+		field(attribute, strlen(attribute));
+		_output += ",";
+		field(value, valueLength);
+		_output += "\n";
+	}
+
+	/**
+	 * Append a field, quoted if it contains a separator, a quote or a line break.
+	 */
+	void
+	field(const char *value, uintptr_t length)
+	{
+		bool quote = false;
+		for (uintptr_t i = 0; i < length; i++) {
+			char c = value[i];
+			if ((',' == c) || ('"' == c) || ('\n' == c) || ('\r' == c)) {
+				quote = true;
+				break;
+			}
+		}
+		if (!quote) {
+			_output.append(value, length);
+			return;
+		}
+		_output += "\"";
+		for (uintptr_t i = 0; i < length; i++) {
+			if ('"' == value[i]) {
+				_output += "\"";
+			}
+			_output += value[i];
+		}
+		_output += "\"";
+	}
+};
+
+/**
+ * Log-linear histogram of durations in microseconds: exact below 32us, then 16 buckets per power of two, so a
+ * percentile is reported within 1/16 of its value whatever the number of samples.
+ */
+class DurationHistogram
+{
+public:
+	DurationHistogram() : _count(0), _sum(0.0), _min(0.0), _max(0.0)
+	{
+		memset(_buckets, 0, sizeof(_buckets));
+	}
+
+	void
+	add(double ms)
+	{
+		if (0 == _count) {
+			_min = ms;
+			_max = ms;
+		} else {
+			_min = (ms < _min) ? ms : _min;
+			_max = (ms > _max) ? ms : _max;
+		}
+		_count += 1;
+		_sum += ms;
+		double us = ms * 1000.0;
+		_buckets[bucketOf((us < 1.0) ? 0 : (uint64_t)us)] += 1;
+	}
+
+	/**
+	 * @return the upper bound of the bucket holding the given percentile, in milliseconds
+	 */
+	double
+	percentile(double percent)
+	{
+		/* the smallest sample which at least percent of the samples do not exceed */
+		double exactRank = (percent / 100.0) * (double)_count;
+		uint64_t rank = (uint64_t)exactRank;
+		if ((double)rank < exactRank) {
+			rank += 1;
+		}
+		rank = (rank < 1) ? 1 : rank;
+		uint64_t seen = 0;
+		for (uintptr_t i = 0; i < BUCKETS; i++) {
+			seen += _buckets[i];
+			if (seen >= rank) {
+				double bound = (double)upperBoundOf(i) / 1000.0;
+				return (bound < _max) ? bound : _max;
+			}
+		}
+		return _max;
+	}
+
+	void
+	report(const char *name)
+	{
+		if (0 == _count) {
+			return;
+		}
+		printf("%-24s %10llu %12.3f %12.3f %12.3f %12.3f %12.3f %12.3f\n",
+			name, (unsigned long long)_count, _min, _sum / (double)_count, percentile(50.0), percentile(99.0), percentile(99.9), _max);
+	}
+
+private:
+	enum {
+		SUB_BUCKET_BITS = 4,
+		SUB_BUCKETS = 1 << SUB_BUCKET_BITS,
+		LINEAR_LIMIT = 2 * SUB_BUCKETS,
+		BUCKETS = LINEAR_LIMIT + ((64 - SUB_BUCKET_BITS - 1) * SUB_BUCKETS)
+	};
+
+	uint64_t _count;
+	double _sum;
+	double _min;
+	double _max;
+	uint64_t _buckets[BUCKETS];
+
+	static uintptr_t
+	highestBit(uint64_t value)
+	{
+		uintptr_t bit = 0;
+		while (value >>= 1) {
+			bit += 1;
+		}
+		return bit;
+	}
+
+	static uintptr_t
+	bucketOf(uint64_t us)
+	{
+		if (us < LINEAR_LIMIT) {
+			return (uintptr_t)us;
+		}
+		/* us >= 2^(SUB_BUCKET_BITS + 1): the bits below the highest one select one of SUB_BUCKETS buckets */
+		uintptr_t exponent = highestBit(us);
+		uintptr_t sub = (uintptr_t)(us >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+		return LINEAR_LIMIT + ((exponent - SUB_BUCKET_BITS - 1) * SUB_BUCKETS) + sub;
+	}
+
+	static uint64_t
+	upperBoundOf(uintptr_t bucket)
+	{
+		if (bucket < LINEAR_LIMIT) {
+			return bucket + 1;
+		}
+		uintptr_t exponent = ((bucket - LINEAR_LIMIT) / SUB_BUCKETS) + SUB_BUCKET_BITS + 1;
+		uint64_t sub = (bucket - LINEAR_LIMIT) % SUB_BUCKETS;
+		return ((uint64_t)(SUB_BUCKETS + sub + 1)) << (exponent - SUB_BUCKET_BITS);
+	}
+};
+
+/**
+ * Accumulate the pause times from exclusive-end and the collection times from gc-end as the records arrive.
+ */
+class StatsOutput : public OutputListener
+{
+public:
+	virtual void
+	startElement(const char *name, uintptr_t depth, const MM_VerboseBinaryDecoder::Attribute *attributes, uintptr_t attributeCount, bool isEmpty)
+	{
+		if (0 == strcmp(name, "exclusive-end")) {
+			const char *duration = find(attributes, attributeCount, "durationms");
+			if (NULL != duration) {
+				_pauses.add(strtod(duration, NULL));
+			}
+		} else if (0 == strcmp(name, "gc-end")) {
+			const char *duration = find(attributes, attributeCount, "durationms");
+			const char *type = find(attributes, attributeCount, "type");
+			if (NULL != duration) {
+				_collections[std::string("gc-end ") + ((NULL != type) ? type : "unknown")].add(strtod(duration, NULL));
+			}
+		}
+	}
+
+	virtual void endElement(const char *name, uintptr_t depth) {}
+	virtual void text(const char *text, uintptr_t length, uintptr_t depth) {}
+
+	virtual void
+	finish(const char *fileName)
+	{
+		printf("\nResults for : %s (times in ms)\n", fileName);
+		printf("%-24s %10s %12s %12s %12s %12s %12s %12s\n", "", "count", "min", "mean", "p50", "p99", "p99.9", "max");
+		_pauses.report("pause (exclusive)");
+		for (std::map<std::string, DurationHistogram>::iterator it = _collections.begin(); it != _collections.end(); ++it) {
+			it->second.report(it->first.c_str());
+		}
+		_pauses = DurationHistogram();
+		_collections.clear();
+	}
+
+private:
+	DurationHistogram _pauses;
+	std::map<std::string, DurationHistogram> _collections;
+
+	static const char *
+	find(const MM_VerboseBinaryDecoder::Attribute *attributes, uintptr_t attributeCount, const char *name)
+	{
+		for (uintptr_t i = 0; i < attributeCount; i++) {
+			if (0 == strcmp(attributes[i].name, name)) {
+				return attributes[i].value;
+			}
+		}
+		return NULL;
+	}
+};
+
+/**
+ * @return true if the file starts with the binary verbose GC magic
+ */
+static bool
+isBinaryLog(OMRPortLibrary *portLibrary, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint8_t magic[4];
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+	intptr_t bytesRead = omrfile_read(fd, magic, sizeof(magic));
+	omrfile_close(fd);
+	return (sizeof(magic) == bytesRead)
+		&& (VERBOSE_BINARY_MAGIC_0 == magic[0]) && (VERBOSE_BINARY_MAGIC_1 == magic[1])
+		&& (VERBOSE_BINARY_MAGIC_2 == magic[2]) && (VERBOSE_BINARY_MAGIC_3 == magic[3]);
+}
+
+/**
+ * Decode one file into the listener.
+ *
+ * @return true if the whole file was decoded
+ */
+static bool
+decodeFile(OMRPortLibrary *portLibrary, MM_VerboseBinaryDecoder *decoder, OutputListener *listener, const char *fileName, uint8_t *buffer)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		fprintf(stderr, "Error opening file : %s\n", fileName);
+		return false;
+	}
+
+	bool result = true;
+	decoder->reset();
+	int64_t fileLength = omrfile_flength(fd);
+	int64_t totalRead = 0;
+	intptr_t bytesRead = 0;
+	/* omrfile_read() returns -1 at the end of the file as well as on error */
+	while (0 < (bytesRead = omrfile_read(fd, buffer, READ_BUFFER_SIZE))) {
+		totalRead += bytesRead;
+		if (!decoder->decode(buffer, (uintptr_t)bytesRead)) {
+			break;
+		}
+	}
+	omrfile_close(fd);
+	listener->finish(fileName);
+
+	if (NULL != decoder->getError()) {
+		fprintf(stderr, "Error decoding file : %s after %llu records: %s\n", fileName, (unsigned long long)decoder->getRecordCount(), decoder->getError());
+		result = false;
+	} else if (totalRead < fileLength) {
+		fprintf(stderr, "Error reading file : %s\n", fileName);
+		result = false;
+	} else if (!decoder->atRecordBoundary()) {
+		/* a log still being written, or cut short: everything up to the last complete record has been decoded */
+		fprintf(stderr, "Warning : %s ends within a record\n", fileName);
+	}
+	return result;
+}
+
+int main(int argc, char **argv)
+{
+	int32_t totalFiles = 0;
+	int rc = 0;
+	int firstFile = 1;
+	OMRPortLibrary portLibrary;
+	XMLOutput xmlOutput;
+	CSVOutput csvOutput;
+	StatsOutput statsOutput;
+	OutputListener *listener = &xmlOutput;
+
+	if ((argc > 1) && ('-' == argv[1][0])) {
+		if (0 == strcmp(argv[1], "-xml")) {
+			listener = &xmlOutput;
+		} else if (0 == strcmp(argv[1], "-csv")) {
+			listener = &csvOutput;
+		} else if (0 == strcmp(argv[1], "-stats")) {
+			listener = &statsOutput;
+		} else {
+			fprintf(stderr, "usage: %s [-xml | -csv | -stats] [file ...]\n", argv[0]);
+			return -1;
+		}
+		firstFile = 2;
+	}
+
+	if (0 != omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT)) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed\n");
+		return -1;
+	}
+	if (0 != omrport_init_library(&portLibrary, sizeof(OMRPortLibrary))) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)) failed\n");
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	MM_VerboseBinaryDecoder decoder;
+	uint8_t *buffer = (uint8_t *)omrmem_allocate_memory(READ_BUFFER_SIZE, OMRMEM_CATEGORY_MM);
+	if ((NULL == buffer) || !decoder.initialize(&portLibrary, listener)) {
+		fprintf(stderr, "Failed to allocate the decoder\n");
+		rc = -1;
+	} else if (firstFile < argc) {
+		for (int i = firstFile; i < argc; i++) {
+			if (!decodeFile(&portLibrary, &decoder, listener, argv[i], buffer)) {
+				rc = -1;
+			}
+			totalFiles++;
+		}
+	} else {
+		char resultBuffer[128];
+		uintptr_t handle = omrfile_findfirst(SRC_DIR, resultBuffer);
+		uintptr_t rcFile = handle;
+		while ((uintptr_t)-1 != rcFile) {
+			if ((0 == strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX))) && isBinaryLog(&portLibrary, resultBuffer)) {
+				if (!decodeFile(&portLibrary, &decoder, listener, resultBuffer, buffer)) {
+					rc = -1;
+				}
+				totalFiles++;
+			}
+			rcFile = omrfile_findnext(handle, resultBuffer);
+		}
+		if ((uintptr_t)-1 != handle) {
+			omrfile_findclose(handle);
+		}
+	}
+
+	if ((0 == rc) && (totalFiles < 1)) {
+		fprintf(stderr, "Failed to find any binary verbose GC file to process!\n");
+	}
+
+	decoder.tearDown();
+	omrmem_free_memory(buffer);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return rc;
+}
@@ -433,3 +433,42 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 {
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
+
+/**
+* Get the number of bytes of a reserved range which are currently backed by huge pages, either
+* transparent huge pages or pages of an explicit huge page pool. This is only supported on Linux.
+* @param [in] portLibrary port library
+* @param [in] address base address of the range
+* @param [in] byteAmount size of the range
+* @param [out] hugePageBytes pointer to variable to receive result
+* @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED
+* if the platform cannot tell or no part of the range can be backed by huge pages (for example, transparent huge
+* pages are disabled).
+*/
+int32_t
+omrvmem_get_huge_page_coverage(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t *hugePageBytes)
+{
+	*hugePageBytes = 0;
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+/**
+ * Release the physical storage backing committed memory, leaving the range committed.
+ *
+ * The contents of the range become undefined. Where supported (MADV_FREE on Linux), the operating system
+ * reclaims the pages only when it runs short of memory, so touching them again before then costs no page
+ * fault. Elsewhere this is the same as omrvmem_decommit_memory, and like it releases nothing unless
+ * vmemAdviseOSonFree is set.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] address The starting address of the memory to be released. Must be page aligned.
+ * @param[in] byteAmount The number of bytes to be released. Must be an exact multiple of page size.
+ * @param[in] identifier Descriptor for virtual memory block.
+ *
+ * @return 0 on success, non zero on failure.
+ */
+intptr_t
+omrvmem_release_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	return portLibrary->vmem_decommit_memory(portLibrary, address, byteAmount, identifier);
+}
@@ -55,6 +55,15 @@
 #if !defined(MADV_HUGEPAGE)
 #define MADV_HUGEPAGE 14
 #endif /* MADV_HUGEPAGE */
+#if !defined(MADV_NOHUGEPAGE)
+#define MADV_NOHUGEPAGE 15
+#endif /* MADV_NOHUGEPAGE */
+#if !defined(MADV_FREE)
+#define MADV_FREE 8
+#endif /* MADV_FREE */
+
+#define VMEM_PROC_SMAPS_FNAME "/proc/self/smaps"
+#define VMEM_SMAPS_LINE_MAX 512
 
 #if !defined(MFD_HUGETLB)
 #define MFD_HUGETLB 0x4
@@ -140,7 +149,7 @@ static void *allocateMemoryWithShmat(struct OMRPortLibrary *portLibrary, struct
 static BOOLEAN isStrictAndOutOfRange(void *memoryPointer, void *startAddress, void *endAddress, uintptr_t vmemOptions);
 static BOOLEAN rangeIsValid(struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount);
 static void *reserveMemoryWithShmat(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t pageSize, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t mode);
-static uintptr_t adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount);
+static uintptr_t adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount, uintptr_t mode);
 
 static BOOLEAN set_flags_for_mmap(int *flags);
 static void *reserve_memory_with_mmap(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t mode, uintptr_t pageSize, OMRMemCategory *category);
@@ -943,19 +952,28 @@ reserveMemoryWithShmat(struct OMRPortLibrary *portLibrary, struct J9PortVmemIden
  * Advise memory to enable use of Transparent HugePages (THP) (Linux Only)
  *
  * Notify kernel that the virtual memory region specified by address and byteAmount should be labelled
- * with MADV_HUGEPAGE, where the khugepage process could promote to THP when possible.
+ * with MADV_HUGEPAGE, where the khugepage process could promote to THP when possible. This is done when
+ * the system THP mode is "madvise" or OMRPORT_VMEM_MEMORY_MODE_ADVISE_HUGEPAGE is requested. The region
+ * is labelled with MADV_NOHUGEPAGE instead if OMRPORT_VMEM_MEMORY_MODE_NO_HUGEPAGE is requested.
  *
  * @param[in] portLibrary The port library.
  * @param[in] address The starting virtual address.
  * @param[in] byteAmount The amount of bytes after address to map to hugepage.
+ * @param[in] mode Bitmap indicating how memory is to be reserved.
  *
  * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
  */
 static uintptr_t
-adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount)
+adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount, uintptr_t mode)
 {
 #if defined(MAP_ANON) || defined(MAP_ANONYMOUS)
-	if (portLibrary->portGlobals->vmemEnableMadvise) {
+	int advice = 0;
+	if (OMR_ARE_ANY_BITS_SET(mode, OMRPORT_VMEM_MEMORY_MODE_NO_HUGEPAGE)) {
+		advice = MADV_NOHUGEPAGE;
+	} else if (portLibrary->portGlobals->vmemEnableMadvise || OMR_ARE_ANY_BITS_SET(mode, OMRPORT_VMEM_MEMORY_MODE_ADVISE_HUGEPAGE)) {
+		advice = MADV_HUGEPAGE;
+	}
+	if (0 != advice) {
 		uintptr_t start = (uintptr_t)address;
 		uintptr_t end = (uintptr_t)address + byteAmount;
 
@@ -963,7 +981,7 @@ adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byte
 		start = start + ((start % PPG_vmem_pageSize[0]) ? (PPG_vmem_pageSize[0] - (start % PPG_vmem_pageSize[0])) : 0);
 		end = end - (end % PPG_vmem_pageSize[0]);
 		if (start < end) {
-			if (0 != madvise((void *)start, end - start, MADV_HUGEPAGE)) {
+			if (0 != madvise((void *)start, end - start, advice)) {
 				return OMRPORT_ERROR_VMEM_OPFAILED;
 			}
 		}
@@ -1886,7 +1904,7 @@ allocAnywhere:
 
 		memoryPointer = NULL;
 	} else if (0 == (mode & OMRPORT_VMEM_MEMORY_MODE_MMAP_HUGE_PAGES)) {
-		adviseHugepage(portLibrary, memoryPointer, byteAmount);
+		adviseHugepage(portLibrary, memoryPointer, byteAmount, mode);
 	}
 
 	return memoryPointer;
@@ -2280,6 +2298,71 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	return result;
 }
 
+int32_t
+omrvmem_get_huge_page_coverage(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t *hugePageBytes)
+{
+	int32_t result = OMRPORT_ERROR_VMEM_OPFAILED;
+	FILE *smapsStream = fopen(VMEM_PROC_SMAPS_FNAME, "r");
+
+	*hugePageBytes = 0;
+	if (NULL != smapsStream) {
+		uintptr_t rangeBase = (uintptr_t)address;
+		uintptr_t rangeTop = rangeBase + byteAmount;
+		uintptr_t mappingSize = 0;
+		uintptr_t overlapSize = 0;
+		double coverage = 0.0;
+		BOOLEAN atLineStart = TRUE;
+		BOOLEAN eligibilityReported = FALSE;
+		BOOLEAN eligible = FALSE;
+		char line[VMEM_SMAPS_LINE_MAX];
+
+		while (NULL != fgets(line, sizeof(line), smapsStream)) {
+			BOOLEAN isLineTail = !atLineStart;
+			uintptr_t low = 0;
+			uintptr_t high = 0;
+			char fieldName[64];
+			uintptr_t fieldValue = 0;
+
+			atLineStart = (NULL != strchr(line, '\n'));
+			if (isLineTail) {
+				/* the remainder of an over-long line, such as one naming a mapped file */
+				continue;
+			}
+			if (2 == sscanf(line, "%" SCNxPTR "-%" SCNxPTR, &low, &high)) {
+				/* first line of a mapping; the fields that follow describe it */
+				uintptr_t overlapBase = OMR_MAX(low, rangeBase);
+				uintptr_t overlapTop = OMR_MIN(high, rangeTop);
+				mappingSize = high - low;
+				overlapSize = (overlapBase < overlapTop) ? (overlapTop - overlapBase) : 0;
+			} else if ((0 != overlapSize) && (2 == sscanf(line, "%63s %" SCNuPTR, fieldName, &fieldValue))) {
+				if ((0 == strcmp(fieldName, "AnonHugePages:"))
+					|| (0 == strcmp(fieldName, "Private_Hugetlb:"))
+					|| (0 == strcmp(fieldName, "Shared_Hugetlb:"))
+				) {
+					/* values are in kB and cover the whole mapping, so only count the part within the range */
+					coverage += (double)fieldValue * 1024.0 * ((double)overlapSize / (double)mappingSize);
+				} else if (0 == strcmp(fieldName, "THPeligible:")) {
+					/* 0 where THP is disabled ("never"), or "madvise" and the mapping was not advised */
+					eligibilityReported = TRUE;
+					eligible = eligible || (0 != fieldValue);
+				} else if (0 == strcmp(fieldName, "KernelPageSize:")) {
+					/* mappings of an explicit huge page pool are never THP eligible */
+					eligible = eligible || ((fieldValue * 1024) > PPG_vmem_pageSize[0]);
+				}
+			}
+		}
+		fclose(smapsStream);
+		*hugePageBytes = (uintptr_t)coverage;
+		if (eligibilityReported && !eligible && (0 == *hugePageBytes)) {
+			/* no part of the range can be backed by huge pages */
+			result = OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+		} else {
+			result = 0;
+		}
+	}
+	return result;
+}
+
 static void
 addressIterator_init(AddressIterator *iterator, ADDRESS minimum, ADDRESS maximum, uintptr_t alignment, intptr_t direction)
 {
@@ -2357,3 +2440,28 @@ addressIterator_next(AddressIterator *iterator, ADDRESS *address)
 
 	return hasNext;
 }
+
+intptr_t
+omrvmem_release_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	intptr_t result = -1;
+
+	if ((1 == portLibrary->portGlobals->vmemAdviseOSonFree)
+		&& (OMRPORT_VMEM_RESERVE_USED_MMAP == identifier->allocator)
+		&& (0 < byteAmount)
+		&& rangeIsValid(identifier, address, byteAmount)
+	) {
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(address, identifier->pageSize);
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(byteAmount, identifier->pageSize);
+
+		result = (intptr_t)madvise((void *)address, (size_t)byteAmount, MADV_FREE);
+		if ((0 != result) && (EINVAL == errno)) {
+			/* kernels before 4.5 and hugetlbfs pages do not support lazy freeing */
+			result = omrvmem_decommit_memory(portLibrary, address, byteAmount, identifier);
+		}
+	} else {
+		result = omrvmem_decommit_memory(portLibrary, address, byteAmount, identifier);
+	}
+
+	return result;
+}
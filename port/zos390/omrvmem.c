@@ -1653,3 +1653,16 @@ omrvmem_create_double_mapped_region(struct OMRPortLibrary *portLibrary, void* re
         portLibrary->error_set_last_error(portLibrary,  errno, OMRPORT_ERROR_VMEM_NOT_SUPPORTED);
         return NULL;
 }
+
+int32_t
+omrvmem_get_huge_page_coverage(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t *hugePageBytes)
+{
+	*hugePageBytes = 0;
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+intptr_t
+omrvmem_release_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	return portLibrary->vmem_decommit_memory(portLibrary, address, byteAmount, identifier);
+}